@@ -63,6 +63,11 @@ struct X(plan_s) {
      plan *pln;
      problem *prb;
      int sign;
+     struct pcentry_s *cached; /* owner of PLN, if in the plan cache */
+     struct X(threadpool_s) *pool; /* X(plan_set_threadpool), or 0 */
+     int nthr; /* threads of the planner that made it */
+     scratch ws; /* workspace of its buffers, if ws.base (FFTW_REALTIME) */
+     void *ws_own; /* memory of WS that the plan frees, or 0 */
 };
 
 /* shorthand */
@@ -73,6 +78,42 @@ typedef R C[2];
 
 #define EXTRACT_REIM(sign, c, r, i) X(extract_reim)(sign, (c)[0], r, i)
 
+/* a plan bound to a thread pool runs its threaded loops there; the
+   threads library sets the hooks */
+extern struct X(threadpool_s) *(*X(threadpool_enter_hook))(
+     struct X(threadpool_s) *pool);
+extern void (*X(threadpool_leave_hook))(struct X(threadpool_s) *prev);
+
+/* run f(data, lo, hi) on up to NTHR threads, for ranges that cover
+   0 <= i < n (api/execute-batch.c); set by the threads library */
+extern void (*X(batch_hook))(int n, int nthr,
+			     void (*f)(void *data, int lo, int hi),
+			     void *data);
+
+/* run WHAT with the workspace of plan P current, if it has one */
+#define WITH_PLAN_SCRATCH(p, what)				\
+{								\
+     if ((p)->ws.base) {					\
+	  scratch *prev_ws =					\
+	       X(scratch_enter)((scratch *) &(p)->ws);		\
+	  what;							\
+	  X(scratch_leave)(prev_ws);				\
+     } else							\
+	  what;							\
+}
+
+/* ... and its thread pool too */
+#define WITH_PLAN_POOL(p, what)					\
+WITH_PLAN_SCRATCH(p, {						\
+     if ((p)->pool) {						\
+	  struct X(threadpool_s) *prev_pool =			\
+	       X(threadpool_enter_hook)((p)->pool);		\
+	  what;							\
+	  X(threadpool_leave_hook)(prev_pool);			\
+     } else							\
+	  what;							\
+})
+
 #define TAINT_UNALIGNED(p, flg) TAINT(p, ((flg) & FFTW_UNALIGNED) != 0)
 
 tensor *X(mktensor_rowmajor)(int rnk, const int *n,
@@ -98,12 +139,24 @@ printer *X(mkprinter_cnt)(size_t *cnt);
 printer *X(mkprinter_str)(char *s);
 
 FFTW_EXTERN planner *X(the_planner)(void);
+extern planner *(*X(the_planner_hook))(void);
 void X(configure_planner)(planner *plnr);
+void X(cost_model_cleanup)(void);
+FFTW_EXTERN int X(cost_model_error)(const char *model_filename,
+				    const char *log_filename,
+				    double *model_err, double *opcnt_err);
+void X(plan_cache_cleanup)(void);
 
 void X(mapflags)(planner *, unsigned);
 
 apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb);
 
+apiplan *X(plan_cache_lookup)(const planner *plnr, unsigned flags, int sign,
+			      problem *prb);
+void X(plan_cache_insert)(const planner *plnr, unsigned flags, apiplan *p,
+			  size_t bytes);
+void X(plan_cache_release)(apiplan *p);
+
 rdft_kind *X(map_r2r_kind)(int rank, const X(r2r_kind) * kind);
 
 typedef void (*planner_hook_t)(void);
@@ -93,12 +93,28 @@ apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
                                          FFTW_PATIENT, FFTW_EXHAUSTIVE};
      int pat, pat_max;
      double pcost = 0;
+     unsigned flags0 = flags;
+     size_t mem = 0;
+     arena *prev;
+     int nthr;
      
      if (before_planner_hook)
           before_planner_hook();
      
      plnr = X(the_planner)();
 
+     /* the threads hand work over under locks: a realtime plan is
+	single-threaded */
+     nthr = plnr->nthr;
+     if (flags0 & FFTW_REALTIME)
+	  plnr->nthr = 1;
+
+     if ((p = X(plan_cache_lookup)(plnr, flags0, sign, prb)))
+	  goto done;
+
+     /* the plans, problems and tensors of the search die with it */
+     prev = X(arena_enter)(plnr->mem);
+
      if (flags & FFTW_WISDOM_ONLY) {
 	  /* Special mode that returns a plan only if wisdom is present,
 	     and returns 0 otherwise.  This is now documented in the manual,
@@ -137,29 +153,56 @@ apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
      }
 
      if (pln) {
-	  /* build apiplan */
-	  p = (apiplan *) MALLOC(sizeof(apiplan), PLANS);
-	  p->prb = prb;
-	  p->sign = sign; /* cache for execute_dft */
+	  plan *pln1;
+	  arena *mem1 = X(mkarena)(2048), *prev1;
+
+	  X(arena_set_huge)(mem1, (flags0 & FFTW_HUGE_PAGES) != 0);
 
-	  /* re-create plan from wisdom, adding blessing */
-	  p->pln = mkplan(plnr, flags_used_for_planning, prb, BLESSING);
+	  /* re-create plan from wisdom, adding blessing, in an arena of
+	     its own that keeps it and its children together */
+	  prev1 = X(arena_enter)(mem1);
+	  pln1 = mkplan(plnr, flags_used_for_planning, prb, BLESSING);
+	  X(arena_leave)(prev1);
+	  pln1->mem = mem1;
 
 	  /* record pcost from most recent measurement for use in X(cost) */
-	  p->pln->pcost = pcost;
+	  pln1->pcost = pcost;
 
+	  mem = X(thread_malloc_bytes)();
 	  if (sizeof(trigreal) > sizeof(R)) {
 	       /* this is probably faster, and we have enough trigreal
 		  bits to maintain accuracy */
-	       X(plan_awake)(p->pln, AWAKE_SQRTN_TABLE);
+	       X(plan_awake)(pln1, AWAKE_SQRTN_TABLE);
 	  } else {
 	       /* more accurate */
-	       X(plan_awake)(p->pln, AWAKE_SINCOS);
+	       X(plan_awake)(pln1, AWAKE_SINCOS);
 	  }
 
-	  /* we don't use pln for p->pln, above, since by re-creating the
+	  mem = X(thread_malloc_bytes)() - mem + X(arena_bytes)(mem1);
+
+	  /* we don't use pln for pln1, above, since by re-creating the
 	     plan we might use more patient wisdom from a timed-out mkplan */
 	  X(plan_destroy_internal)(pln);
+	  pln = pln1;
+     }
+
+     X(arena_leave)(prev);
+     X(arena_reset)(plnr->mem);
+
+     if (pln) {
+	  /* build apiplan; not tagged PLANS, since it must not come from
+	     an arena: X(destroy_plan) frees it with X(ifree) */
+	  p = (apiplan *) MALLOC(sizeof(apiplan), OTHER);
+	  p->prb = prb;
+	  p->sign = sign; /* cache for execute_dft */
+	  p->cached = 0;
+	  p->pool = 0;
+	  p->nthr = plnr->nthr;
+	  p->ws.base = 0;
+	  p->ws_own = 0;
+	  p->pln = pln;
+
+	  X(plan_cache_insert)(plnr, flags0, p, mem);
      } else
 	  X(problem_destroy)(prb);
 
@@ -170,6 +213,18 @@ apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
      X(random_estimate_seed)++; /* subsequent "random" plans are distinct */
 #endif
 
+ done:
+     plnr->nthr = nthr;
+     if (p && (flags0 & FFTW_REALTIME)) {
+	  /* the buffers of its executions come from a workspace of its
+	     own, allocated now */
+	  size_t n = X(plan_scratch_size)(p);
+	  if (n) {
+	       p->ws_own = MALLOC(n, BUFFERS);
+	       X(scratch_init)(&p->ws, p->ws_own, n);
+	  }
+     }
+
      if (after_planner_hook)
           after_planner_hook();
      
@@ -182,9 +237,14 @@ void X(destroy_plan)(X(plan) p)
           if (before_planner_hook)
                before_planner_hook();
      
-          X(plan_awake)(p->pln, SLEEPY);
-          X(plan_destroy_internal)(p->pln);
+          if (p->cached)
+               X(plan_cache_release)(p);
+          else {
+               X(plan_awake)(p->pln, SLEEPY);
+               X(plan_destroy_internal)(p->pln);
+          }
           X(problem_destroy)(p->prb);
+          X(ifree0)(p->ws_own);
           X(ifree)(p);
 
           if (after_planner_hook)
@@ -192,6 +252,25 @@ void X(destroy_plan)(X(plan) p)
      }
 }
 
+/* bytes of a workspace that serves every buffer of the executions of P,
+   or 0 if they need none */
+size_t X(plan_scratch_size)(const X(plan) p)
+{
+     return p->pln->scratch ? p->pln->scratch + SCRATCH_ALIGN : 0;
+}
+
+/* serve the buffers of the executions of P from the X(plan_scratch_size)
+   bytes at MEM instead of its own workspace, or from the heap if MEM is
+   0 */
+void X(plan_set_scratch)(X(plan) p, void *mem)
+{
+     if (p) {
+	  X(ifree0)(p->ws_own);
+	  p->ws_own = 0;
+	  X(scratch_init)(&p->ws, mem, X(plan_scratch_size)(p));
+     }
+}
+
 int X(alignment_of)(R *p)
 {
      return X(ialignment_of(p));
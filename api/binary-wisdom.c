@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* wisdom in the binary format of kernel/planner.c, which the planner
+   queries in place: importing maps the file and checks its header
+   only, however many solutions it holds.  A shared wisdom file is
+   mapped writable by every process that attaches it, and all of them
+   publish their wisdom there. */
+
+#include "api/api.h"
+#include <stdio.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#  define WIN32_LEAN_AND_MEAN
+#  include <windows.h>
+#  define USE_MAPVIEW 1
+#elif defined(HAVE_SYS_MMAN_H) && defined(HAVE_SYS_STAT_H) && defined(HAVE_UNISTD_H)
+#  include <sys/types.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <errno.h>
+#  include <fcntl.h>
+#  include <stdlib.h>
+#  include <string.h>
+#  include <unistd.h>
+#  define USE_MMAP 1
+#endif
+
+int X(export_wisdom_to_binary_filename)(const char *filename)
+{
+     planner *plnr = X(the_planner)();
+     void *image;
+     size_t n = X(planner_export_binary)(plnr, &image);
+     FILE *f = fopen(filename, "wb");
+     int ret;
+
+     if (!f) {
+	  X(ifree)(image);
+	  return 0; /* error opening file */
+     }
+     ret = fwrite(image, 1, n, f) == n;
+     if (fclose(f)) ret = 0; /* error closing file */
+     X(ifree)(image);
+     return ret;
+}
+
+#if defined(USE_MMAP)
+typedef struct {
+     void *addr;
+     size_t n;
+} mapping;
+
+static void unmap(void *arg)
+{
+     mapping *m = (mapping *) arg;
+     munmap(m->addr, m->n);
+     X(ifree)(m);
+}
+
+int X(import_wisdom_from_binary_filename)(const char *filename)
+{
+     int fd = open(filename, O_RDONLY);
+     struct stat st;
+     mapping *m;
+
+     if (fd < 0) return 0; /* error opening file */
+     if (fstat(fd, &st) || st.st_size <= 0) {
+	  close(fd);
+	  return 0;
+     }
+
+     m = (mapping *) MALLOC(sizeof(mapping), OTHER);
+     m->n = (size_t) st.st_size;
+     m->addr = mmap(0, m->n, PROT_READ, MAP_PRIVATE, fd, 0);
+     close(fd);
+     if (m->addr == MAP_FAILED) {
+	  X(ifree)(m);
+	  return 0;
+     }
+
+     if (!X(planner_attach_binary)(X(the_planner)(), m->addr, m->n, 0,
+				   unmap, m)) {
+	  unmap(m);
+	  return 0;
+     }
+     return 1;
+}
+
+/* the shared wisdom file FILENAME, made ready by this process: the
+   table is built in a private file and linked into place complete, so
+   that nobody ever sees it half made (nor is it left so if we die) */
+static int create_shared(const char *filename, int nsolutions)
+{
+     planner *plnr = X(the_planner)();
+     size_t nslot = 16, n;
+     char *tmp;
+     void *addr;
+     int fd;
+
+     while ((int) (nslot / 2) < nsolutions)	/* at most half full */
+	  nslot *= 2;
+     n = X(planner_format_binary)(plnr, 0, nslot);
+
+     tmp = (char *) MALLOC(strlen(filename) + 8, OTHER);
+     strcpy(tmp, filename);
+     strcat(tmp, ".XXXXXX");
+     fd = mkstemp(tmp);
+     if (fd < 0) {
+	  X(ifree)(tmp);
+	  return -1;
+     }
+     if (ftruncate(fd, (off_t) n)
+	 || (addr = mmap(0, n, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0))
+	 == MAP_FAILED) {
+	  close(fd);
+	  unlink(tmp);
+	  X(ifree)(tmp);
+	  return -1;
+     }
+     X(planner_format_binary)(plnr, addr, nslot);
+     munmap(addr, n);
+
+     if (link(tmp, filename)) {
+	  /* somebody else made it first: use theirs */
+	  close(fd);
+	  fd = errno == EEXIST ? open(filename, O_RDWR) : -1;
+     }
+     unlink(tmp);
+     X(ifree)(tmp);
+     return fd;
+}
+
+int X(attach_shared_wisdom)(const char *filename, int nsolutions)
+{
+     int fd = open(filename, O_RDWR);
+     struct stat st;
+     mapping *m;
+
+     if (fd < 0 && errno == ENOENT)
+	  fd = create_shared(filename, nsolutions > 0 ? nsolutions : 8192);
+     if (fd < 0) return 0; /* error opening file */
+     if (fstat(fd, &st) || st.st_size <= 0) {
+	  close(fd);
+	  return 0;
+     }
+
+     m = (mapping *) MALLOC(sizeof(mapping), OTHER);
+     m->n = (size_t) st.st_size;
+     m->addr = mmap(0, m->n, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+     close(fd);
+     if (m->addr == MAP_FAILED) {
+	  X(ifree)(m);
+	  return 0;
+     }
+
+     if (!X(planner_attach_binary)(X(the_planner)(), m->addr, m->n, 1,
+				   unmap, m)) {
+	  unmap(m);
+	  return 0;
+     }
+     return 1;
+}
+
+#elif defined(USE_MAPVIEW)
+static void unmap(void *arg)
+{
+     UnmapViewOfFile(arg);
+}
+
+int X(import_wisdom_from_binary_filename)(const char *filename)
+{
+     HANDLE f, h;
+     LARGE_INTEGER sz;
+     void *addr;
+
+     f = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, 0,
+		     OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+     if (f == INVALID_HANDLE_VALUE) return 0; /* error opening file */
+     if (!GetFileSizeEx(f, &sz) || sz.QuadPart <= 0) {
+	  CloseHandle(f);
+	  return 0;
+     }
+     h = CreateFileMappingA(f, 0, PAGE_READONLY, 0, 0, 0);
+     CloseHandle(f);
+     if (!h) return 0;
+     addr = MapViewOfFile(h, FILE_MAP_READ, 0, 0, 0);
+     CloseHandle(h); /* the view keeps the mapping alive */
+     if (!addr) return 0;
+
+     if (!X(planner_attach_binary)(X(the_planner)(), addr, 
+				   (size_t) sz.QuadPart, 0, unmap, addr)) {
+	  unmap(addr);
+	  return 0;
+     }
+     return 1;
+}
+
+int X(attach_shared_wisdom)(const char *filename, int nsolutions)
+{
+     UNUSED(filename); UNUSED(nsolutions);
+     return 0; /* not implemented */
+}
+
+#else
+/* no mapping: read the whole file */
+static void release(void *arg)
+{
+     X(ifree)(arg);
+}
+
+int X(import_wisdom_from_binary_filename)(const char *filename)
+{
+     FILE *f = fopen(filename, "rb");
+     long n;
+     void *image;
+     int ret;
+
+     if (!f) return 0; /* error opening file */
+     if (fseek(f, 0, SEEK_END) || (n = ftell(f)) <= 0 
+	 || fseek(f, 0, SEEK_SET)) {
+	  fclose(f);
+	  return 0;
+     }
+     image = MALLOC((size_t) n, OTHER);
+     ret = fread(image, 1, (size_t) n, f) == (size_t) n
+	  && X(planner_attach_binary)(X(the_planner)(), image, (size_t) n,
+				      0, release, image);
+     fclose(f);
+     if (!ret)
+	  X(ifree)(image);
+     return ret;
+}
+
+int X(attach_shared_wisdom)(const char *filename, int nsolutions)
+{
+     UNUSED(filename); UNUSED(nsolutions);
+     return 0; /* no shared memory */
+}
+#endif
@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Calibrated FFTW_ESTIMATE.  A program records the plans that the
+   planner times (solver, own operation counts, time, operation counts
+   and time of the children, and problem, one line each) with
+   X(record_measurements_to_filename); X(fit_cost_model) fits a cost
+   model to such records offline; and X(import_cost_model_from_filename)
+   makes estimates use the model.
+
+   A plan takes the time of its children plus that of its own work.
+   The model prices the own work only (see model_cost in planner.c):
+   each kind of operation in timer units (those of the recorded times),
+   plus a constant for executing the plan at all, times a factor for
+   the solver that made the plan, which accounts for what the operation
+   count misses (loop overhead, strides, buffering), times the pace of
+   the children, their time over their modelled work.  It is fitted to
+   the own times, the recorded time less that of the children: the
+   weights by least squares on relative error over the plans without
+   children, then each factor as the median ratio of measured to
+   modelled own time of the plans of its solver.  X(cost_model_error)
+   tells how well a model predicts the own times in another log (of
+   problems it was not fitted to), next to the bare operation count. */
+
+#include "api/api.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* version 2 prices the plan's own work only */
+#define MODEL_PREAMBLE \
+     PACKAGE "-" VERSION " " STRINGIZE(X(cost_model)) " 2"
+#define NAMESZ 128
+
+/*************************************************************
+ * Recording
+ *************************************************************/
+
+static FILE *mlog = 0;
+
+static void record(const planner *ego, unsigned slvndx, const plan *pln,
+		   const problem *p, double t)
+{
+     slvdesc *sp = ego->slvdescs + slvndx;
+     printer *pr;
+     opcnt own;
+     size_t cnt, len;
+     char *s;
+
+     if (slvndx >= ego->nslvdesc || !mlog || pln->cldcost < 0)
+	  return; /* no solver, no log, or children of unknown time */
+
+     pr = X(mkprinter_cnt)(&cnt);
+     p->adt->print(p, pr);
+     X(printer_destroy)(pr);
+
+     /* one fputs() per line, since several threads may be planning */
+     X(own_ops)(pln, &own);
+     len = strlen(sp->reg_nam) + 11 * 32 + cnt + 8;
+     s = (char *) MALLOC(len, OTHER);
+     sprintf(s, "%s %d %.17g %.17g %.17g %.17g %.17g "
+	     "%.17g %.17g %.17g %.17g %.17g ", sp->reg_nam, sp->reg_id,
+	     own.add, own.mul, own.fma, own.other, t,
+	     pln->cldops.add, pln->cldops.mul, pln->cldops.fma,
+	     pln->cldops.other, pln->cldcost);
+     pr = X(mkprinter_str)(s + strlen(s));
+     p->adt->print(p, pr);
+     X(printer_destroy)(pr);
+     strcat(s, "\n");
+     fputs(s, mlog);
+     X(ifree)(s);
+}
+
+int X(record_measurements_to_filename)(const char *filename)
+{
+     X(measurement_hook) = 0;
+     if (mlog) {
+	  if (fclose(mlog)) { mlog = 0; return 0; }
+	  mlog = 0;
+     }
+     if (!filename)
+	  return 1;
+
+     if (!(mlog = fopen(filename, "a")))
+	  return 0; /* error opening file */
+     X(measurement_hook) = record;
+     return 1;
+}
+
+/*************************************************************
+ * Fitting
+ *************************************************************/
+
+typedef struct {
+     double x[4];  /* own add, mul, fma, other */
+     double t;     /* own time */
+     double c[4];  /* the children's add, mul, fma, other */
+     double tc;    /* their time */
+     double pace;  /* tc over their modelled time, or 1 */
+     int s;        /* index into the solver names */
+} sample;
+
+typedef struct {
+     char name[NAMESZ];
+     int id;
+} solvername;
+
+static int read_log(FILE *f, sample **samples, int *n,
+		    solvername **names, int *nnames)
+{
+     char line[4096], name[NAMESZ];
+     int nalloc = 0, nnalloc = 0, id, i;
+     double x[4], t, c[4], tc;
+
+     *samples = 0; *names = 0; *n = *nnames = 0;
+     while (fgets(line, sizeof(line), f)) {
+	  if (sscanf(line, "%127s %d %lg %lg %lg %lg %lg %lg %lg %lg %lg %lg",
+		     name, &id, x, x + 1, x + 2, x + 3, &t,
+		     c, c + 1, c + 2, c + 3, &tc) != 12)
+	       continue; /* not a record */
+	  t -= tc;
+	  if (t <= 0)
+	       continue; /* no own time to fit, within the noise */
+
+	  for (i = 0; i < *nnames; ++i)
+	       if ((*names)[i].id == id && !strcmp((*names)[i].name, name))
+		    break;
+	  if (i == *nnames) {
+	       if (*nnames >= nnalloc) {
+		    solvername *nn;
+		    nnalloc = 2 * nnalloc + 16;
+		    nn = (solvername *) MALLOC(nnalloc * sizeof(solvername),
+					       OTHER);
+		    if (*nnames)
+			 memcpy(nn, *names, *nnames * sizeof(solvername));
+		    X(ifree0)(*names);
+		    *names = nn;
+	       }
+	       strcpy((*names)[i].name, name);
+	       (*names)[i].id = id;
+	       ++*nnames;
+	  }
+
+	  if (*n >= nalloc) {
+	       sample *ns;
+	       nalloc = 2 * nalloc + 256;
+	       ns = (sample *) MALLOC(nalloc * sizeof(sample), OTHER);
+	       if (*n)
+		    memcpy(ns, *samples, *n * sizeof(sample));
+	       X(ifree0)(*samples);
+	       *samples = ns;
+	  }
+	  memcpy((*samples)[*n].x, x, sizeof(x));
+	  (*samples)[*n].t = t;
+	  memcpy((*samples)[*n].c, c, sizeof(c));
+	  (*samples)[*n].tc = tc;
+	  (*samples)[*n].pace = 1.0;
+	  (*samples)[*n].s = i;
+	  ++*n;
+     }
+     return !ferror(f);
+}
+
+/* the weights: add, mul, fma, other, and the constant per execution */
+#define NW 5
+
+/* least squares for W >= 0 in sum_i ((w.x_i + w_4) / t_i - 1)^2 over
+   the samples without children, whose time is all their own.  Weights
+   that come out negative are dropped and the rest refitted. */
+static void fit_weights(const sample *smp, int n, double *w)
+{
+     int active[NW] = { 1, 1, 1, 1, 1 }, k, j, i, again;
+
+     do {
+	  double a[NW][NW + 1];
+
+	  for (j = 0; j < NW; ++j)
+	       for (k = 0; k <= NW; ++k)
+		    a[j][k] = 0;
+	  for (i = 0; i < n; ++i) {
+	       double r[NW], c = 1.0 / smp[i].t;
+	       if (smp[i].tc > 0)
+		    continue;
+	       for (j = 0; j < NW; ++j)
+		    r[j] = active[j] ? (j < 4 ? smp[i].x[j] : 1.0) * c : 0;
+	       for (j = 0; j < NW; ++j) {
+		    for (k = 0; k < NW; ++k)
+			 a[j][k] += r[j] * r[k];
+		    a[j][NW] += r[j];
+	       }
+	  }
+	  /* unused features, and a little ridge for the others */
+	  for (j = 0; j < NW; ++j)
+	       a[j][j] = a[j][j] * (1 + 1e-9) + (a[j][j] == 0);
+
+	  /* Gauss-Jordan */
+	  for (j = 0; j < NW; ++j) {
+	       int piv = j;
+	       for (k = j + 1; k < NW; ++k)
+		    if (fabs(a[k][j]) > fabs(a[piv][j]))
+			 piv = k;
+	       for (k = 0; k <= NW; ++k) {
+		    double tmp = a[j][k]; a[j][k] = a[piv][k]; a[piv][k] = tmp;
+	       }
+	       for (k = 0; k < NW; ++k)
+		    if (k != j) {
+			 double m = a[k][j] / a[j][j];
+			 for (i = j; i <= NW; ++i)
+			      a[k][i] -= m * a[j][i];
+		    }
+	  }
+
+	  again = 0;
+	  for (j = 0; j < NW; ++j) {
+	       w[j] = active[j] ? a[j][NW] / a[j][j] : 0;
+	       if (w[j] < 0) {
+		    active[j] = 0;
+		    again = 1;
+	       }
+	  }
+     } while (again);
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+     double x = *(const double *) a, y = *(const double *) b;
+     return (x > y) - (x < y);
+}
+
+static double median(double *r, int n)
+{
+     qsort(r, n, sizeof(double), cmp_double);
+     return (n % 2) ? r[n / 2] : 0.5 * (r[n / 2 - 1] + r[n / 2]);
+}
+
+static double weigh(const double *w, const double *x)
+{
+     return w[0] * x[0] + w[1] * x[1] + w[2] * x[2] + w[3] * x[3];
+}
+
+/* the modelled own time of a sample, before its factor and pace */
+static double weigh_own(const double *w, const sample *smp)
+{
+     return weigh(w, smp->x) + w[4];
+}
+
+/* the pace of the children of each sample under weights W */
+static void fit_paces(sample *smp, int n, const double *w)
+{
+     int i;
+
+     for (i = 0; i < n; ++i) {
+	  double c = weigh(w, smp[i].c);
+	  smp[i].pace = (c > 0 && smp[i].tc > 0) ? smp[i].tc / c : 1.0;
+     }
+}
+
+/* median over the samples of each solver of measured/modelled time */
+static void fit_factors(const sample *smp, int n, int nnames,
+			const double *w, double *factor)
+{
+     double *r = (double *) MALLOC((n + 1) * sizeof(double), OTHER);
+     int s, i, m;
+
+     for (s = 0; s < nnames; ++s) {
+	  for (i = m = 0; i < n; ++i)
+	       if (smp[i].s == s) {
+		    double c = weigh_own(w, smp + i) * smp[i].pace;
+		    if (c > 0)
+			 r[m++] = smp[i].t / c;
+	       }
+	  factor[s] = m ? median(r, m) : 1.0;
+     }
+     X(ifree)(r);
+}
+
+int X(fit_cost_model)(const char *log_filename, const char *model_filename)
+{
+     FILE *f = fopen(log_filename, "r");
+     sample *smp;
+     solvername *names;
+     double w[NW], *factor;
+     int n, nnames, s, ret;
+
+     if (!f) return 0; /* error opening file */
+     ret = read_log(f, &smp, &n, &names, &nnames);
+     fclose(f);
+     if (!ret || n == 0) {
+	  X(ifree0)(smp);
+	  X(ifree0)(names);
+	  return 0;
+     }
+
+     factor = (double *) MALLOC(nnames * sizeof(double), OTHER);
+     fit_weights(smp, n, w);
+     fit_paces(smp, n, w);
+     fit_factors(smp, n, nnames, w, factor);
+
+     ret = 0;
+     if ((f = fopen(model_filename, "w"))) {
+	  fprintf(f, "(" MODEL_PREAMBLE "\n");
+	  fprintf(f, "  (weights %.17g %.17g %.17g %.17g %.17g)\n",
+		  w[0], w[1], w[2], w[3], w[4]);
+	  for (s = 0; s < nnames; ++s)
+	       fprintf(f, "  (%s %d %.17g)\n", names[s].name, names[s].id,
+		       factor[s]);
+	  fprintf(f, ")\n");
+	  ret = !ferror(f);
+	  if (fclose(f)) ret = 0;
+     }
+
+     X(ifree)(factor);
+     X(ifree)(smp);
+     X(ifree)(names);
+     return ret;
+}
+
+/*************************************************************
+ * Using the model
+ *************************************************************/
+
+static costmodel *model = 0;
+
+static void drop_model(void)
+{
+     X(cost_model) = 0;
+     if (model) {
+	  X(ifree)(model->factor);
+	  X(ifree)(model);
+	  model = 0;
+     }
+}
+
+/* the weights and the factors, by solver name, of a model file */
+static int read_model(FILE *f, double *w, solvername **names,
+		      double **factor, int *n)
+{
+     char line[512];
+     int nalloc = 0;
+
+     *names = 0; *factor = 0; *n = 0;
+     if (!fgets(line, sizeof(line), f)
+	 || strncmp(line, "(" MODEL_PREAMBLE, strlen("(" MODEL_PREAMBLE))
+	 || !fgets(line, sizeof(line), f)
+	 || sscanf(line, " (weights %lg %lg %lg %lg %lg)",
+		   w, w + 1, w + 2, w + 3, w + 4) != NW)
+	  return 0;
+
+     while (fgets(line, sizeof(line), f)) {
+	  solvername nm;
+	  double x;
+	  if (sscanf(line, " (%127s %d %lg)", nm.name, &nm.id, &x) != 3)
+	       break;
+	  if (*n >= nalloc) {
+	       solvername *nn;
+	       double *nf;
+	       nalloc = 2 * nalloc + 16;
+	       nn = (solvername *) MALLOC(nalloc * sizeof(solvername), OTHER);
+	       nf = (double *) MALLOC(nalloc * sizeof(double), OTHER);
+	       if (*n) {
+		    memcpy(nn, *names, *n * sizeof(solvername));
+		    memcpy(nf, *factor, *n * sizeof(double));
+	       }
+	       X(ifree0)(*names);
+	       X(ifree0)(*factor);
+	       *names = nn;
+	       *factor = nf;
+	  }
+	  (*names)[*n] = nm;
+	  (*factor)[*n] = x;
+	  ++*n;
+     }
+     return !ferror(f) && line[0] == ')';
+}
+
+int X(import_cost_model_from_filename)(const char *filename)
+{
+     planner *plnr = X(the_planner)();
+     solvername *names;
+     double w[NW], *factor;
+     costmodel *m;
+     unsigned i;
+     int n, s, ok;
+     FILE *f;
+
+     if (!filename) {
+	  drop_model();
+	  return 1;
+     }
+     if (!(f = fopen(filename, "r")))
+	  return 0; /* error opening file */
+     ok = read_model(f, w, &names, &factor, &n);
+     fclose(f);
+     if (!ok) {
+	  X(ifree0)(names);
+	  X(ifree0)(factor);
+	  return 0;
+     }
+
+     m = (costmodel *) MALLOC(sizeof(costmodel), OTHER);
+     m->w.add = w[0]; m->w.mul = w[1]; m->w.fma = w[2]; m->w.other = w[3];
+     m->call = w[4];
+     m->nfactor = plnr->nslvdesc;
+     m->factor = (double *) MALLOC((m->nfactor + 1) * sizeof(double), OTHER);
+     /* solvers that this configuration lacks are ignored */
+     for (i = 0; i < m->nfactor; ++i) {
+	  m->factor[i] = 1.0;
+	  for (s = 0; s < n; ++s)
+	       if (plnr->slvdescs[i].reg_id == names[s].id
+		   && !strcmp(plnr->slvdescs[i].reg_nam, names[s].name))
+		    m->factor[i] = factor[s];
+     }
+     X(ifree0)(names);
+     X(ifree0)(factor);
+
+     drop_model();
+     model = m;
+     X(cost_model) = model;
+     return 1;
+}
+
+/*************************************************************
+ * Checking the model
+ *************************************************************/
+
+/* The median relative error, |log(predicted / measured)|, of the own
+   times of the plans in LOG_FILENAME as priced by the model in
+   MODEL_FILENAME (MODEL_ERR), and as priced by the operation count
+   alone, at the one scale that fits this log best (OPCNT_ERR).  Plans
+   without own operations are left out of both. */
+int X(cost_model_error)(const char *model_filename, const char *log_filename,
+			double *model_err, double *opcnt_err)
+{
+     FILE *f;
+     sample *smp = 0;
+     solvername *names = 0, *lnames = 0;
+     double w[NW], *factor = 0, *r = 0, *lfactor = 0;
+     static const double ones[4] = { 1, 1, 1, 1 };
+     double scale;
+     int n, nnames, nlnames, i, s, m, ok = 0;
+
+     if (!(f = fopen(model_filename, "r")))
+	  return 0;
+     ok = read_model(f, w, &names, &factor, &nnames);
+     fclose(f);
+     if (!ok || !(f = fopen(log_filename, "r")))
+	  goto done;
+     ok = read_log(f, &smp, &n, &lnames, &nlnames) && n > 0;
+     fclose(f);
+     if (!ok)
+	  goto done;
+
+     /* the factors in the order of the solver names of the log */
+     lfactor = (double *) MALLOC(nlnames * sizeof(double), OTHER);
+     for (i = 0; i < nlnames; ++i) {
+	  lfactor[i] = 1.0;
+	  for (s = 0; s < nnames; ++s)
+	       if (lnames[i].id == names[s].id
+		   && !strcmp(lnames[i].name, names[s].name))
+		    lfactor[i] = factor[s];
+     }
+     fit_paces(smp, n, w);
+
+     r = (double *) MALLOC(n * sizeof(double), OTHER);
+     for (i = m = 0; i < n; ++i)
+	  if (weigh(ones, smp[i].x) > 0)
+	       r[m++] = smp[i].t / weigh(ones, smp[i].x);
+     if (!(ok = m > 0))
+	  goto done;
+     scale = median(r, m);
+     for (i = m = 0; i < n; ++i)
+	  if (weigh(ones, smp[i].x) > 0)
+	       r[m++] = fabs(log(scale * weigh(ones, smp[i].x) / smp[i].t));
+     *opcnt_err = median(r, m);
+
+     for (i = m = 0; i < n; ++i)
+	  if (weigh(ones, smp[i].x) > 0)
+	       r[m++] = fabs(log(weigh_own(w, smp + i) * lfactor[smp[i].s]
+				 * smp[i].pace / smp[i].t));
+     *model_err = median(r, m);
+
+ done:
+     X(ifree0)(r);
+     X(ifree0)(lfactor);
+     X(ifree0)(smp);
+     X(ifree0)(lnames);
+     X(ifree0)(names);
+     X(ifree0)(factor);
+     return ok;
+}
+
+void X(cost_model_cleanup)(void)
+{
+     X(record_measurements_to_filename)(0);
+     drop_model();
+}
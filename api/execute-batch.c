@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* One plan over many arrays, each pair of which has the alignment and
+   strides of those of the plan, as for the new-array execute functions.
+   The arrays are split in contiguous ranges among the threads that the
+   plan was made for but does not use itself (a plan too small to be
+   threaded gets them all), through X(batch_hook), so that each thread
+   runs the plan back to back with its twiddles in cache. */
+
+#include "api/api.h"
+#include "dft/dft.h"
+#include "rdft/rdft.h"
+
+void (*X(batch_hook))(int n, int nthr,
+		      void (*f)(void *data, int lo, int hi), void *data) = 0;
+
+typedef struct {
+     const apiplan *p;
+     const void *in, *out;	/* arrays of pointers */
+     void (*apply1)(const apiplan *p, const void *in, const void *out,
+		    int i);
+} batch;
+
+static void run_range(void *data, int lo, int hi)
+{
+     const batch *b = (const batch *) data;
+     int i;
+
+     for (i = lo; i < hi; ++i)
+	  b->apply1(b->p, b->in, b->out, i);
+}
+
+static void run(const apiplan *p, int howmany, const void *in,
+		const void *out,
+		void (*apply1)(const apiplan *p, const void *in,
+			       const void *out, int i))
+{
+     batch b;
+     int nthr;
+
+     if (howmany <= 0)
+	  return;
+     b.p = p;
+     b.in = in;
+     b.out = out;
+     b.apply1 = apply1;
+     nthr = X(imin)(howmany, X(imax)(1, p->nthr / p->pln->nthr));
+
+     WITH_PLAN_POOL(p, {
+	  if (nthr > 1 && X(batch_hook))
+	       X(batch_hook)(howmany, nthr, run_range, &b);
+	  else
+	       run_range(&b, 0, howmany);
+     });
+}
+
+static void dft1(const apiplan *p, const void *in_, const void *out_, int i)
+{
+     plan_dft *pln = (plan_dft *) p->pln;
+     C *in = ((C * const *) in_)[i], *out = ((C * const *) out_)[i];
+
+     if (p->sign == FFT_SIGN)
+	  pln->apply((plan *) pln, in[0], in[0]+1, out[0], out[0]+1);
+     else
+	  pln->apply((plan *) pln, in[0]+1, in[0], out[0]+1, out[0]);
+}
+
+void X(execute_dft_batch)(const X(plan) p, int howmany,
+			  C * const *in, C * const *out)
+{
+     run(p, howmany, in, out, dft1);
+}
+
+static void r2c1(const apiplan *p, const void *in_, const void *out_, int i)
+{
+     plan_rdft2 *pln = (plan_rdft2 *) p->pln;
+     problem_rdft2 *prb = (problem_rdft2 *) p->prb;
+     R *in = ((R * const *) in_)[i];
+     C *out = ((C * const *) out_)[i];
+
+     pln->apply((plan *) pln, in, in + (prb->r1 - prb->r0), out[0], out[0]+1);
+}
+
+void X(execute_dft_r2c_batch)(const X(plan) p, int howmany,
+			      R * const *in, C * const *out)
+{
+     run(p, howmany, in, out, r2c1);
+}
+
+static void c2r1(const apiplan *p, const void *in_, const void *out_, int i)
+{
+     plan_rdft2 *pln = (plan_rdft2 *) p->pln;
+     problem_rdft2 *prb = (problem_rdft2 *) p->prb;
+     C *in = ((C * const *) in_)[i];
+     R *out = ((R * const *) out_)[i];
+
+     pln->apply((plan *) pln, out, out + (prb->r1 - prb->r0), in[0], in[0]+1);
+}
+
+void X(execute_dft_c2r_batch)(const X(plan) p, int howmany,
+			      C * const *in, R * const *out)
+{
+     run(p, howmany, in, out, c2r1);
+}
+
+static void r2r1(const apiplan *p, const void *in_, const void *out_, int i)
+{
+     plan_rdft *pln = (plan_rdft *) p->pln;
+     pln->apply((plan *) pln, ((R * const *) in_)[i], ((R * const *) out_)[i]);
+}
+
+void X(execute_r2r_batch)(const X(plan) p, int howmany,
+			  R * const *in, R * const *out)
+{
+     run(p, howmany, in, out, r2r1);
+}
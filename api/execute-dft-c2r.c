@@ -26,5 +26,6 @@ void X(execute_dft_c2r)(const X(plan) p, C *in, R *out)
 {
      plan_rdft2 *pln = (plan_rdft2 *) p->pln;
      problem_rdft2 *prb = (problem_rdft2 *) p->prb;
-     pln->apply((plan *) pln, out, out + (prb->r1 - prb->r0), in[0], in[0]+1);
+     WITH_PLAN_POOL(p, pln->apply((plan *) pln, out,
+				  out + (prb->r1 - prb->r0), in[0], in[0]+1));
 }
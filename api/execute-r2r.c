@@ -25,5 +25,5 @@
 void X(execute_r2r)(const X(plan) p, R *in, R *out)
 {
      plan_rdft *pln = (plan_rdft *) p->pln;
-     pln->apply((plan *) pln, in, out);
+     WITH_PLAN_POOL(p, pln->apply((plan *) pln, in, out));
 }
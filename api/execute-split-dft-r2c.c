@@ -26,5 +26,6 @@ void X(execute_split_dft_r2c)(const X(plan) p, R *in, R *ro, R *io)
 {
      plan_rdft2 *pln = (plan_rdft2 *) p->pln;
      problem_rdft2 *prb = (problem_rdft2 *) p->prb;
-     pln->apply((plan *) pln, in, in + (prb->r1 - prb->r0), ro, io);
+     WITH_PLAN_POOL(p, pln->apply((plan *) pln, in,
+				  in + (prb->r1 - prb->r0), ro, io));
 }
@@ -25,5 +25,5 @@
 void X(execute_split_dft)(const X(plan) p, R *ri, R *ii, R *ro, R *io)
 {
      plan_dft *pln = (plan_dft *) p->pln;
-     pln->apply((plan *) pln, ri, ii, ro, io);
+     WITH_PLAN_POOL(p, pln->apply((plan *) pln, ri, ii, ro, io));
 }
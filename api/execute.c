@@ -20,8 +20,12 @@
 
 #include "api/api.h"
 
+struct X(threadpool_s) *(*X(threadpool_enter_hook))(
+     struct X(threadpool_s) *pool) = 0;
+void (*X(threadpool_leave_hook))(struct X(threadpool_s) *prev) = 0;
+
 void X(execute)(const X(plan) p)
 {
      plan *pln = p->pln;
-     pln->adt->solve(pln, p->prb);
+     WITH_PLAN_POOL(p, pln->adt->solve(pln, p->prb));
 }
@@ -130,6 +130,10 @@ FFTW_DEFINE_COMPLEX(R, C);                                              \
                                                                         \
 typedef struct X(plan_s) *X(plan);                                      \
                                                                         \
+typedef struct X(threadpool_s) *X(threadpool);                          \
+                                                                        \
+typedef struct X(request_s) *X(request);                                \
+                                                                        \
 typedef struct fftw_iodim_do_not_use_me X(iodim);                       \
 typedef struct fftw_iodim64_do_not_use_me X(iodim64);                   \
                                                                         \
@@ -196,6 +200,10 @@ FFTW_EXTERN void                                                        \
 FFTW_CDECL X(execute_dft)(const X(plan) p, C *in, C *out);              \
                                                                         \
 FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_dft_batch)(const X(plan) p, int howmany,           \
+                                C * const *in, C * const *out);         \
+                                                                        \
+FFTW_EXTERN void                                                        \
 FFTW_CDECL X(execute_split_dft)(const X(plan) p, R *ri, R *ii,          \
                                       R *ro, R *io);                    \
                                                                         \
@@ -313,6 +321,14 @@ FFTW_EXTERN void                                                        \
 FFTW_CDECL X(execute_dft_c2r)(const X(plan) p, C *in, R *out);          \
                                                                         \
 FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_dft_r2c_batch)(const X(plan) p, int howmany,       \
+                                    R * const *in, C * const *out);     \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_dft_c2r_batch)(const X(plan) p, int howmany,       \
+                                    C * const *in, R * const *out);     \
+                                                                        \
+FFTW_EXTERN void                                                        \
 FFTW_CDECL X(execute_split_dft_r2c)(const X(plan) p,                    \
                                     R *in, R *ro, R *io);               \
                                                                         \
@@ -366,6 +382,10 @@ FFTW_EXTERN void                                                        \
 FFTW_CDECL X(execute_r2r)(const X(plan) p, R *in, R *out);              \
                                                                         \
 FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_r2r_batch)(const X(plan) p, int howmany,           \
+                                R * const *in, R * const *out);         \
+                                                                        \
+FFTW_EXTERN void                                                        \
 FFTW_CDECL X(destroy_plan)(X(plan) p);                                  \
                                                                         \
 FFTW_EXTERN void                                                        \
@@ -377,11 +397,23 @@ FFTW_EXTERN void                                                        \
 FFTW_CDECL X(set_timelimit)(double t);                                  \
                                                                         \
 FFTW_EXTERN void                                                        \
+FFTW_CDECL X(set_robust_timing)(int robust);                            \
+                                                                        \
+FFTW_EXTERN void                                                        \
 FFTW_CDECL X(plan_with_nthreads)(int nthreads);                         \
                                                                         \
 FFTW_EXTERN int                                                         \
 FFTW_CDECL X(planner_nthreads)(void);                                   \
                                                                         \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_with_work_stealing)(int nchunk);                      \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_with_measure_threads)(int nthreads);                  \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(planner_measure_threads)(void);                            \
+                                                                        \
 FFTW_EXTERN int                                                         \
 FFTW_CDECL X(init_threads)(void);                                       \
                                                                         \
@@ -394,9 +426,78 @@ FFTW_CDECL X(threads_set_callback)(                                     \
      char *jobdata, size_t elsize, int njobs, void *data), void *data); \
                                                                         \
 FFTW_EXTERN void                                                        \
+FFTW_CDECL X(threads_set_spin)(double seconds);                         \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(set_scratch_pool)(size_t bytes);                           \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(scratch_pool_stats)(size_t *bytes, size_t *peak,           \
+                              double *hits, double *misses,             \
+                              double *trimmed);                         \
+                                                                        \
+FFTW_EXTERN X(threadpool)                                               \
+FFTW_CDECL X(threadpool_create)(int nthreads,                           \
+                                const int *cpus, int ncpus);            \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(threadpool_destroy)(X(threadpool) pool);                   \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(threadpool_nthreads)(const X(threadpool) pool);            \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_set_threadpool)(X(plan) p, X(threadpool) pool);       \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_in_threadpool)(const X(plan) p,                    \
+                                    X(threadpool) pool);                \
+                                                                        \
+FFTW_EXTERN X(request)                                                  \
+FFTW_CDECL X(execute_async)(const X(plan) p,                            \
+                            void (*done)(void *arg), void *arg);        \
+                                                                        \
+FFTW_EXTERN X(request)                                                  \
+FFTW_CDECL X(execute_dft_async)(const X(plan) p, C *in, C *out,         \
+                                void (*done)(void *arg), void *arg);    \
+                                                                        \
+FFTW_EXTERN X(request)                                                  \
+FFTW_CDECL X(execute_dft_r2c_async)(const X(plan) p, R *in, C *out,     \
+                                    void (*done)(void *arg), void *arg);\
+                                                                        \
+FFTW_EXTERN X(request)                                                  \
+FFTW_CDECL X(execute_dft_c2r_async)(const X(plan) p, C *in, R *out,     \
+                                    void (*done)(void *arg), void *arg);\
+                                                                        \
+FFTW_EXTERN X(request)                                                  \
+FFTW_CDECL X(execute_r2r_async)(const X(plan) p, R *in, R *out,         \
+                                void (*done)(void *arg), void *arg);    \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(request_test)(X(request) r);                               \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(request_wait)(X(request) r);                               \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(threads_set_max_workers)(int nworkers);                    \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(threads_set_affinity)(const int *cpus, int ncpus);         \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(threads_node_cpus)(int node, int *cpus, int maxcpus);      \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(threads_calibrate)(void);                                  \
+                                                                        \
+FFTW_EXTERN void                                                        \
 FFTW_CDECL X(make_planner_thread_safe)(void);                           \
                                                                         \
 FFTW_EXTERN int                                                         \
+FFTW_CDECL X(make_planner_concurrent)(void);                            \
+                                                                        \
+FFTW_EXTERN int                                                         \
 FFTW_CDECL X(export_wisdom_to_filename)(const char *filename);          \
                                                                         \
 FFTW_EXTERN void                                                        \
@@ -423,6 +524,33 @@ FFTW_CDECL X(import_wisdom_from_string)(const char *input_string);      \
 FFTW_EXTERN int                                                         \
 FFTW_CDECL X(import_wisdom)(X(read_char_func) read_char, void *data);   \
                                                                         \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(export_wisdom_to_binary_filename)(const char *filename);   \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(import_wisdom_from_binary_filename)(const char *filename); \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(attach_shared_wisdom)(const char *filename,                \
+                                  int nsolutions);                      \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(record_measurements_to_filename)(const char *filename);    \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(fit_cost_model)(const char *log_filename,                  \
+                            const char *model_filename);                \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(import_cost_model_from_filename)(const char *filename);    \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(set_plan_cache)(size_t bytes);                             \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_cache_stats)(size_t *bytes, int *nplans,              \
+                              double *hits, double *misses);            \
+                                                                        \
 FFTW_EXTERN void                                                        \
 FFTW_CDECL X(fprint_plan)(const X(plan) p, FILE *output_file);          \
                                                                         \
@@ -435,6 +563,9 @@ FFTW_CDECL X(sprint_plan)(const X(plan) p);                             \
 FFTW_EXTERN void *                                                      \
 FFTW_CDECL X(malloc)(size_t n);                                         \
                                                                         \
+FFTW_EXTERN void *                                                      \
+FFTW_CDECL X(malloc_huge)(size_t n);                                    \
+                                                                        \
 FFTW_EXTERN R *                                                         \
 FFTW_CDECL X(alloc_real)(size_t n);                                     \
 FFTW_EXTERN C *                                                         \
@@ -453,6 +584,14 @@ FFTW_EXTERN double                                                      \
 FFTW_CDECL X(cost)(const X(plan) p);                                    \
                                                                         \
 FFTW_EXTERN int                                                         \
+FFTW_CDECL X(plan_nthreads)(const X(plan) p);                           \
+                                                                        \
+FFTW_EXTERN size_t                                                      \
+FFTW_CDECL X(plan_scratch_size)(const X(plan) p);                       \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_set_scratch)(X(plan) p, void *scratch);               \
+                                                                        \
+FFTW_EXTERN int                                                         \
 FFTW_CDECL X(alignment_of)(R *p);                                       \
                                                                         \
 FFTW_EXTERN const char X(version)[];                                    \
@@ -498,6 +637,8 @@ FFTW_DEFINE_API(FFTW_MANGLE_QUAD, __float128, fftwq_complex)
 #define FFTW_PATIENT (1U << 5) /* IMPATIENT is default */
 #define FFTW_ESTIMATE (1U << 6)
 #define FFTW_WISDOM_ONLY (1U << 21)
+#define FFTW_HUGE_PAGES (1U << 22)
+#define FFTW_REALTIME (1U << 23)
 
 /* undocumented beyond-guru flags */
 #define FFTW_ESTIMATE_PATIENT (1U << 7)
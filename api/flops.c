@@ -41,3 +41,9 @@ double X(cost)(const X(plan) p)
 {
      return p->pln->pcost;
 }
+
+/* threads that P runs on, at most */
+int X(plan_nthreads)(const X(plan) p)
+{
+     return p->pln->nthr;
+}
@@ -26,6 +26,13 @@ void *X(malloc)(size_t n)
      return X(kernel_malloc)(n);
 }
 
+/* for large arrays: on huge pages where the system has them, which
+   X(free) frees like any other */
+void *X(malloc_huge)(size_t n)
+{
+     return X(kernel_malloc_huge)(n);
+}
+
 void X(free)(void *p)
 {
      X(kernel_free)(p);
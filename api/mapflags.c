@@ -110,7 +110,6 @@ void X(mapflags)(planner *plnr, unsigned flags)
 		  YES(FFTW_NO_VRECURSE
 		      | FFTW_NO_RANK_SPLITS
 		      | FFTW_NO_VRANK_SPLITS
-		      | FFTW_NO_NONTHREADED
 		      | FFTW_NO_DFT_R2HC
 		      | FFTW_NO_FIXED_RADIX_LARGE_N
 		      | FFTW_BELIEVE_PCOST))
@@ -146,6 +145,12 @@ void X(mapflags)(planner *plnr, unsigned flags)
 
      map_flags(&flags, &flags, self_flagmap, NELEM(self_flagmap));
 
+     /* below FFTW_PATIENT, threaded plans are preferred to serial ones,
+	except in FFTW_ESTIMATE, where the cost model of the threads
+	decides */
+     if (!(flags & (FFTW_PATIENT | FFTW_ESTIMATE)))
+	  flags |= FFTW_NO_NONTHREADED;
+
      l = u = 0;
      map_flags(&flags, &l, l_flagmap, NELEM(l_flagmap));
      map_flags(&flags, &u, u_flagmap, NELEM(u_flagmap));
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Plan cache.  While X(set_plan_cache) gives it a budget, X(mkapiplan)
+   looks up every plan it is asked for by the signature of the problem
+   (which covers its shape, strides, in-placeness and alignment), the
+   sign and the flags.  Plans for the same key share one kernel plan,
+   woken once; each X(plan) keeps only its own problem, which holds the
+   arrays that X(execute) uses.  The kernel plan is destroyed when no
+   X(plan) uses it and the cache is over budget, least recently used
+   first.
+
+   The cache is shared by all threads; LOCK_CACHES guards it while
+   planning concurrently, but not while plans are created or
+   destroyed, which may take the same lock. */
+
+#include "api/api.h"
+
+struct pcentry_s {
+     md5sig key;
+     plan *pln;
+     size_t bytes;		/* estimated footprint of PLN */
+     int refcnt;		/* X(plan)s using PLN */
+     struct pcentry_s *cdr;	/* next in bucket */
+     struct pcentry_s *prev, *next; /* most recently used first */
+};
+
+typedef struct pcentry_s pcentry;
+
+static size_t budget = 0, used = 0;
+static unsigned nbucket = 0, nentry = 0;
+static pcentry **bucket = 0;
+static pcentry *mru = 0, *lru = 0;
+static double nhit = 0, nmiss = 0;
+
+static void key_of(const planner *plnr, unsigned flags, int sign,
+		   const problem *prb, md5sig key)
+{
+     md5 m;
+
+     X(md5begin_fast)(&m);
+     X(md5unsigned)(&m, flags);
+     X(md5int)(&m, sign);
+     X(md5int)(&m, plnr->nthr);
+     if (plnr->nchunk > 1)	/* as the planner's hash does */
+	  X(md5int)(&m, plnr->nchunk);
+     prb->adt->hash(prb, &m);
+     X(md5end)(&m);
+     key[0] = m.s[0]; key[1] = m.s[1]; key[2] = m.s[2]; key[3] = m.s[3];
+}
+
+static pcentry **bucket_of(const md5sig key)
+{
+     return bucket + (key[0] & (nbucket - 1));
+}
+
+static pcentry *find(const md5sig key)
+{
+     pcentry *e;
+
+     if (!nbucket)
+	  return 0;
+     for (e = *bucket_of(key); e; e = e->cdr)
+	  if (e->key[0] == key[0] && e->key[1] == key[1]
+	      && e->key[2] == key[2] && e->key[3] == key[3])
+	       return e;
+     return 0;
+}
+
+static void lru_unlink(pcentry *e)
+{
+     if (e->prev) e->prev->next = e->next; else mru = e->next;
+     if (e->next) e->next->prev = e->prev; else lru = e->prev;
+}
+
+static void lru_push(pcentry *e)
+{
+     e->prev = 0;
+     e->next = mru;
+     if (mru) mru->prev = e; else lru = e;
+     mru = e;
+}
+
+static void grow(void)
+{
+     unsigned onbucket = nbucket, i;
+     pcentry **obucket = bucket;
+
+     nbucket = nbucket ? 2 * nbucket : 64;
+     bucket = (pcentry **)MALLOC(nbucket * sizeof(pcentry *), HASHT);
+     for (i = 0; i < nbucket; ++i)
+	  bucket[i] = 0;
+     for (i = 0; i < onbucket; ++i) {
+	  pcentry *e, *next;
+	  for (e = obucket[i]; e; e = next) {
+	       pcentry **b = bucket_of(e->key);
+	       next = e->cdr;
+	       e->cdr = *b;
+	       *b = e;
+	  }
+     }
+     X(ifree0)(obucket);
+}
+
+static void insert(pcentry *e)
+{
+     pcentry **b;
+
+     if (nentry >= nbucket)
+	  grow();
+     b = bucket_of(e->key);
+     e->cdr = *b;
+     *b = e;
+     lru_push(e);
+     ++nentry;
+     used += e->bytes;
+}
+
+static void unlink_entry(pcentry *e)
+{
+     pcentry **q;
+
+     for (q = bucket_of(e->key); *q != e; q = &(*q)->cdr)
+	  ;
+     *q = e->cdr;
+     lru_unlink(e);
+     --nentry;
+     used -= e->bytes;
+}
+
+/* the least recently used entry that no plan uses, unlinked, if the
+   cache is over budget */
+static pcentry *victim(void)
+{
+     pcentry *e;
+
+     if (used <= budget)
+	  return 0;
+     for (e = lru; e; e = e->prev)
+	  if (e->refcnt == 0) {
+	       unlink_entry(e);
+	       return e;
+	  }
+     return 0;
+}
+
+static void destroy_kernel_plan(plan *pln)
+{
+     X(plan_awake)(pln, SLEEPY);
+     X(plan_destroy_internal)(pln);
+}
+
+static void shrink(void)
+{
+     pcentry *e;
+
+     do {
+	  LOCK_CACHES();
+	  e = victim();
+	  UNLOCK_CACHES();
+	  if (e) {
+	       destroy_kernel_plan(e->pln);
+	       X(ifree)(e);
+	  }
+     } while (e);
+}
+
+/* a plan for PRB sharing the cached kernel plan, if any; takes PRB
+   over on success */
+apiplan *X(plan_cache_lookup)(const planner *plnr, unsigned flags, int sign,
+			      problem *prb)
+{
+     md5sig key;
+     pcentry *e;
+     apiplan *p;
+
+     if (!budget)
+	  return 0;
+
+     key_of(plnr, flags, sign, prb, key);
+     LOCK_CACHES();
+     if ((e = find(key))) {
+	  ++e->refcnt;
+	  lru_unlink(e);
+	  lru_push(e);
+	  ++nhit;
+     } else
+	  ++nmiss;
+     UNLOCK_CACHES();
+
+     if (!e)
+	  return 0;
+
+     p = (apiplan *) MALLOC(sizeof(apiplan), OTHER);
+     p->pln = e->pln;
+     p->prb = prb;
+     p->sign = sign;
+     p->cached = e;
+     p->pool = 0;
+     p->nthr = plnr->nthr;
+     p->ws.base = 0;
+     p->ws_own = 0;
+     return p;
+}
+
+/* hand the kernel plan of the new plan P, estimated at BYTES, over to
+   the cache */
+void X(plan_cache_insert)(const planner *plnr, unsigned flags, apiplan *p,
+			  size_t bytes)
+{
+     pcentry *e, *ne;
+
+     if (!budget)
+	  return;
+
+     ne = (pcentry *) MALLOC(sizeof(pcentry), OTHER);
+     key_of(plnr, flags, p->sign, p->prb, ne->key);
+     ne->pln = p->pln;
+     ne->bytes = bytes + sizeof(pcentry);
+     ne->refcnt = 1;
+
+     LOCK_CACHES();
+     if ((e = find(ne->key))) {
+	  /* another thread made the same plan meanwhile: share it */
+	  ++e->refcnt;
+	  lru_unlink(e);
+	  lru_push(e);
+     } else {
+	  insert(ne);
+	  e = ne;
+	  ne = 0;
+     }
+     UNLOCK_CACHES();
+
+     if (ne) {
+	  destroy_kernel_plan(ne->pln);
+	  X(ifree)(ne);
+	  p->pln = e->pln;
+     }
+     p->cached = e;
+     shrink();
+}
+
+void X(plan_cache_release)(apiplan *p)
+{
+     LOCK_CACHES();
+     --p->cached->refcnt;
+     UNLOCK_CACHES();
+     shrink();
+}
+
+void X(set_plan_cache)(size_t bytes)
+{
+     budget = bytes;
+     shrink();
+}
+
+void X(plan_cache_stats)(size_t *bytes, int *nplans, double *hits,
+			 double *misses)
+{
+     LOCK_CACHES();
+     if (bytes) *bytes = used;
+     if (nplans) *nplans = (int) nentry;
+     if (hits) *hits = nhit;
+     if (misses) *misses = nmiss;
+     UNLOCK_CACHES();
+}
+
+void X(plan_cache_cleanup)(void)
+{
+     X(set_plan_cache)(0);
+     if (nentry == 0) {
+	  X(ifree0)(bucket);
+	  bucket = 0;
+	  nbucket = 0;
+     }
+     nhit = nmiss = 0;
+}
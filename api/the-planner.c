@@ -22,9 +22,15 @@
 
 static planner *plnr = 0;
 
+/* set by X(make_planner_concurrent) to give each thread its own planner */
+planner *(*X(the_planner_hook))(void) = 0;
+
 /* create the planner for the rest of the API */
 planner *X(the_planner)(void)
 {
+     if (X(the_planner_hook))
+	  return X(the_planner_hook)();
+
      if (!plnr) {
           plnr = X(mkplanner)();
           X(configure_planner)(plnr);
@@ -35,10 +41,18 @@ planner *X(the_planner)(void)
 
 void X(cleanup)(void)
 {
+     if (X(the_planner_hook)) {
+	  /* thread planners live until X(cleanup_threads), but all of
+	     them share the wisdom */
+	  planner *tp = X(the_planner_hook)();
+	  tp->adt->forget(tp, FORGET_EVERYTHING);
+     }
      if (plnr) {
           X(planner_destroy)(plnr);
           plnr = 0;
      }
+     X(cost_model_cleanup)();
+     X(plan_cache_cleanup)();
 }
 
 void X(set_timelimit)(double tlim) 
@@ -47,3 +61,8 @@ void X(set_timelimit)(double tlim)
 	called, so use X(the_planner)() */
      X(the_planner)()->timelimit = tlim; 
 }
+
+void X(set_robust_timing)(int robust)
+{
+     X(the_planner)()->robust_timing = robust > 1 ? 2 : robust != 0;
+}
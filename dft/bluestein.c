@@ -84,7 +84,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
      const P *ego = (const P *) ego_;
      INT i, n = ego->n, nb = ego->nb, is = ego->is, os = ego->os;
      R *w = ego->w, *W = ego->W;
-     R *b = (R *) MALLOC(2 * nb * sizeof(R), BUFFERS);
+     R *b = (R *) X(scratch_malloc)(2 * nb * sizeof(R));
 
      /* multiply input by conjugate bluestein sequence */
      for (i = 0; i < n; ++i) {
@@ -124,7 +124,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
           io[i*os] = xi * wr - xr * wi;
      }
 
-     X(ifree)(b);	  
+     X(scratch_ifree)(b);	  
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
@@ -227,6 +227,7 @@ static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
      pln->super.super.ops.add += 4 * n + 2 * nb;
      pln->super.super.ops.mul += 8 * n + 4 * nb;
      pln->super.super.ops.other += 6 * (n + nb);
+     pln->super.super.scratch = SCRATCH_SIZE(2 * nb * sizeof(R));
 
      return &(pln->super.super);
 
@@ -104,8 +104,8 @@ static void dobatch(const P *ego, INT mb, INT me, R *buf, R *rio, R *iio)
 static void apply(const plan *ego_, R *rio, R *iio)
 {
      const P *ego = (const P *) ego_;
-     R *buf = (R *) MALLOC(sizeof(R) * 2 * BATCHDIST(ego->r) * ego->batchsz,
-			   BUFFERS);
+     R *buf = (R *) X(scratch_malloc)(sizeof(R) * 2 * BATCHDIST(ego->r)
+				      * ego->batchsz);
      INT m;
 
      for (m = ego->mb; m < ego->me; m += ego->batchsz)
@@ -113,7 +113,7 @@ static void apply(const plan *ego_, R *rio, R *iio)
 
      A(m == ego->me);
 
-     X(ifree)(buf);
+     X(scratch_ifree)(buf);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
@@ -198,6 +198,8 @@ static plan *mkcldw(const ct_solver *ego_,
 	  pln->super.super.ops.add += 4 * n0;
 	  pln->super.super.ops.other += 8 * n0;
      }
+     pln->super.super.scratch =
+	  SCRATCH_SIZE(sizeof(R) * 2 * BATCHDIST(r) * ego->batchsz);
      return &(pln->super.super);
 
  nada:
@@ -152,6 +152,7 @@ static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
 #if 0 /* these are nice pipelined sequential loads and should cost nothing */
      pln->super.super.ops.other = (n-1)*(4 + 1 + 2 * (n-1));  /* approximate */
 #endif
+     pln->super.super.scratch = BUF_SCRATCH(n * 2 * sizeof(E));
 
      return &(pln->super.super);
 }
@@ -26,7 +26,7 @@ static void destroy(problem *ego_)
 {
      problem_dft *ego = (problem_dft *) ego_;
      X(tensor_destroy2)(ego->vecsz, ego->sz);
-     X(ifree)(ego_);
+     X(arena_ifree)(ego_);
 }
 
 static void hash(const problem *p_, md5 *m)
@@ -65,13 +65,26 @@ static void zero(const problem *ego_)
      X(tensor_destroy)(sz);
 }
 
+static problem *clone_io(const problem *ego_, R **buf)
+{
+     const problem_dft *ego = (const problem_dft *) ego_;
+     R *in[4], *out[4];
+     tensor *sz = X(tensor_append)(ego->vecsz, ego->sz);
+     in[0] = ego->ri; in[1] = ego->ii; in[2] = ego->ro; in[3] = ego->io;
+     *buf = X(problem_clone_arrays)(4, in, out, sz);
+     X(tensor_destroy)(sz);
+     return X(mkproblem_dft)(ego->sz, ego->vecsz, 
+			     out[0], out[1], out[2], out[3]);
+}
+
 static const problem_adt padt =
 {
      PROBLEM_DFT,
      hash,
      zero,
      print,
-     destroy
+     destroy,
+     clone_io
 };
 
 problem *X(mkproblem_dft)(const tensor *sz, const tensor *vecsz,
@@ -45,14 +45,19 @@ static rader_tl *omegas = 0;
 static R *mkomega(enum wakefulness wakefulness, plan *p_, INT n, INT ginv)
 {
      plan_dft *p = (plan_dft *) p_;
-     R *omega;
+     R *omega, *mine;
      INT i, gpower;
      trigreal scale;
      triggen *t;
 
-     if ((omega = X(rader_tl_find)(n, n, ginv, omegas)))
+     LOCK_CACHES();
+     omega = X(rader_tl_find)(n, n, ginv, wakefulness, omegas);
+     UNLOCK_CACHES();
+     if (omega)
 	  return omega;
 
+     /* computed without the lock, which would otherwise serialize every
+	planner waking a Rader plan behind this transform */
      omega = (R *)MALLOC(sizeof(R) * (n - 1) * 2, TWIDDLES);
 
      scale = n - 1.0; /* normalization for convolution */
@@ -69,13 +74,21 @@ static R *mkomega(enum wakefulness wakefulness, plan *p_, INT n, INT ginv)
 
      p->apply(p_, omega, omega + 1, omega, omega + 1);
 
-     X(rader_tl_insert)(n, n, ginv, omega, &omegas);
+     mine = omega;
+     LOCK_CACHES();
+     if ((omega = X(rader_tl_find)(n, n, ginv, wakefulness, omegas)))
+	  X(ifree)(mine);	/* another thread made it meanwhile */
+     else
+	  X(rader_tl_insert)(n, n, ginv, wakefulness, omega = mine, &omegas);
+     UNLOCK_CACHES();
      return omega;
 }
 
 static void free_omega(R *omega)
 {
+     LOCK_CACHES();
      X(rader_tl_delete)(omega, &omegas);
+     UNLOCK_CACHES();
 }
 
 
@@ -101,7 +114,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
      R r0 = ri[0], i0 = ii[0];
 
      r = ego->n; is = ego->is; os = ego->os; g = ego->g; 
-     buf = (R *) MALLOC(sizeof(R) * (r - 1) * 2, BUFFERS);
+     buf = (R *) X(scratch_malloc)(sizeof(R) * (r - 1) * 2);
 
      /* First, permute the input, storing in buf: */
      for (gpower = 1, k = 0; k < r - 1; ++k, gpower = MULMOD(gpower, g, r)) {
@@ -161,7 +174,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
      }
 
 
-     X(ifree)(buf);
+     X(scratch_ifree)(buf);
 }
 
 /***************************************************************************/
@@ -277,6 +290,7 @@ static int mkP(P *pln, INT n, INT is, INT os, R *ro, R *io,
      pln->super.super.ops.other += (n - 1) * (4 * 2 + 6) + 6;
      pln->super.super.ops.add += (n - 1) * 2 + 4;
      pln->super.super.ops.mul += (n - 1) * 4;
+     pln->super.super.scratch = SCRATCH_SIZE(sizeof(R) * (n - 1) * 2);
 
      return 1;
 
@@ -308,7 +322,7 @@ static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
 
      pln = MKPLAN_DFT(P, &padt, apply);
      if (!mkP(pln, n, is, os, p->ro, p->io, plnr)) {
-	  X(ifree)(pln);
+	  X(arena_ifree)(pln);
 	  return (plan *) 0;
      }
      return &(pln->super.super);
@@ -186,7 +186,7 @@ static void n1_10(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 10, "n1_10", { 48, 0, 36, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 10, "n1_10", { 48, 0, 36, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_10) (planner *p) { X(kdft_register) (p, n1_10, &desc);
 }
@@ -354,7 +354,7 @@ static void n1_10(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 10, "n1_10", { 72, 12, 12, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 10, "n1_10", { 72, 12, 12, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_10) (planner *p) { X(kdft_register) (p, n1_10, &desc);
 }
@@ -267,7 +267,7 @@ static void n1_11(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 11, "n1_11", { 30, 0, 110, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 11, "n1_11", { 30, 0, 110, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_11) (planner *p) { X(kdft_register) (p, n1_11, &desc);
 }
@@ -418,7 +418,7 @@ static void n1_11(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 11, "n1_11", { 60, 20, 80, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 11, "n1_11", { 60, 20, 80, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_11) (planner *p) { X(kdft_register) (p, n1_11, &desc);
 }
@@ -215,7 +215,7 @@ static void n1_12(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 12, "n1_12", { 72, 0, 24, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 12, "n1_12", { 72, 0, 24, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_12) (planner *p) { X(kdft_register) (p, n1_12, &desc);
 }
@@ -412,7 +412,7 @@ static void n1_12(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 12, "n1_12", { 88, 8, 8, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 12, "n1_12", { 88, 8, 8, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_12) (planner *p) { X(kdft_register) (p, n1_12, &desc);
 }
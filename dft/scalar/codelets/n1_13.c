@@ -348,7 +348,7 @@ static void n1_13(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 13, "n1_13", { 62, 0, 114, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 13, "n1_13", { 62, 0, 114, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_13) (planner *p) { X(kdft_register) (p, n1_13, &desc);
 }
@@ -673,7 +673,7 @@ static void n1_13(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 13, "n1_13", { 138, 30, 38, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 13, "n1_13", { 138, 30, 38, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_13) (planner *p) { X(kdft_register) (p, n1_13, &desc);
 }
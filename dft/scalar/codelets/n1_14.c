@@ -283,7 +283,7 @@ static void n1_14(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 14, "n1_14", { 64, 0, 84, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 14, "n1_14", { 64, 0, 84, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_14) (planner *p) { X(kdft_register) (p, n1_14, &desc);
 }
@@ -505,7 +505,7 @@ static void n1_14(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 14, "n1_14", { 100, 24, 48, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 14, "n1_14", { 100, 24, 48, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_14) (planner *p) { X(kdft_register) (p, n1_14, &desc);
 }
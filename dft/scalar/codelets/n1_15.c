@@ -282,7 +282,7 @@ static void n1_15(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 15, "n1_15", { 72, 0, 84, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 15, "n1_15", { 72, 0, 84, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_15) (planner *p) { X(kdft_register) (p, n1_15, &desc);
 }
@@ -546,7 +546,7 @@ static void n1_15(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 15, "n1_15", { 128, 28, 28, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 15, "n1_15", { 128, 28, 28, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_15) (planner *p) { X(kdft_register) (p, n1_15, &desc);
 }
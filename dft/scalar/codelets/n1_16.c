@@ -285,7 +285,7 @@ static void n1_16(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 16, "n1_16", { 104, 0, 40, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 16, "n1_16", { 104, 0, 40, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_16) (planner *p) { X(kdft_register) (p, n1_16, &desc);
 }
@@ -552,7 +552,7 @@ static void n1_16(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 16, "n1_16", { 136, 16, 8, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 16, "n1_16", { 136, 16, 8, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_16) (planner *p) { X(kdft_register) (p, n1_16, &desc);
 }
@@ -52,7 +52,7 @@ static void n1_2(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 2, "n1_2", { 4, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 2, "n1_2", { 4, 0, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_2) (planner *p) { X(kdft_register) (p, n1_2, &desc);
 }
@@ -86,7 +86,7 @@ static void n1_2(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 2, "n1_2", { 4, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 2, "n1_2", { 4, 0, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_2) (planner *p) { X(kdft_register) (p, n1_2, &desc);
 }
@@ -364,7 +364,7 @@ static void n1_20(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 20, "n1_20", { 136, 0, 72, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 20, "n1_20", { 136, 0, 72, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_20) (planner *p) { X(kdft_register) (p, n1_20, &desc);
 }
@@ -710,7 +710,7 @@ static void n1_20(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 20, "n1_20", { 184, 24, 24, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 20, "n1_20", { 184, 24, 24, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_20) (planner *p) { X(kdft_register) (p, n1_20, &desc);
 }
@@ -630,7 +630,7 @@ static void n1_25(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 25, "n1_25", { 84, 0, 268, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 25, "n1_25", { 84, 0, 268, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_25) (planner *p) { X(kdft_register) (p, n1_25, &desc);
 }
@@ -1215,7 +1215,7 @@ static void n1_25(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 25, "n1_25", { 260, 92, 92, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 25, "n1_25", { 260, 92, 92, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_25) (planner *p) { X(kdft_register) (p, n1_25, &desc);
 }
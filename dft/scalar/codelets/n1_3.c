@@ -67,7 +67,7 @@ static void n1_3(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 3, "n1_3", { 6, 0, 6, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 3, "n1_3", { 6, 0, 6, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_3) (planner *p) { X(kdft_register) (p, n1_3, &desc);
 }
@@ -116,7 +116,7 @@ static void n1_3(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 3, "n1_3", { 10, 2, 2, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 3, "n1_3", { 10, 2, 2, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_3) (planner *p) { X(kdft_register) (p, n1_3, &desc);
 }
@@ -664,7 +664,7 @@ static void n1_32(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 32, "n1_32", { 236, 0, 136, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 32, "n1_32", { 236, 0, 136, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_32) (planner *p) { X(kdft_register) (p, n1_32, &desc);
 }
@@ -1310,7 +1310,7 @@ static void n1_32(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 32, "n1_32", { 340, 52, 32, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 32, "n1_32", { 340, 52, 32, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_32) (planner *p) { X(kdft_register) (p, n1_32, &desc);
 }
@@ -74,7 +74,7 @@ static void n1_4(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 4, "n1_4", { 16, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 4, "n1_4", { 16, 0, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_4) (planner *p) { X(kdft_register) (p, n1_4, &desc);
 }
@@ -130,7 +130,7 @@ static void n1_4(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 4, "n1_4", { 16, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 4, "n1_4", { 16, 0, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_4) (planner *p) { X(kdft_register) (p, n1_4, &desc);
 }
@@ -102,7 +102,7 @@ static void n1_5(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 5, "n1_5", { 14, 0, 18, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 5, "n1_5", { 14, 0, 18, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_5) (planner *p) { X(kdft_register) (p, n1_5, &desc);
 }
@@ -186,7 +186,7 @@ static void n1_5(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 5, "n1_5", { 26, 6, 6, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 5, "n1_5", { 26, 6, 6, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_5) (planner *p) { X(kdft_register) (p, n1_5, &desc);
 }
@@ -110,7 +110,7 @@ static void n1_6(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 6, "n1_6", { 24, 0, 12, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 6, "n1_6", { 24, 0, 12, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_6) (planner *p) { X(kdft_register) (p, n1_6, &desc);
 }
@@ -202,7 +202,7 @@ static void n1_6(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 6, "n1_6", { 32, 4, 4, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 6, "n1_6", { 32, 4, 4, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_6) (planner *p) { X(kdft_register) (p, n1_6, &desc);
 }
@@ -1548,7 +1548,7 @@ static void n1_64(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 64, "n1_64", { 520, 0, 392, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 64, "n1_64", { 520, 0, 392, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_64) (planner *p) { X(kdft_register) (p, n1_64, &desc);
 }
@@ -3078,7 +3078,7 @@ static void n1_64(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      }
 }
 
-static const kdft_desc desc = { 64, "n1_64", { 808, 144, 104, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 64, "n1_64", { 808, 144, 104, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_64) (planner *p) { X(kdft_register) (p, n1_64, &desc);
 }
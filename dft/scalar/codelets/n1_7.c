@@ -139,7 +139,7 @@ static void n1_7(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 7, "n1_7", { 18, 0, 42, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 7, "n1_7", { 18, 0, 42, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_7) (planner *p) { X(kdft_register) (p, n1_7, &desc);
 }
@@ -241,7 +241,7 @@ static void n1_7(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 7, "n1_7", { 36, 12, 24, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 7, "n1_7", { 36, 12, 24, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_7) (planner *p) { X(kdft_register) (p, n1_7, &desc);
 }
@@ -138,7 +138,7 @@ static void n1_8(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 8, "n1_8", { 44, 0, 8, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 8, "n1_8", { 44, 0, 8, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_8) (planner *p) { X(kdft_register) (p, n1_8, &desc);
 }
@@ -258,7 +258,7 @@ static void n1_8(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 8, "n1_8", { 52, 4, 0, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 8, "n1_8", { 52, 4, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_8) (planner *p) { X(kdft_register) (p, n1_8, &desc);
 }
@@ -186,7 +186,7 @@ static void n1_9(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 9, "n1_9", { 24, 0, 56, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 9, "n1_9", { 24, 0, 56, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_9) (planner *p) { X(kdft_register) (p, n1_9, &desc);
 }
@@ -352,7 +352,7 @@ static void n1_9(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, I
      }
 }
 
-static const kdft_desc desc = { 9, "n1_9", { 60, 20, 20, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 9, "n1_9", { 60, 20, 20, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void X(codelet_n1_9) (planner *p) { X(kdft_register) (p, n1_9, &desc);
 }
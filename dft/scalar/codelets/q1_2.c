@@ -83,7 +83,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 2, "q1_2", twinstr, &GENUS, { 8, 4, 4, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 2, "q1_2", twinstr, &GENUS, { 8, 4, 4, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_2) (planner *p) {
      X(kdft_difsq_register) (p, q1_2, &desc);
@@ -141,7 +141,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 2, "q1_2", twinstr, &GENUS, { 8, 4, 4, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 2, "q1_2", twinstr, &GENUS, { 8, 4, 4, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_2) (planner *p) {
      X(kdft_difsq_register) (p, q1_2, &desc);
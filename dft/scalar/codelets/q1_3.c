@@ -169,7 +169,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 3, "q1_3", twinstr, &GENUS, { 18, 12, 30, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 3, "q1_3", twinstr, &GENUS, { 18, 12, 30, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_3) (planner *p) {
      X(kdft_difsq_register) (p, q1_3, &desc);
@@ -308,7 +308,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 3, "q1_3", twinstr, &GENUS, { 30, 18, 18, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 3, "q1_3", twinstr, &GENUS, { 30, 18, 18, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_3) (planner *p) {
      X(kdft_difsq_register) (p, q1_3, &desc);
@@ -279,7 +279,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 4, "q1_4", twinstr, &GENUS, { 64, 24, 24, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, "q1_4", twinstr, &GENUS, { 64, 24, 24, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_4) (planner *p) {
      X(kdft_difsq_register) (p, q1_4, &desc);
@@ -516,7 +516,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 4, "q1_4", twinstr, &GENUS, { 64, 24, 24, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, "q1_4", twinstr, &GENUS, { 64, 24, 24, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_4) (planner *p) {
      X(kdft_difsq_register) (p, q1_4, &desc);
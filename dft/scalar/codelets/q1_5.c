@@ -536,7 +536,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 5, "q1_5", twinstr, &GENUS, { 70, 40, 130, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 5, "q1_5", twinstr, &GENUS, { 70, 40, 130, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_5) (planner *p) {
      X(kdft_difsq_register) (p, q1_5, &desc);
@@ -984,7 +984,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 5, "q1_5", twinstr, &GENUS, { 130, 70, 70, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 5, "q1_5", twinstr, &GENUS, { 130, 70, 70, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_5) (planner *p) {
      X(kdft_difsq_register) (p, q1_5, &desc);
@@ -687,7 +687,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 6, "q1_6", twinstr, &GENUS, { 144, 60, 132, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 6, "q1_6", twinstr, &GENUS, { 144, 60, 132, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_6) (planner *p) {
      X(kdft_difsq_register) (p, q1_6, &desc);
@@ -1312,7 +1312,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 6, "q1_6", twinstr, &GENUS, { 192, 84, 84, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 6, "q1_6", twinstr, &GENUS, { 192, 84, 84, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_6) (planner *p) {
      X(kdft_difsq_register) (p, q1_6, &desc);
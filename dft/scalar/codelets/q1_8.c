@@ -1227,7 +1227,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 8, "q1_8", twinstr, &GENUS, { 352, 112, 176, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, "q1_8", twinstr, &GENUS, { 352, 112, 176, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_8) (planner *p) {
      X(kdft_difsq_register) (p, q1_8, &desc);
@@ -2347,7 +2347,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 8, "q1_8", twinstr, &GENUS, { 416, 144, 112, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, "q1_8", twinstr, &GENUS, { 416, 144, 112, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_q1_8) (planner *p) {
      X(kdft_difsq_register) (p, q1_8, &desc);
@@ -257,7 +257,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 10, "t1_10", twinstr, &GENUS, { 48, 18, 54, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 10, "t1_10", twinstr, &GENUS, { 48, 18, 54, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_10) (planner *p) {
      X(kdft_dit_register) (p, t1_10, &desc);
@@ -481,7 +481,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 10, "t1_10", twinstr, &GENUS, { 72, 30, 30, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 10, "t1_10", twinstr, &GENUS, { 72, 30, 30, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_10) (planner *p) {
      X(kdft_dit_register) (p, t1_10, &desc);
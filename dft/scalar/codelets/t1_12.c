@@ -302,7 +302,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 12, "t1_12", twinstr, &GENUS, { 72, 22, 46, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 12, "t1_12", twinstr, &GENUS, { 72, 22, 46, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_12) (planner *p) {
      X(kdft_dit_register) (p, t1_12, &desc);
@@ -573,7 +573,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 12, "t1_12", twinstr, &GENUS, { 88, 30, 30, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 12, "t1_12", twinstr, &GENUS, { 88, 30, 30, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_12) (planner *p) {
      X(kdft_dit_register) (p, t1_12, &desc);
@@ -432,7 +432,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 15, "t1_15", twinstr, &GENUS, { 72, 28, 112, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 15, "t1_15", twinstr, &GENUS, { 72, 28, 112, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_15) (planner *p) {
      X(kdft_dit_register) (p, t1_15, &desc);
@@ -808,7 +808,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 15, "t1_15", twinstr, &GENUS, { 128, 56, 56, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 15, "t1_15", twinstr, &GENUS, { 128, 56, 56, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_15) (planner *p) {
      X(kdft_dit_register) (p, t1_15, &desc);
@@ -411,7 +411,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 16, "t1_16", twinstr, &GENUS, { 104, 30, 70, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, "t1_16", twinstr, &GENUS, { 104, 30, 70, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_16) (planner *p) {
      X(kdft_dit_register) (p, t1_16, &desc);
@@ -788,7 +788,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 16, "t1_16", twinstr, &GENUS, { 136, 46, 38, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, "t1_16", twinstr, &GENUS, { 136, 46, 38, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_16) (planner *p) {
      X(kdft_dit_register) (p, t1_16, &desc);
@@ -63,7 +63,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 2, "t1_2", twinstr, &GENUS, { 4, 2, 2, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 2, "t1_2", twinstr, &GENUS, { 4, 2, 2, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_2) (planner *p) {
      X(kdft_dit_register) (p, t1_2, &desc);
@@ -109,7 +109,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 2, "t1_2", twinstr, &GENUS, { 4, 2, 2, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 2, "t1_2", twinstr, &GENUS, { 4, 2, 2, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_2) (planner *p) {
      X(kdft_dit_register) (p, t1_2, &desc);
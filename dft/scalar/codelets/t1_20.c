@@ -558,7 +558,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 20, "t1_20", twinstr, &GENUS, { 136, 38, 110, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 20, "t1_20", twinstr, &GENUS, { 136, 38, 110, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_20) (planner *p) {
      X(kdft_dit_register) (p, t1_20, &desc);
@@ -1042,7 +1042,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 20, "t1_20", twinstr, &GENUS, { 184, 62, 62, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 20, "t1_20", twinstr, &GENUS, { 184, 62, 62, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_20) (planner *p) {
      X(kdft_dit_register) (p, t1_20, &desc);
@@ -818,7 +818,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 25, "t1_25", twinstr, &GENUS, { 84, 48, 316, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 25, "t1_25", twinstr, &GENUS, { 84, 48, 316, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_25) (planner *p) {
      X(kdft_dit_register) (p, t1_25, &desc);
@@ -1564,7 +1564,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 25, "t1_25", twinstr, &GENUS, { 260, 140, 140, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 25, "t1_25", twinstr, &GENUS, { 260, 140, 140, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_25) (planner *p) {
      X(kdft_dit_register) (p, t1_25, &desc);
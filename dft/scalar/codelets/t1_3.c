@@ -90,7 +90,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 3, "t1_3", twinstr, &GENUS, { 6, 4, 10, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 3, "t1_3", twinstr, &GENUS, { 6, 4, 10, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_3) (planner *p) {
      X(kdft_dit_register) (p, t1_3, &desc);
@@ -158,7 +158,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 3, "t1_3", twinstr, &GENUS, { 10, 6, 6, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 3, "t1_3", twinstr, &GENUS, { 10, 6, 6, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_3) (planner *p) {
      X(kdft_dit_register) (p, t1_3, &desc);
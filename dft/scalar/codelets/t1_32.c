@@ -938,7 +938,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 32, "t1_32", twinstr, &GENUS, { 236, 62, 198, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 32, "t1_32", twinstr, &GENUS, { 236, 62, 198, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_32) (planner *p) {
      X(kdft_dit_register) (p, t1_32, &desc);
@@ -1801,7 +1801,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 32, "t1_32", twinstr, &GENUS, { 340, 114, 94, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 32, "t1_32", twinstr, &GENUS, { 340, 114, 94, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_32) (planner *p) {
      X(kdft_dit_register) (p, t1_32, &desc);
@@ -106,7 +106,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 4, "t1_4", twinstr, &GENUS, { 16, 6, 6, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, "t1_4", twinstr, &GENUS, { 16, 6, 6, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_4) (planner *p) {
      X(kdft_dit_register) (p, t1_4, &desc);
@@ -188,7 +188,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 4, "t1_4", twinstr, &GENUS, { 16, 6, 6, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, "t1_4", twinstr, &GENUS, { 16, 6, 6, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_4) (planner *p) {
      X(kdft_dit_register) (p, t1_4, &desc);
@@ -131,7 +131,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 5, "t1_5", twinstr, &GENUS, { 14, 8, 26, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 5, "t1_5", twinstr, &GENUS, { 14, 8, 26, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_5) (planner *p) {
      X(kdft_dit_register) (p, t1_5, &desc);
@@ -245,7 +245,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 5, "t1_5", twinstr, &GENUS, { 26, 14, 14, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 5, "t1_5", twinstr, &GENUS, { 26, 14, 14, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_5) (planner *p) {
      X(kdft_dit_register) (p, t1_5, &desc);
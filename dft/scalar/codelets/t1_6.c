@@ -156,7 +156,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 6, "t1_6", twinstr, &GENUS, { 24, 10, 22, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 6, "t1_6", twinstr, &GENUS, { 24, 10, 22, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_6) (planner *p) {
      X(kdft_dit_register) (p, t1_6, &desc);
@@ -287,7 +287,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 6, "t1_6", twinstr, &GENUS, { 32, 14, 14, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 6, "t1_6", twinstr, &GENUS, { 32, 14, 14, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_6) (planner *p) {
      X(kdft_dit_register) (p, t1_6, &desc);
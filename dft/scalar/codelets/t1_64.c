@@ -2125,7 +2125,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 64, "t1_64", twinstr, &GENUS, { 520, 126, 518, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 64, "t1_64", twinstr, &GENUS, { 520, 126, 518, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_64) (planner *p) {
      X(kdft_dit_register) (p, t1_64, &desc);
@@ -4097,7 +4097,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 64, "t1_64", twinstr, &GENUS, { 808, 270, 230, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 64, "t1_64", twinstr, &GENUS, { 808, 270, 230, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_64) (planner *p) {
      X(kdft_dit_register) (p, t1_64, &desc);
@@ -197,7 +197,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 7, "t1_7", twinstr, &GENUS, { 18, 12, 54, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 7, "t1_7", twinstr, &GENUS, { 18, 12, 54, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_7) (planner *p) {
      X(kdft_dit_register) (p, t1_7, &desc);
@@ -346,7 +346,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 7, "t1_7", twinstr, &GENUS, { 36, 24, 36, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 7, "t1_7", twinstr, &GENUS, { 36, 24, 36, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_7) (planner *p) {
      X(kdft_dit_register) (p, t1_7, &desc);
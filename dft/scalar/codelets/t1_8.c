@@ -194,7 +194,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 8, "t1_8", twinstr, &GENUS, { 44, 14, 22, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, "t1_8", twinstr, &GENUS, { 44, 14, 22, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_8) (planner *p) {
      X(kdft_dit_register) (p, t1_8, &desc);
@@ -368,7 +368,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 8, "t1_8", twinstr, &GENUS, { 52, 18, 14, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, "t1_8", twinstr, &GENUS, { 52, 18, 14, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_8) (planner *p) {
      X(kdft_dit_register) (p, t1_8, &desc);
@@ -252,7 +252,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 9, "t1_9", twinstr, &GENUS, { 24, 16, 72, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 9, "t1_9", twinstr, &GENUS, { 24, 16, 72, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_9) (planner *p) {
      X(kdft_dit_register) (p, t1_9, &desc);
@@ -479,7 +479,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 9, "t1_9", twinstr, &GENUS, { 60, 36, 36, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 9, "t1_9", twinstr, &GENUS, { 60, 36, 36, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t1_9) (planner *p) {
      X(kdft_dit_register) (p, t1_9, &desc);
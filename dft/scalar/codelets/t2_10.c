@@ -279,7 +279,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 10, "t2_10", twinstr, &GENUS, { 48, 28, 66, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 10, "t2_10", twinstr, &GENUS, { 48, 28, 66, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t2_10) (planner *p) {
      X(kdft_dit_register) (p, t2_10, &desc);
@@ -501,7 +501,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 10, "t2_10", twinstr, &GENUS, { 76, 42, 38, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 10, "t2_10", twinstr, &GENUS, { 76, 42, 38, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t2_10) (planner *p) {
      X(kdft_dit_register) (p, t2_10, &desc);
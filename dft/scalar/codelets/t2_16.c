@@ -436,7 +436,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 16, "t2_16", twinstr, &GENUS, { 104, 42, 92, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, "t2_16", twinstr, &GENUS, { 104, 42, 92, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t2_16) (planner *p) {
      X(kdft_dit_register) (p, t2_16, &desc);
@@ -828,7 +828,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 16, "t2_16", twinstr, &GENUS, { 156, 68, 40, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, "t2_16", twinstr, &GENUS, { 156, 68, 40, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t2_16) (planner *p) {
      X(kdft_dit_register) (p, t2_16, &desc);
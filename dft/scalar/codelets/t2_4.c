@@ -112,7 +112,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 4, "t2_4", twinstr, &GENUS, { 16, 8, 8, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, "t2_4", twinstr, &GENUS, { 16, 8, 8, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t2_4) (planner *p) {
      X(kdft_dit_register) (p, t2_4, &desc);
@@ -192,7 +192,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 4, "t2_4", twinstr, &GENUS, { 16, 8, 8, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, "t2_4", twinstr, &GENUS, { 16, 8, 8, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t2_4) (planner *p) {
      X(kdft_dit_register) (p, t2_4, &desc);
@@ -2254,7 +2254,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 64, "t2_64", twinstr, &GENUS, { 520, 206, 634, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 64, "t2_64", twinstr, &GENUS, { 520, 206, 634, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t2_64) (planner *p) {
      X(kdft_dit_register) (p, t2_64, &desc);
@@ -4235,7 +4235,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 64, "t2_64", twinstr, &GENUS, { 880, 386, 274, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 64, "t2_64", twinstr, &GENUS, { 880, 386, 274, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t2_64) (planner *p) {
      X(kdft_dit_register) (p, t2_64, &desc);
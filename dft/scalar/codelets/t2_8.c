@@ -208,7 +208,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 8, "t2_8", twinstr, &GENUS, { 44, 20, 30, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, "t2_8", twinstr, &GENUS, { 44, 20, 30, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t2_8) (planner *p) {
      X(kdft_dit_register) (p, t2_8, &desc);
@@ -382,7 +382,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const ct_desc desc = { 8, "t2_8", twinstr, &GENUS, { 56, 26, 18, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, "t2_8", twinstr, &GENUS, { 56, 26, 18, 0, 0 }, 0, 0, 0 };
 
 void X(codelet_t2_8) (planner *p) {
      X(kdft_dit_register) (p, t2_8, &desc);
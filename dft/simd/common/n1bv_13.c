@@ -211,7 +211,7 @@ static void n1bv_13(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 13, XSIMD_STRING("n1bv_13"), { 31, 6, 57, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 13, XSIMD_STRING("n1bv_13"), { 31, 6, 57, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_13) (planner *p) { X(kdft_register) (p, n1bv_13, &desc);
 }
@@ -401,7 +401,7 @@ static void n1bv_13(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 13, XSIMD_STRING("n1bv_13"), { 69, 15, 19, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 13, XSIMD_STRING("n1bv_13"), { 69, 15, 19, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_13) (planner *p) { X(kdft_register) (p, n1bv_13, &desc);
 }
@@ -53,7 +53,7 @@ static void n1bv_2(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 2, XSIMD_STRING("n1bv_2"), { 2, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 2, XSIMD_STRING("n1bv_2"), { 2, 0, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_2) (planner *p) { X(kdft_register) (p, n1bv_2, &desc);
 }
@@ -88,7 +88,7 @@ static void n1bv_2(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 2, XSIMD_STRING("n1bv_2"), { 2, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 2, XSIMD_STRING("n1bv_2"), { 2, 0, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_2) (planner *p) { X(kdft_register) (p, n1bv_2, &desc);
 }
@@ -215,7 +215,7 @@ static void n1bv_20(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 20, XSIMD_STRING("n1bv_20"), { 58, 4, 46, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 20, XSIMD_STRING("n1bv_20"), { 58, 4, 46, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_20) (planner *p) { X(kdft_register) (p, n1bv_20, &desc);
 }
@@ -412,7 +412,7 @@ static void n1bv_20(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 20, XSIMD_STRING("n1bv_20"), { 92, 12, 12, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 20, XSIMD_STRING("n1bv_20"), { 92, 12, 12, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_20) (planner *p) { X(kdft_register) (p, n1bv_20, &desc);
 }
@@ -456,7 +456,7 @@ static void n1bv_25(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 25, XSIMD_STRING("n1bv_25"), { 43, 12, 181, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 25, XSIMD_STRING("n1bv_25"), { 43, 12, 181, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_25) (planner *p) { X(kdft_register) (p, n1bv_25, &desc);
 }
@@ -797,7 +797,7 @@ static void n1bv_25(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 25, XSIMD_STRING("n1bv_25"), { 147, 63, 77, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 25, XSIMD_STRING("n1bv_25"), { 147, 63, 77, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_25) (planner *p) { X(kdft_register) (p, n1bv_25, &desc);
 }
@@ -60,7 +60,7 @@ static void n1bv_3(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 3, XSIMD_STRING("n1bv_3"), { 3, 1, 3, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 3, XSIMD_STRING("n1bv_3"), { 3, 1, 3, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_3) (planner *p) { X(kdft_register) (p, n1bv_3, &desc);
 }
@@ -102,7 +102,7 @@ static void n1bv_3(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 3, XSIMD_STRING("n1bv_3"), { 5, 1, 1, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 3, XSIMD_STRING("n1bv_3"), { 5, 1, 1, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_3) (planner *p) { X(kdft_register) (p, n1bv_3, &desc);
 }
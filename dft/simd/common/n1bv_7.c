@@ -97,7 +97,7 @@ static void n1bv_7(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 7, XSIMD_STRING("n1bv_7"), { 9, 3, 21, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 7, XSIMD_STRING("n1bv_7"), { 9, 3, 21, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_7) (planner *p) { X(kdft_register) (p, n1bv_7, &desc);
 }
@@ -166,7 +166,7 @@ static void n1bv_7(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 7, XSIMD_STRING("n1bv_7"), { 18, 6, 12, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 7, XSIMD_STRING("n1bv_7"), { 18, 6, 12, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1bv_7) (planner *p) { X(kdft_register) (p, n1bv_7, &desc);
 }
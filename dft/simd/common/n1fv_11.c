@@ -165,7 +165,7 @@ static void n1fv_11(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 11, XSIMD_STRING("n1fv_11"), { 15, 5, 55, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 11, XSIMD_STRING("n1fv_11"), { 15, 5, 55, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_11) (planner *p) { X(kdft_register) (p, n1fv_11, &desc);
 }
@@ -260,7 +260,7 @@ static void n1fv_11(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 11, XSIMD_STRING("n1fv_11"), { 30, 10, 40, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 11, XSIMD_STRING("n1fv_11"), { 30, 10, 40, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_11) (planner *p) { X(kdft_register) (p, n1fv_11, &desc);
 }
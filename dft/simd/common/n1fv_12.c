@@ -132,7 +132,7 @@ static void n1fv_12(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 12, XSIMD_STRING("n1fv_12"), { 30, 2, 18, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 12, XSIMD_STRING("n1fv_12"), { 30, 2, 18, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_12) (planner *p) { X(kdft_register) (p, n1fv_12, &desc);
 }
@@ -246,7 +246,7 @@ static void n1fv_12(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 12, XSIMD_STRING("n1fv_12"), { 44, 4, 4, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 12, XSIMD_STRING("n1fv_12"), { 44, 4, 4, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_12) (planner *p) { X(kdft_register) (p, n1fv_12, &desc);
 }
@@ -1831,7 +1831,7 @@ static void n1fv_128(const R *ri, const R *ii, R *ro, R *io, stride is, stride o
      VLEAVE();
 }
 
-static const kdft_desc desc = { 128, XSIMD_STRING("n1fv_128"), { 440, 0, 642, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 128, XSIMD_STRING("n1fv_128"), { 440, 0, 642, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_128) (planner *p) { X(kdft_register) (p, n1fv_128, &desc);
 }
@@ -3644,7 +3644,7 @@ static void n1fv_128(const R *ri, const R *ii, R *ro, R *io, stride is, stride o
      VLEAVE();
 }
 
-static const kdft_desc desc = { 128, XSIMD_STRING("n1fv_128"), { 938, 186, 144, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 128, XSIMD_STRING("n1fv_128"), { 938, 186, 144, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_128) (planner *p) { X(kdft_register) (p, n1fv_128, &desc);
 }
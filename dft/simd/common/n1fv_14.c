@@ -170,7 +170,7 @@ static void n1fv_14(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 14, XSIMD_STRING("n1fv_14"), { 32, 6, 42, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 14, XSIMD_STRING("n1fv_14"), { 32, 6, 42, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_14) (planner *p) { X(kdft_register) (p, n1fv_14, &desc);
 }
@@ -301,7 +301,7 @@ static void n1fv_14(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 14, XSIMD_STRING("n1fv_14"), { 50, 12, 24, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 14, XSIMD_STRING("n1fv_14"), { 50, 12, 24, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_14) (planner *p) { X(kdft_register) (p, n1fv_14, &desc);
 }
@@ -176,7 +176,7 @@ static void n1fv_15(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 15, XSIMD_STRING("n1fv_15"), { 36, 7, 42, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 15, XSIMD_STRING("n1fv_15"), { 36, 7, 42, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_15) (planner *p) { X(kdft_register) (p, n1fv_15, &desc);
 }
@@ -336,7 +336,7 @@ static void n1fv_15(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 15, XSIMD_STRING("n1fv_15"), { 64, 11, 14, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 15, XSIMD_STRING("n1fv_15"), { 64, 11, 14, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_15) (planner *p) { X(kdft_register) (p, n1fv_15, &desc);
 }
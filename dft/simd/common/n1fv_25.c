@@ -456,7 +456,7 @@ static void n1fv_25(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 25, XSIMD_STRING("n1fv_25"), { 43, 12, 181, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 25, XSIMD_STRING("n1fv_25"), { 43, 12, 181, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_25) (planner *p) { X(kdft_register) (p, n1fv_25, &desc);
 }
@@ -792,7 +792,7 @@ static void n1fv_25(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 25, XSIMD_STRING("n1fv_25"), { 146, 62, 78, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 25, XSIMD_STRING("n1fv_25"), { 146, 62, 78, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_25) (planner *p) { X(kdft_register) (p, n1fv_25, &desc);
 }
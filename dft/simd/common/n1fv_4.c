@@ -64,7 +64,7 @@ static void n1fv_4(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 4, XSIMD_STRING("n1fv_4"), { 6, 0, 2, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 4, XSIMD_STRING("n1fv_4"), { 6, 0, 2, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_4) (planner *p) { X(kdft_register) (p, n1fv_4, &desc);
 }
@@ -110,7 +110,7 @@ static void n1fv_4(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 4, XSIMD_STRING("n1fv_4"), { 8, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 4, XSIMD_STRING("n1fv_4"), { 8, 0, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_4) (planner *p) { X(kdft_register) (p, n1fv_4, &desc);
 }
@@ -80,7 +80,7 @@ static void n1fv_5(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 5, XSIMD_STRING("n1fv_5"), { 7, 2, 9, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 5, XSIMD_STRING("n1fv_5"), { 7, 2, 9, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_5) (planner *p) { X(kdft_register) (p, n1fv_5, &desc);
 }
@@ -142,7 +142,7 @@ static void n1fv_5(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 5, XSIMD_STRING("n1fv_5"), { 13, 3, 3, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 5, XSIMD_STRING("n1fv_5"), { 13, 3, 3, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_5) (planner *p) { X(kdft_register) (p, n1fv_5, &desc);
 }
@@ -81,7 +81,7 @@ static void n1fv_6(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 6, XSIMD_STRING("n1fv_6"), { 12, 2, 6, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 6, XSIMD_STRING("n1fv_6"), { 12, 2, 6, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_6) (planner *p) { X(kdft_register) (p, n1fv_6, &desc);
 }
@@ -144,7 +144,7 @@ static void n1fv_6(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 6, XSIMD_STRING("n1fv_6"), { 16, 2, 2, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 6, XSIMD_STRING("n1fv_6"), { 16, 2, 2, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_6) (planner *p) { X(kdft_register) (p, n1fv_6, &desc);
 }
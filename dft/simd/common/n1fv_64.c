@@ -821,7 +821,7 @@ static void n1fv_64(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 64, XSIMD_STRING("n1fv_64"), { 198, 0, 258, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 64, XSIMD_STRING("n1fv_64"), { 198, 0, 258, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_64) (planner *p) { X(kdft_register) (p, n1fv_64, &desc);
 }
@@ -1624,7 +1624,7 @@ static void n1fv_64(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 64, XSIMD_STRING("n1fv_64"), { 404, 72, 52, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 64, XSIMD_STRING("n1fv_64"), { 404, 72, 52, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_64) (planner *p) { X(kdft_register) (p, n1fv_64, &desc);
 }
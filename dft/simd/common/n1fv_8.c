@@ -96,7 +96,7 @@ static void n1fv_8(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 8, XSIMD_STRING("n1fv_8"), { 16, 0, 10, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 8, XSIMD_STRING("n1fv_8"), { 16, 0, 10, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_8) (planner *p) { X(kdft_register) (p, n1fv_8, &desc);
 }
@@ -174,7 +174,7 @@ static void n1fv_8(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 8, XSIMD_STRING("n1fv_8"), { 26, 2, 0, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 8, XSIMD_STRING("n1fv_8"), { 26, 2, 0, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_8) (planner *p) { X(kdft_register) (p, n1fv_8, &desc);
 }
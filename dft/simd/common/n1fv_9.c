@@ -142,7 +142,7 @@ static void n1fv_9(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 9, XSIMD_STRING("n1fv_9"), { 12, 4, 34, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 9, XSIMD_STRING("n1fv_9"), { 12, 4, 34, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_9) (planner *p) { X(kdft_register) (p, n1fv_9, &desc);
 }
@@ -247,7 +247,7 @@ static void n1fv_9(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 9, XSIMD_STRING("n1fv_9"), { 30, 10, 16, 0 }, &GENUS, 0, 0, 0, 0 };
+static const kdft_desc desc = { 9, XSIMD_STRING("n1fv_9"), { 30, 10, 16, 0, 0 }, &GENUS, 0, 0, 0, 0 };
 
 void XSIMD(codelet_n1fv_9) (planner *p) { X(kdft_register) (p, n1fv_9, &desc);
 }
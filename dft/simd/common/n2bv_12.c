@@ -156,7 +156,7 @@ static void n2bv_12(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 12, XSIMD_STRING("n2bv_12"), { 30, 2, 18, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 12, XSIMD_STRING("n2bv_12"), { 30, 2, 18, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2bv_12) (planner *p) { X(kdft_register) (p, n2bv_12, &desc);
 }
@@ -294,7 +294,7 @@ static void n2bv_12(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 12, XSIMD_STRING("n2bv_12"), { 44, 4, 4, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 12, XSIMD_STRING("n2bv_12"), { 44, 4, 4, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2bv_12) (planner *p) { X(kdft_register) (p, n2bv_12, &desc);
 }
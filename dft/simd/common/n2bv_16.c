@@ -216,7 +216,7 @@ static void n2bv_16(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 16, XSIMD_STRING("n2bv_16"), { 38, 0, 34, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 16, XSIMD_STRING("n2bv_16"), { 38, 0, 34, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2bv_16) (planner *p) { X(kdft_register) (p, n2bv_16, &desc);
 }
@@ -414,7 +414,7 @@ static void n2bv_16(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 16, XSIMD_STRING("n2bv_16"), { 68, 8, 4, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 16, XSIMD_STRING("n2bv_16"), { 68, 8, 4, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2bv_16) (planner *p) { X(kdft_register) (p, n2bv_16, &desc);
 }
@@ -56,7 +56,7 @@ static void n2bv_2(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 2, XSIMD_STRING("n2bv_2"), { 2, 0, 0, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 2, XSIMD_STRING("n2bv_2"), { 2, 0, 0, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2bv_2) (planner *p) { X(kdft_register) (p, n2bv_2, &desc);
 }
@@ -94,7 +94,7 @@ static void n2bv_2(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 2, XSIMD_STRING("n2bv_2"), { 2, 0, 0, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 2, XSIMD_STRING("n2bv_2"), { 2, 0, 0, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2bv_2) (planner *p) { X(kdft_register) (p, n2bv_2, &desc);
 }
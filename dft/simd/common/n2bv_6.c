@@ -93,7 +93,7 @@ static void n2bv_6(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 6, XSIMD_STRING("n2bv_6"), { 12, 2, 6, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 6, XSIMD_STRING("n2bv_6"), { 12, 2, 6, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2bv_6) (planner *p) { X(kdft_register) (p, n2bv_6, &desc);
 }
@@ -168,7 +168,7 @@ static void n2bv_6(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 6, XSIMD_STRING("n2bv_6"), { 16, 2, 2, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 6, XSIMD_STRING("n2bv_6"), { 16, 2, 2, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2bv_6) (planner *p) { X(kdft_register) (p, n2bv_6, &desc);
 }
@@ -945,7 +945,7 @@ static void n2bv_64(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 64, XSIMD_STRING("n2bv_64"), { 198, 0, 258, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 64, XSIMD_STRING("n2bv_64"), { 198, 0, 258, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2bv_64) (planner *p) { X(kdft_register) (p, n2bv_64, &desc);
 }
@@ -1872,7 +1872,7 @@ static void n2bv_64(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 64, XSIMD_STRING("n2bv_64"), { 404, 72, 52, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 64, XSIMD_STRING("n2bv_64"), { 404, 72, 52, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2bv_64) (planner *p) { X(kdft_register) (p, n2bv_64, &desc);
 }
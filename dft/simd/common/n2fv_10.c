@@ -141,7 +141,7 @@ static void n2fv_10(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 10, XSIMD_STRING("n2fv_10"), { 24, 4, 18, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 10, XSIMD_STRING("n2fv_10"), { 24, 4, 18, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2fv_10) (planner *p) { X(kdft_register) (p, n2fv_10, &desc);
 }
@@ -264,7 +264,7 @@ static void n2fv_10(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 10, XSIMD_STRING("n2fv_10"), { 36, 6, 6, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 10, XSIMD_STRING("n2fv_10"), { 36, 6, 6, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2fv_10) (planner *p) { X(kdft_register) (p, n2fv_10, &desc);
 }
@@ -194,7 +194,7 @@ static void n2fv_14(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 14, XSIMD_STRING("n2fv_14"), { 32, 6, 42, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 14, XSIMD_STRING("n2fv_14"), { 32, 6, 42, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2fv_14) (planner *p) { X(kdft_register) (p, n2fv_14, &desc);
 }
@@ -355,7 +355,7 @@ static void n2fv_14(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 14, XSIMD_STRING("n2fv_14"), { 50, 12, 24, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 14, XSIMD_STRING("n2fv_14"), { 50, 12, 24, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2fv_14) (planner *p) { X(kdft_register) (p, n2fv_14, &desc);
 }
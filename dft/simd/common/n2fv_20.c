@@ -257,7 +257,7 @@ static void n2fv_20(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 20, XSIMD_STRING("n2fv_20"), { 58, 4, 46, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 20, XSIMD_STRING("n2fv_20"), { 58, 4, 46, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2fv_20) (planner *p) { X(kdft_register) (p, n2fv_20, &desc);
 }
@@ -496,7 +496,7 @@ static void n2fv_20(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 20, XSIMD_STRING("n2fv_20"), { 92, 12, 12, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 20, XSIMD_STRING("n2fv_20"), { 92, 12, 12, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2fv_20) (planner *p) { X(kdft_register) (p, n2fv_20, &desc);
 }
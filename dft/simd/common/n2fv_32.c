@@ -435,7 +435,7 @@ static void n2fv_32(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 32, XSIMD_STRING("n2fv_32"), { 88, 0, 98, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 32, XSIMD_STRING("n2fv_32"), { 88, 0, 98, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2fv_32) (planner *p) { X(kdft_register) (p, n2fv_32, &desc);
 }
@@ -852,7 +852,7 @@ static void n2fv_32(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 32, XSIMD_STRING("n2fv_32"), { 170, 26, 16, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 32, XSIMD_STRING("n2fv_32"), { 170, 26, 16, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2fv_32) (planner *p) { X(kdft_register) (p, n2fv_32, &desc);
 }
@@ -111,7 +111,7 @@ static void n2fv_8(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 8, XSIMD_STRING("n2fv_8"), { 16, 0, 10, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 8, XSIMD_STRING("n2fv_8"), { 16, 0, 10, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2fv_8) (planner *p) { X(kdft_register) (p, n2fv_8, &desc);
 }
@@ -204,7 +204,7 @@ static void n2fv_8(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 8, XSIMD_STRING("n2fv_8"), { 26, 2, 0, 0 }, &GENUS, 0, 2, 0, 0 };
+static const kdft_desc desc = { 8, XSIMD_STRING("n2fv_8"), { 26, 2, 0, 0, 0 }, &GENUS, 0, 2, 0, 0 };
 
 void XSIMD(codelet_n2fv_8) (planner *p) { X(kdft_register) (p, n2fv_8, &desc);
 }
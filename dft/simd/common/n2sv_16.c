@@ -341,7 +341,7 @@ static void n2sv_16(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 16, XSIMD_STRING("n2sv_16"), { 104, 0, 40, 0 }, &GENUS, 0, 1, 0, 0 };
+static const kdft_desc desc = { 16, XSIMD_STRING("n2sv_16"), { 104, 0, 40, 0, 0 }, &GENUS, 0, 1, 0, 0 };
 
 void XSIMD(codelet_n2sv_16) (planner *p) { X(kdft_register) (p, n2sv_16, &desc);
 }
@@ -664,7 +664,7 @@ static void n2sv_16(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 16, XSIMD_STRING("n2sv_16"), { 136, 16, 8, 0 }, &GENUS, 0, 1, 0, 0 };
+static const kdft_desc desc = { 16, XSIMD_STRING("n2sv_16"), { 136, 16, 8, 0, 0 }, &GENUS, 0, 1, 0, 0 };
 
 void XSIMD(codelet_n2sv_16) (planner *p) { X(kdft_register) (p, n2sv_16, &desc);
 }
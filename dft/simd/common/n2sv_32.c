@@ -760,7 +760,7 @@ static void n2sv_32(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 32, XSIMD_STRING("n2sv_32"), { 236, 0, 136, 0 }, &GENUS, 0, 1, 0, 0 };
+static const kdft_desc desc = { 32, XSIMD_STRING("n2sv_32"), { 236, 0, 136, 0, 0 }, &GENUS, 0, 1, 0, 0 };
 
 void XSIMD(codelet_n2sv_32) (planner *p) { X(kdft_register) (p, n2sv_32, &desc);
 }
@@ -1504,7 +1504,7 @@ static void n2sv_32(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 32, XSIMD_STRING("n2sv_32"), { 340, 52, 32, 0 }, &GENUS, 0, 1, 0, 0 };
+static const kdft_desc desc = { 32, XSIMD_STRING("n2sv_32"), { 340, 52, 32, 0, 0 }, &GENUS, 0, 1, 0, 0 };
 
 void XSIMD(codelet_n2sv_32) (planner *p) { X(kdft_register) (p, n2sv_32, &desc);
 }
@@ -91,7 +91,7 @@ static void n2sv_4(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 4, XSIMD_STRING("n2sv_4"), { 16, 0, 0, 0 }, &GENUS, 0, 1, 0, 0 };
+static const kdft_desc desc = { 4, XSIMD_STRING("n2sv_4"), { 16, 0, 0, 0, 0 }, &GENUS, 0, 1, 0, 0 };
 
 void XSIMD(codelet_n2sv_4) (planner *p) { X(kdft_register) (p, n2sv_4, &desc);
 }
@@ -164,7 +164,7 @@ static void n2sv_4(const R *ri, const R *ii, R *ro, R *io, stride is, stride os,
      VLEAVE();
 }
 
-static const kdft_desc desc = { 4, XSIMD_STRING("n2sv_4"), { 16, 0, 0, 0 }, &GENUS, 0, 1, 0, 0 };
+static const kdft_desc desc = { 4, XSIMD_STRING("n2sv_4"), { 16, 0, 0, 0, 0 }, &GENUS, 0, 1, 0, 0 };
 
 void XSIMD(codelet_n2sv_4) (planner *p) { X(kdft_register) (p, n2sv_4, &desc);
 }
@@ -1748,7 +1748,7 @@ static void n2sv_64(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 64, XSIMD_STRING("n2sv_64"), { 520, 0, 392, 0 }, &GENUS, 0, 1, 0, 0 };
+static const kdft_desc desc = { 64, XSIMD_STRING("n2sv_64"), { 520, 0, 392, 0, 0 }, &GENUS, 0, 1, 0, 0 };
 
 void XSIMD(codelet_n2sv_64) (planner *p) { X(kdft_register) (p, n2sv_64, &desc);
 }
@@ -3478,7 +3478,7 @@ static void n2sv_64(const R *ri, const R *ii, R *ro, R *io, stride is, stride os
      VLEAVE();
 }
 
-static const kdft_desc desc = { 64, XSIMD_STRING("n2sv_64"), { 808, 144, 104, 0 }, &GENUS, 0, 1, 0, 0 };
+static const kdft_desc desc = { 64, XSIMD_STRING("n2sv_64"), { 808, 144, 104, 0, 0 }, &GENUS, 0, 1, 0, 0 };
 
 void XSIMD(codelet_n2sv_64) (planner *p) { X(kdft_register) (p, n2sv_64, &desc);
 }
@@ -62,7 +62,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 2, XSIMD_STRING("q1bv_2"), twinstr, &GENUS, { 6, 4, 0, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 2, XSIMD_STRING("q1bv_2"), twinstr, &GENUS, { 6, 4, 0, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_q1bv_2) (planner *p) {
      X(kdft_difsq_register) (p, q1bv_2, &desc);
@@ -106,7 +106,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 2, XSIMD_STRING("q1bv_2"), twinstr, &GENUS, { 6, 4, 0, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 2, XSIMD_STRING("q1bv_2"), twinstr, &GENUS, { 6, 4, 0, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_q1bv_2) (planner *p) {
      X(kdft_difsq_register) (p, q1bv_2, &desc);
@@ -230,7 +230,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 5, XSIMD_STRING("q1bv_5"), twinstr, &GENUS, { 55, 50, 45, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 5, XSIMD_STRING("q1bv_5"), twinstr, &GENUS, { 55, 50, 45, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_q1bv_5) (planner *p) {
      X(kdft_difsq_register) (p, q1bv_5, &desc);
@@ -442,7 +442,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 5, XSIMD_STRING("q1bv_5"), twinstr, &GENUS, { 85, 55, 15, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 5, XSIMD_STRING("q1bv_5"), twinstr, &GENUS, { 85, 55, 15, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_q1bv_5) (planner *p) {
      X(kdft_difsq_register) (p, q1bv_5, &desc);
@@ -523,7 +523,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 8, XSIMD_STRING("q1bv_8"), twinstr, &GENUS, { 184, 112, 80, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, XSIMD_STRING("q1bv_8"), twinstr, &GENUS, { 184, 112, 80, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_q1bv_8) (planner *p) {
      X(kdft_difsq_register) (p, q1bv_8, &desc);
@@ -1028,7 +1028,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 8, XSIMD_STRING("q1bv_8"), twinstr, &GENUS, { 264, 128, 0, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, XSIMD_STRING("q1bv_8"), twinstr, &GENUS, { 264, 128, 0, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_q1bv_8) (planner *p) {
      X(kdft_difsq_register) (p, q1bv_8, &desc);
@@ -136,7 +136,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 4, XSIMD_STRING("q1fv_4"), twinstr, &GENUS, { 36, 24, 8, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, XSIMD_STRING("q1fv_4"), twinstr, &GENUS, { 36, 24, 8, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_q1fv_4) (planner *p) {
      X(kdft_difsq_register) (p, q1fv_4, &desc);
@@ -254,7 +254,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 4, XSIMD_STRING("q1fv_4"), twinstr, &GENUS, { 44, 24, 0, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, XSIMD_STRING("q1fv_4"), twinstr, &GENUS, { 44, 24, 0, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_q1fv_4) (planner *p) {
      X(kdft_difsq_register) (p, q1fv_4, &desc);
@@ -72,7 +72,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 4, XSIMD_STRING("t1buv_4"), twinstr, &GENUS, { 9, 6, 2, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, XSIMD_STRING("t1buv_4"), twinstr, &GENUS, { 9, 6, 2, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1buv_4) (planner *p) {
      X(kdft_dit_register) (p, t1buv_4, &desc);
@@ -126,7 +126,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 4, XSIMD_STRING("t1buv_4"), twinstr, &GENUS, { 11, 6, 0, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, XSIMD_STRING("t1buv_4"), twinstr, &GENUS, { 11, 6, 0, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1buv_4) (planner *p) {
      X(kdft_dit_register) (p, t1buv_4, &desc);
@@ -96,7 +96,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 6, XSIMD_STRING("t1buv_6"), twinstr, &GENUS, { 17, 12, 6, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 6, XSIMD_STRING("t1buv_6"), twinstr, &GENUS, { 17, 12, 6, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1buv_6) (planner *p) {
      X(kdft_dit_register) (p, t1buv_6, &desc);
@@ -174,7 +174,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 6, XSIMD_STRING("t1buv_6"), twinstr, &GENUS, { 21, 12, 2, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 6, XSIMD_STRING("t1buv_6"), twinstr, &GENUS, { 21, 12, 2, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1buv_6) (planner *p) {
      X(kdft_dit_register) (p, t1buv_6, &desc);
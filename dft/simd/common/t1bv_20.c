@@ -267,7 +267,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 20, XSIMD_STRING("t1bv_20"), twinstr, &GENUS, { 77, 42, 46, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 20, XSIMD_STRING("t1bv_20"), twinstr, &GENUS, { 77, 42, 46, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1bv_20) (planner *p) {
      X(kdft_dit_register) (p, t1bv_20, &desc);
@@ -516,7 +516,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 20, XSIMD_STRING("t1bv_20"), twinstr, &GENUS, { 111, 50, 12, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 20, XSIMD_STRING("t1bv_20"), twinstr, &GENUS, { 111, 50, 12, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1bv_20) (planner *p) {
      X(kdft_dit_register) (p, t1bv_20, &desc);
@@ -522,7 +522,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 25, XSIMD_STRING("t1bv_25"), twinstr, &GENUS, { 67, 60, 181, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 25, XSIMD_STRING("t1bv_25"), twinstr, &GENUS, { 67, 60, 181, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1bv_25) (planner *p) {
      X(kdft_dit_register) (p, t1bv_25, &desc);
@@ -936,7 +936,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 25, XSIMD_STRING("t1bv_25"), twinstr, &GENUS, { 171, 111, 77, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 25, XSIMD_STRING("t1bv_25"), twinstr, &GENUS, { 171, 111, 77, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1bv_25) (planner *p) {
      X(kdft_dit_register) (p, t1bv_25, &desc);
@@ -979,7 +979,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 64, XSIMD_STRING("t1bv_64"), twinstr, &GENUS, { 261, 126, 258, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 64, XSIMD_STRING("t1bv_64"), twinstr, &GENUS, { 261, 126, 258, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1bv_64) (planner *p) {
      X(kdft_dit_register) (p, t1bv_64, &desc);
@@ -1940,7 +1940,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 64, XSIMD_STRING("t1bv_64"), twinstr, &GENUS, { 467, 198, 52, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 64, XSIMD_STRING("t1bv_64"), twinstr, &GENUS, { 467, 198, 52, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1bv_64) (planner *p) {
      X(kdft_dit_register) (p, t1bv_64, &desc);
@@ -115,7 +115,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 8, XSIMD_STRING("t1bv_8"), twinstr, &GENUS, { 23, 14, 10, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, XSIMD_STRING("t1bv_8"), twinstr, &GENUS, { 23, 14, 10, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1bv_8) (planner *p) {
      X(kdft_dit_register) (p, t1bv_8, &desc);
@@ -212,7 +212,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 8, XSIMD_STRING("t1bv_8"), twinstr, &GENUS, { 33, 16, 0, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, XSIMD_STRING("t1bv_8"), twinstr, &GENUS, { 33, 16, 0, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1bv_8) (planner *p) {
      X(kdft_dit_register) (p, t1bv_8, &desc);
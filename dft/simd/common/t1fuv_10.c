@@ -144,7 +144,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 10, XSIMD_STRING("t1fuv_10"), twinstr, &GENUS, { 33, 22, 18, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 10, XSIMD_STRING("t1fuv_10"), twinstr, &GENUS, { 33, 22, 18, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fuv_10) (planner *p) {
      X(kdft_dit_register) (p, t1fuv_10, &desc);
@@ -270,7 +270,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 10, XSIMD_STRING("t1fuv_10"), twinstr, &GENUS, { 45, 24, 6, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 10, XSIMD_STRING("t1fuv_10"), twinstr, &GENUS, { 45, 24, 6, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fuv_10) (planner *p) {
      X(kdft_dit_register) (p, t1fuv_10, &desc);
@@ -57,7 +57,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 2, XSIMD_STRING("t1fuv_2"), twinstr, &GENUS, { 3, 2, 0, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 2, XSIMD_STRING("t1fuv_2"), twinstr, &GENUS, { 3, 2, 0, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fuv_2) (planner *p) {
      X(kdft_dit_register) (p, t1fuv_2, &desc);
@@ -96,7 +96,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 2, XSIMD_STRING("t1fuv_2"), twinstr, &GENUS, { 3, 2, 0, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 2, XSIMD_STRING("t1fuv_2"), twinstr, &GENUS, { 3, 2, 0, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fuv_2) (planner *p) {
      X(kdft_dit_register) (p, t1fuv_2, &desc);
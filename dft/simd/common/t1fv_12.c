@@ -166,7 +166,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 12, XSIMD_STRING("t1fv_12"), twinstr, &GENUS, { 41, 24, 18, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 12, XSIMD_STRING("t1fv_12"), twinstr, &GENUS, { 41, 24, 18, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_12) (planner *p) {
      X(kdft_dit_register) (p, t1fv_12, &desc);
@@ -314,7 +314,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 12, XSIMD_STRING("t1fv_12"), twinstr, &GENUS, { 55, 26, 4, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 12, XSIMD_STRING("t1fv_12"), twinstr, &GENUS, { 55, 26, 4, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_12) (planner *p) {
      X(kdft_dit_register) (p, t1fv_12, &desc);
@@ -217,7 +217,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 15, XSIMD_STRING("t1fv_15"), twinstr, &GENUS, { 50, 35, 42, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 15, XSIMD_STRING("t1fv_15"), twinstr, &GENUS, { 50, 35, 42, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_15) (planner *p) {
      X(kdft_dit_register) (p, t1fv_15, &desc);
@@ -418,7 +418,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 15, XSIMD_STRING("t1fv_15"), twinstr, &GENUS, { 78, 39, 14, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 15, XSIMD_STRING("t1fv_15"), twinstr, &GENUS, { 78, 39, 14, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_15) (planner *p) {
      X(kdft_dit_register) (p, t1fv_15, &desc);
@@ -522,7 +522,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 25, XSIMD_STRING("t1fv_25"), twinstr, &GENUS, { 67, 60, 181, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 25, XSIMD_STRING("t1fv_25"), twinstr, &GENUS, { 67, 60, 181, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_25) (planner *p) {
      X(kdft_dit_register) (p, t1fv_25, &desc);
@@ -934,7 +934,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 25, XSIMD_STRING("t1fv_25"), twinstr, &GENUS, { 170, 110, 78, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 25, XSIMD_STRING("t1fv_25"), twinstr, &GENUS, { 170, 110, 78, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_25) (planner *p) {
      X(kdft_dit_register) (p, t1fv_25, &desc);
@@ -66,7 +66,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 3, XSIMD_STRING("t1fv_3"), twinstr, &GENUS, { 5, 5, 3, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 3, XSIMD_STRING("t1fv_3"), twinstr, &GENUS, { 5, 5, 3, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_3) (planner *p) {
      X(kdft_dit_register) (p, t1fv_3, &desc);
@@ -114,7 +114,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 3, XSIMD_STRING("t1fv_3"), twinstr, &GENUS, { 7, 5, 1, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 3, XSIMD_STRING("t1fv_3"), twinstr, &GENUS, { 7, 5, 1, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_3) (planner *p) {
      X(kdft_dit_register) (p, t1fv_3, &desc);
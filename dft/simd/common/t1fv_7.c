@@ -119,7 +119,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 7, XSIMD_STRING("t1fv_7"), twinstr, &GENUS, { 15, 15, 21, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 7, XSIMD_STRING("t1fv_7"), twinstr, &GENUS, { 15, 15, 21, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_7) (planner *p) {
      X(kdft_dit_register) (p, t1fv_7, &desc);
@@ -208,7 +208,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 7, XSIMD_STRING("t1fv_7"), twinstr, &GENUS, { 24, 18, 12, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 7, XSIMD_STRING("t1fv_7"), twinstr, &GENUS, { 24, 18, 12, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_7) (planner *p) {
      X(kdft_dit_register) (p, t1fv_7, &desc);
@@ -162,7 +162,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 9, XSIMD_STRING("t1fv_9"), twinstr, &GENUS, { 20, 20, 34, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 9, XSIMD_STRING("t1fv_9"), twinstr, &GENUS, { 20, 20, 34, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_9) (planner *p) {
      X(kdft_dit_register) (p, t1fv_9, &desc);
@@ -288,7 +288,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 9, XSIMD_STRING("t1fv_9"), twinstr, &GENUS, { 38, 26, 16, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 9, XSIMD_STRING("t1fv_9"), twinstr, &GENUS, { 38, 26, 16, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1fv_9) (planner *p) {
      X(kdft_dit_register) (p, t1fv_9, &desc);
@@ -426,7 +426,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 16, XSIMD_STRING("t1sv_16"), twinstr, &GENUS, { 104, 30, 70, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, XSIMD_STRING("t1sv_16"), twinstr, &GENUS, { 104, 30, 70, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1sv_16) (planner *p) {
      X(kdft_dit_register) (p, t1sv_16, &desc);
@@ -818,7 +818,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 16, XSIMD_STRING("t1sv_16"), twinstr, &GENUS, { 136, 46, 38, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, XSIMD_STRING("t1sv_16"), twinstr, &GENUS, { 136, 46, 38, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1sv_16) (planner *p) {
      X(kdft_dit_register) (p, t1sv_16, &desc);
@@ -64,7 +64,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 2, XSIMD_STRING("t1sv_2"), twinstr, &GENUS, { 4, 2, 2, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 2, XSIMD_STRING("t1sv_2"), twinstr, &GENUS, { 4, 2, 2, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1sv_2) (planner *p) {
      X(kdft_dit_register) (p, t1sv_2, &desc);
@@ -111,7 +111,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 2, XSIMD_STRING("t1sv_2"), twinstr, &GENUS, { 4, 2, 2, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 2, XSIMD_STRING("t1sv_2"), twinstr, &GENUS, { 4, 2, 2, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1sv_2) (planner *p) {
      X(kdft_dit_register) (p, t1sv_2, &desc);
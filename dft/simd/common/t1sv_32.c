@@ -969,7 +969,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 32, XSIMD_STRING("t1sv_32"), twinstr, &GENUS, { 236, 62, 198, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 32, XSIMD_STRING("t1sv_32"), twinstr, &GENUS, { 236, 62, 198, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1sv_32) (planner *p) {
      X(kdft_dit_register) (p, t1sv_32, &desc);
@@ -1863,7 +1863,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 32, XSIMD_STRING("t1sv_32"), twinstr, &GENUS, { 340, 114, 94, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 32, XSIMD_STRING("t1sv_32"), twinstr, &GENUS, { 340, 114, 94, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1sv_32) (planner *p) {
      X(kdft_dit_register) (p, t1sv_32, &desc);
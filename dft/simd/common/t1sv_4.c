@@ -109,7 +109,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 4, XSIMD_STRING("t1sv_4"), twinstr, &GENUS, { 16, 6, 6, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, XSIMD_STRING("t1sv_4"), twinstr, &GENUS, { 16, 6, 6, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1sv_4) (planner *p) {
      X(kdft_dit_register) (p, t1sv_4, &desc);
@@ -194,7 +194,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 4, XSIMD_STRING("t1sv_4"), twinstr, &GENUS, { 16, 6, 6, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, XSIMD_STRING("t1sv_4"), twinstr, &GENUS, { 16, 6, 6, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1sv_4) (planner *p) {
      X(kdft_dit_register) (p, t1sv_4, &desc);
@@ -201,7 +201,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 8, XSIMD_STRING("t1sv_8"), twinstr, &GENUS, { 44, 14, 22, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, XSIMD_STRING("t1sv_8"), twinstr, &GENUS, { 44, 14, 22, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1sv_8) (planner *p) {
      X(kdft_dit_register) (p, t1sv_8, &desc);
@@ -382,7 +382,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 8, XSIMD_STRING("t1sv_8"), twinstr, &GENUS, { 52, 18, 14, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, XSIMD_STRING("t1sv_8"), twinstr, &GENUS, { 52, 18, 14, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t1sv_8) (planner *p) {
      X(kdft_dit_register) (p, t1sv_8, &desc);
@@ -93,7 +93,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 5, XSIMD_STRING("t2bv_5"), twinstr, &GENUS, { 11, 10, 9, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 5, XSIMD_STRING("t2bv_5"), twinstr, &GENUS, { 11, 10, 9, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2bv_5) (planner *p) {
      X(kdft_dit_register) (p, t2bv_5, &desc);
@@ -168,7 +168,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 5, XSIMD_STRING("t2bv_5"), twinstr, &GENUS, { 17, 11, 3, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 5, XSIMD_STRING("t2bv_5"), twinstr, &GENUS, { 17, 11, 3, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2bv_5) (planner *p) {
      X(kdft_dit_register) (p, t2bv_5, &desc);
@@ -218,7 +218,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 16, XSIMD_STRING("t2fv_16"), twinstr, &GENUS, { 53, 30, 34, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, XSIMD_STRING("t2fv_16"), twinstr, &GENUS, { 53, 30, 34, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2fv_16) (planner *p) {
      X(kdft_dit_register) (p, t2fv_16, &desc);
@@ -418,7 +418,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 16, XSIMD_STRING("t2fv_16"), twinstr, &GENUS, { 83, 38, 4, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, XSIMD_STRING("t2fv_16"), twinstr, &GENUS, { 83, 38, 4, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2fv_16) (planner *p) {
      X(kdft_dit_register) (p, t2fv_16, &desc);
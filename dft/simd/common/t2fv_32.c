@@ -454,7 +454,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 32, XSIMD_STRING("t2fv_32"), twinstr, &GENUS, { 119, 62, 98, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 32, XSIMD_STRING("t2fv_32"), twinstr, &GENUS, { 119, 62, 98, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2fv_32) (planner *p) {
      X(kdft_dit_register) (p, t2fv_32, &desc);
@@ -890,7 +890,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 32, XSIMD_STRING("t2fv_32"), twinstr, &GENUS, { 201, 88, 16, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 32, XSIMD_STRING("t2fv_32"), twinstr, &GENUS, { 201, 88, 16, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2fv_32) (planner *p) {
      X(kdft_dit_register) (p, t2fv_32, &desc);
@@ -437,7 +437,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 16, XSIMD_STRING("t2sv_16"), twinstr, &GENUS, { 104, 42, 92, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, XSIMD_STRING("t2sv_16"), twinstr, &GENUS, { 104, 42, 92, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2sv_16) (planner *p) {
      X(kdft_dit_register) (p, t2sv_16, &desc);
@@ -830,7 +830,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 16, XSIMD_STRING("t2sv_16"), twinstr, &GENUS, { 156, 68, 40, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, XSIMD_STRING("t2sv_16"), twinstr, &GENUS, { 156, 68, 40, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2sv_16) (planner *p) {
      X(kdft_dit_register) (p, t2sv_16, &desc);
@@ -1006,7 +1006,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 32, XSIMD_STRING("t2sv_32"), twinstr, &GENUS, { 236, 98, 252, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 32, XSIMD_STRING("t2sv_32"), twinstr, &GENUS, { 236, 98, 252, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2sv_32) (planner *p) {
      X(kdft_dit_register) (p, t2sv_32, &desc);
@@ -1887,7 +1887,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 32, XSIMD_STRING("t2sv_32"), twinstr, &GENUS, { 376, 168, 112, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 32, XSIMD_STRING("t2sv_32"), twinstr, &GENUS, { 376, 168, 112, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2sv_32) (planner *p) {
      X(kdft_dit_register) (p, t2sv_32, &desc);
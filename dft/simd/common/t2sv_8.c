@@ -209,7 +209,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 8, XSIMD_STRING("t2sv_8"), twinstr, &GENUS, { 44, 20, 30, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, XSIMD_STRING("t2sv_8"), twinstr, &GENUS, { 44, 20, 30, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2sv_8) (planner *p) {
      X(kdft_dit_register) (p, t2sv_8, &desc);
@@ -384,7 +384,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, (2 * VL), 0 }
 };
 
-static const ct_desc desc = { 8, XSIMD_STRING("t2sv_8"), twinstr, &GENUS, { 56, 26, 18, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, XSIMD_STRING("t2sv_8"), twinstr, &GENUS, { 56, 26, 18, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t2sv_8) (planner *p) {
      X(kdft_dit_register) (p, t2sv_8, &desc);
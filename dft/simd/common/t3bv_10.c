@@ -150,7 +150,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 10, XSIMD_STRING("t3bv_10"), twinstr, &GENUS, { 39, 34, 18, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 10, XSIMD_STRING("t3bv_10"), twinstr, &GENUS, { 39, 34, 18, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3bv_10) (planner *p) {
      X(kdft_dit_register) (p, t3bv_10, &desc);
@@ -282,7 +282,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 10, XSIMD_STRING("t3bv_10"), twinstr, &GENUS, { 51, 36, 6, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 10, XSIMD_STRING("t3bv_10"), twinstr, &GENUS, { 51, 36, 6, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3bv_10) (planner *p) {
      X(kdft_dit_register) (p, t3bv_10, &desc);
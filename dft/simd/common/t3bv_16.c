@@ -225,7 +225,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 16, XSIMD_STRING("t3bv_16"), twinstr, &GENUS, { 64, 52, 34, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, XSIMD_STRING("t3bv_16"), twinstr, &GENUS, { 64, 52, 34, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3bv_16) (planner *p) {
      X(kdft_dit_register) (p, t3bv_16, &desc);
@@ -432,7 +432,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 16, XSIMD_STRING("t3bv_16"), twinstr, &GENUS, { 94, 60, 4, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 16, XSIMD_STRING("t3bv_16"), twinstr, &GENUS, { 94, 60, 4, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3bv_16) (planner *p) {
      X(kdft_dit_register) (p, t3bv_16, &desc);
@@ -275,7 +275,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 20, XSIMD_STRING("t3bv_20"), twinstr, &GENUS, { 92, 72, 46, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 20, XSIMD_STRING("t3bv_20"), twinstr, &GENUS, { 92, 72, 46, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3bv_20) (planner *p) {
      X(kdft_dit_register) (p, t3bv_20, &desc);
@@ -532,7 +532,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 20, XSIMD_STRING("t3bv_20"), twinstr, &GENUS, { 126, 80, 12, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 20, XSIMD_STRING("t3bv_20"), twinstr, &GENUS, { 126, 80, 12, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3bv_20) (planner *p) {
      X(kdft_dit_register) (p, t3bv_20, &desc);
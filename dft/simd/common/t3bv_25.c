@@ -530,7 +530,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 25, XSIMD_STRING("t3bv_25"), twinstr, &GENUS, { 87, 100, 181, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 25, XSIMD_STRING("t3bv_25"), twinstr, &GENUS, { 87, 100, 181, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3bv_25) (planner *p) {
      X(kdft_dit_register) (p, t3bv_25, &desc);
@@ -952,7 +952,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 25, XSIMD_STRING("t3bv_25"), twinstr, &GENUS, { 191, 151, 77, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 25, XSIMD_STRING("t3bv_25"), twinstr, &GENUS, { 191, 151, 77, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3bv_25) (planner *p) {
      X(kdft_dit_register) (p, t3bv_25, &desc);
@@ -98,7 +98,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 5, XSIMD_STRING("t3bv_5"), twinstr, &GENUS, { 13, 14, 9, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 5, XSIMD_STRING("t3bv_5"), twinstr, &GENUS, { 13, 14, 9, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3bv_5) (planner *p) {
      X(kdft_dit_register) (p, t3bv_5, &desc);
@@ -178,7 +178,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 5, XSIMD_STRING("t3bv_5"), twinstr, &GENUS, { 19, 15, 3, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 5, XSIMD_STRING("t3bv_5"), twinstr, &GENUS, { 19, 15, 3, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3bv_5) (planner *p) {
      X(kdft_dit_register) (p, t3bv_5, &desc);
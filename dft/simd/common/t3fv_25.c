@@ -530,7 +530,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 25, XSIMD_STRING("t3fv_25"), twinstr, &GENUS, { 87, 100, 181, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 25, XSIMD_STRING("t3fv_25"), twinstr, &GENUS, { 87, 100, 181, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3fv_25) (planner *p) {
      X(kdft_dit_register) (p, t3fv_25, &desc);
@@ -950,7 +950,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 25, XSIMD_STRING("t3fv_25"), twinstr, &GENUS, { 190, 150, 78, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 25, XSIMD_STRING("t3fv_25"), twinstr, &GENUS, { 190, 150, 78, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3fv_25) (planner *p) {
      X(kdft_dit_register) (p, t3fv_25, &desc);
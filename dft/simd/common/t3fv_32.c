@@ -463,7 +463,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 32, XSIMD_STRING("t3fv_32"), twinstr, &GENUS, { 146, 116, 98, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 32, XSIMD_STRING("t3fv_32"), twinstr, &GENUS, { 146, 116, 98, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3fv_32) (planner *p) {
      X(kdft_dit_register) (p, t3fv_32, &desc);
@@ -908,7 +908,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 32, XSIMD_STRING("t3fv_32"), twinstr, &GENUS, { 228, 142, 16, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 32, XSIMD_STRING("t3fv_32"), twinstr, &GENUS, { 228, 142, 16, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3fv_32) (planner *p) {
      X(kdft_dit_register) (p, t3fv_32, &desc);
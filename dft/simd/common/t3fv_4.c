@@ -77,7 +77,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 4, XSIMD_STRING("t3fv_4"), twinstr, &GENUS, { 10, 8, 2, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, XSIMD_STRING("t3fv_4"), twinstr, &GENUS, { 10, 8, 2, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3fv_4) (planner *p) {
      X(kdft_dit_register) (p, t3fv_4, &desc);
@@ -136,7 +136,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 4, XSIMD_STRING("t3fv_4"), twinstr, &GENUS, { 12, 8, 0, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 4, XSIMD_STRING("t3fv_4"), twinstr, &GENUS, { 12, 8, 0, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3fv_4) (planner *p) {
      X(kdft_dit_register) (p, t3fv_4, &desc);
@@ -121,7 +121,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 8, XSIMD_STRING("t3fv_8"), twinstr, &GENUS, { 27, 22, 10, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, XSIMD_STRING("t3fv_8"), twinstr, &GENUS, { 27, 22, 10, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3fv_8) (planner *p) {
      X(kdft_dit_register) (p, t3fv_8, &desc);
@@ -224,7 +224,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const ct_desc desc = { 8, XSIMD_STRING("t3fv_8"), twinstr, &GENUS, { 37, 24, 0, 0 }, 0, 0, 0 };
+static const ct_desc desc = { 8, XSIMD_STRING("t3fv_8"), twinstr, &GENUS, { 37, 24, 0, 0, 0 }, 0, 0, 0 };
 
 void XSIMD(codelet_t3fv_8) (planner *p) {
      X(kdft_dit_register) (p, t3fv_8, &desc);
@@ -458,4 +458,4 @@ let imag_of s = "c_im(" ^ s ^ ")"
 
 let flops_of f =
   let (add, mul, fma) = count_flops f in
-  Printf.sprintf "{ %d, %d, %d, 0 }" add mul fma
+  Printf.sprintf "{ %d, %d, %d, 0, 0 }" add mul fma
@@ -20,12 +20,31 @@
 
 #include "kernel/ifftw.h"
 
+#ifdef THREAD_LOCAL
+static THREAD_LOCAL size_t malloc_bytes = 0;
+#endif
+
+size_t X(thread_malloc_bytes)(void)
+{
+#ifdef THREAD_LOCAL
+     return malloc_bytes;
+#else
+     return 0;
+#endif
+}
+
 void *X(malloc_plain)(size_t n)
 {
      void *p;
      if (n == 0)
           n = 1;
-     p = X(kernel_malloc)(n);
+#ifdef THREAD_LOCAL
+     malloc_bytes += n;
+#endif
+     if (n >= HUGE_PAGE_SIZE && X(arena_huge)())
+	  p = X(kernel_malloc_huge)(n);
+     else
+	  p = X(kernel_malloc)(n);
      CK(p);
 
 #ifdef MIN_ALIGNMENT
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Arenas for the small plans, problems and tensors of the planner.
+
+   A search creates and destroys thousands of these, and keeps none of
+   them.  While an arena is current in a thread, MALLOC of these tags
+   bumps a pointer in the arena, and X(arena_ifree) puts the object on
+   a free list of its size class there; X(arena_reset) then drops them
+   all at once.  Each object is preceded by one ALIGNA-sized word that
+   holds its size class.  Objects too large for a class, and those
+   allocated while no arena is current, come from X(malloc_plain).
+
+   The current arena of a thread is set by X(arena_enter) and is kept
+   in a static variable, or in thread-local storage through the hooks
+   below once the threads library is initialized. */
+
+#include "kernel/ifftw.h"
+
+#define ALIGNA 16		/* alignment of objects */
+#define MAXOBJ 512		/* larger objects are not arena'd */
+#define NCLASS (MAXOBJ / ALIGNA + 1)
+
+typedef struct achunk_s {
+     struct achunk_s *next;
+     char *end;
+} achunk;
+
+struct arena_s {
+     achunk *chunks;		/* newest (and largest) first */
+     char *top, *lim;		/* free space of chunks */
+     size_t chunksz;		/* size of the next chunk */
+     void *freel[NCLASS];	/* freed objects, by size class */
+     int live;			/* objects not freed */
+     arena *outer;		/* current when this one was entered */
+     int huge;			/* large blocks go on huge pages */
+};
+
+#define ROUNDUP(n) (((n) + (ALIGNA - 1)) & ~(size_t)(ALIGNA - 1))
+#define CHUNK_DATA(k) ((char *)(k) + ROUNDUP(sizeof(achunk)))
+
+static arena *cur = 0;
+arena *(*X(arena_get_hook))(void) = 0;
+void (*X(arena_set_hook))(arena *a) = 0;
+
+static arena *current(void)
+{
+     return X(arena_get_hook) ? X(arena_get_hook)() : cur;
+}
+
+static void set_current(arena *a)
+{
+     if (X(arena_set_hook))
+	  X(arena_set_hook)(a);
+     else
+	  cur = a;
+}
+
+arena *X(mkarena)(size_t chunksz)
+{
+     arena *a = (arena *)MALLOC(sizeof(arena), OTHER);
+     int c;
+
+     a->chunks = 0;
+     a->top = a->lim = 0;
+     a->chunksz = chunksz;
+     for (c = 0; c < NCLASS; ++c)
+	  a->freel[c] = 0;
+     a->live = 0;
+     a->outer = 0;
+     a->huge = 0;
+     return a;
+}
+
+static void free_chunks(achunk *k)
+{
+     while (k) {
+	  achunk *next = k->next;
+	  X(ifree)(k);
+	  k = next;
+     }
+}
+
+void X(arena_destroy)(arena *a)
+{
+     if (a) {
+	  A(a->live == 0);
+	  free_chunks(a->chunks);
+	  X(ifree)(a);
+     }
+}
+
+/* forget all objects, which must have been freed, keeping the largest
+   chunk for the next use */
+void X(arena_reset)(arena *a)
+{
+     achunk *k = a->chunks;
+     int c;
+
+     A(a->live == 0);
+     if (k) {
+	  free_chunks(k->next);
+	  k->next = 0;
+	  a->top = CHUNK_DATA(k);
+	  a->lim = k->end;
+     }
+     for (c = 0; c < NCLASS; ++c)
+	  a->freel[c] = 0;
+}
+
+/* bytes held by A */
+size_t X(arena_bytes)(const arena *a)
+{
+     const achunk *k;
+     size_t n = sizeof(arena);
+
+     for (k = a->chunks; k; k = k->next)
+	  n += (size_t)(k->end - (const char *)k);
+     return n;
+}
+
+/* make A current in this thread; returns the arena it replaces, to be
+   given to X(arena_leave) */
+arena *X(arena_enter)(arena *a)
+{
+     arena *prev = current();
+
+     if (a != prev) {
+	  a->outer = prev;
+	  set_current(a);
+     }
+     return prev;
+}
+
+void X(arena_leave)(arena *prev)
+{
+     arena *a = current();
+
+     if (a != prev) {
+	  a->outer = 0;
+	  set_current(prev);
+     }
+}
+
+/* while A is current, X(malloc_plain) puts blocks of a huge page or
+   more on huge pages (e.g. the twiddles and buffers that plans of
+   FFTW_HUGE_PAGES make when they wake up) */
+void X(arena_set_huge)(arena *a, int huge)
+{
+     a->huge = huge;
+}
+
+int X(arena_huge)(void)
+{
+     arena *a = current();
+     return a && a->huge;
+}
+
+static void *bump(arena *a, size_t n)
+{
+     char *p;
+
+     if ((size_t)(a->lim - a->top) < n) {
+	  size_t sz = a->chunksz;
+	  achunk *k;
+
+	  while (sz < ROUNDUP(sizeof(achunk)) + n)
+	       sz *= 2;
+	  k = (achunk *)X(malloc_plain)(sz);
+	  k->end = (char *)k + sz;
+	  k->next = a->chunks;
+	  a->chunks = k;
+	  a->chunksz = 2 * sz;
+	  a->top = CHUNK_DATA(k);
+	  a->lim = k->end;
+     }
+     p = a->top;
+     a->top += n;
+     return p;
+}
+
+void *X(arena_malloc)(size_t n)
+{
+     arena *a = current();
+     size_t c;
+     char *p;
+
+     if (!a || n > MAXOBJ)
+	  return X(malloc_plain)(n);
+
+     c = ROUNDUP(n ? n : 1) / ALIGNA;
+     if (a->freel[c]) {
+	  p = (char *)a->freel[c];
+	  a->freel[c] = *(void **)p;
+     } else {
+	  p = (char *)bump(a, (c + 1) * ALIGNA) + ALIGNA;
+	  *(size_t *)(p - ALIGNA) = c;
+     }
+     ++a->live;
+     return p;
+}
+
+static int owns(const arena *a, const char *p)
+{
+     const achunk *k;
+
+     for (k = a->chunks; k; k = k->next)
+	  if (p > (const char *)k && p < k->end)
+	       return 1;
+     return 0;
+}
+
+/* free P (if not 0), allocated by MALLOC with an arena tag */
+void X(arena_ifree)(void *p)
+{
+     arena *a;
+
+     if (!p)
+	  return;
+     for (a = current(); a; a = a->outer)
+	  if (owns(a, (const char *)p)) {
+	       size_t c = *(size_t *)((char *)p - ALIGNA);
+	       *(void **)p = a->freel[c];
+	       a->freel[c] = p;
+	       --a->live;
+	       return;
+	  }
+     X(ifree)(p);
+}
@@ -88,6 +88,16 @@ typedef ptrdiff_t INT;
 
 #define NELEM(array) ((sizeof(array) / sizeof((array)[0])))
 
+/* storage class of per-thread variables, where the compiler has one */
+#if defined(__GNUC__)
+#  define THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#  define THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L \
+ && !defined(__STDC_NO_THREADS__)
+#  define THREAD_LOCAL _Thread_local
+#endif
+
 #define FFT_SIGN (-1)  /* sign convention for forward transforms */
 extern void X(extract_reim)(int sign, R *c, R **r, R **i);
 
@@ -200,16 +210,19 @@ void *alloca(size_t);
      if (n < MAX_STACK_ALLOC) {			\
 	  STACK_MALLOC(T, p, n);		\
      } else {					\
-	  p = (T)MALLOC(n, BUFFERS);		\
+	  p = (T)X(scratch_malloc)(n);		\
      }						\
 }
 
+/* the scratch (see below) of a BUF_ALLOC of N bytes */
+#define BUF_SCRATCH(n) ((n) < MAX_STACK_ALLOC ? 0 : SCRATCH_SIZE(n))
+
 #define BUF_FREE(p, n)				\
 {						\
      if (n < MAX_STACK_ALLOC) {			\
 	  STACK_FREE(p);			\
      } else {					\
-	  X(ifree)(p);				\
+	  X(scratch_ifree)(p);			\
      }						\
 }
 
@@ -264,6 +277,13 @@ extern void X(debug)(const char *format, ...);
 /* kalloc.c: */
 extern void *X(kernel_malloc)(size_t n);
 extern void X(kernel_free)(void *p);
+extern void *X(kernel_malloc_huge)(size_t n);
+
+#define HUGE_PAGE_SIZE ((size_t) 1 << 21)
+
+/* fills a new block of huge pages, to place its pages near the threads
+   that will use them; installed by the threads library, null otherwise */
+extern void (*X(first_touch_hook))(void *p, size_t n);
 
 /*-----------------------------------------------------------------------*/
 /* alloc.c: */
@@ -289,7 +309,75 @@ IFFTW_EXTERN void X(ifree)(void *ptr);
 extern void X(ifree0)(void *ptr);
 
 IFFTW_EXTERN void *X(malloc_plain)(size_t sz);
-#define MALLOC(n, what)  X(malloc_plain)(n)
+
+/* arena.c: the planner makes and destroys small plans, problems and
+   tensors by the thousand.  While an arena is current in a thread,
+   these come from it; any that may be made while planning must be
+   freed by X(arena_ifree). */
+typedef struct arena_s arena;
+
+arena *X(mkarena)(size_t chunksz);
+void X(arena_destroy)(arena *a);
+void X(arena_reset)(arena *a);
+size_t X(arena_bytes)(const arena *a);
+arena *X(arena_enter)(arena *a);
+void X(arena_leave)(arena *prev);
+IFFTW_EXTERN void *X(arena_malloc)(size_t sz);
+IFFTW_EXTERN void X(arena_ifree)(void *ptr);
+extern arena *(*X(arena_get_hook))(void);
+extern void (*X(arena_set_hook))(arena *a);
+void X(arena_set_huge)(arena *a, int huge);
+int X(arena_huge)(void);
+
+/* scratch.c: buffers that plans allocate while they execute come
+   from the workspace current in the thread, if any, else from the
+   thread's pool, if any, else from the heap.  A plan that allocates N
+   bytes there adds SCRATCH_SIZE(N) to its scratch field, and frees in
+   the reverse order. */
+typedef struct {
+     char *base;		/* SCRATCH_ALIGN-aligned, or 0 */
+     size_t size, used;
+} scratch;
+
+#define SCRATCH_ALIGN 64
+#define SCRATCH_SIZE(n) \
+     (((size_t)(n) + (SCRATCH_ALIGN - 1)) & ~(size_t)(SCRATCH_ALIGN - 1))
+
+void X(scratch_init)(scratch *s, void *mem, size_t size);
+scratch *X(scratch_enter)(scratch *s);
+void X(scratch_leave)(scratch *prev);
+void *X(scratch_malloc)(size_t n);
+void X(scratch_ifree)(void *p);
+#ifndef THREAD_LOCAL
+extern scratch *(*X(scratch_get_hook))(void);
+extern void (*X(scratch_set_hook))(scratch *s);
+#endif
+
+/* the heap buffers that a thread frees, kept by size class for its
+   next ones; the threads library gives each thread its own */
+typedef struct scratch_pool_s scratch_pool;
+typedef struct {
+     size_t bytes;		/* in use and idle */
+     size_t peak;		/* max of bytes */
+     double hits, misses;	/* buffers served from the pool or not */
+     double trimmed;		/* idle buffers given back to the heap */
+} scratch_pool_stats;
+
+scratch_pool *X(mkscratch_pool)(void);
+void X(scratch_pool_destroy)(scratch_pool *p);
+void X(scratch_pool_flush)(scratch_pool *p);
+void X(scratch_pool_add_stats)(const scratch_pool *p, scratch_pool_stats *s);
+extern scratch_pool *(*X(scratch_pool_hook))(void);
+extern size_t X(scratch_pool_budget);
+
+#define ARENA_TAG(what) ((what) == PLANS || (what) == PROBLEMS || (what) == TENSORS)
+#define MALLOC(n, what)  \
+     (ARENA_TAG(what) ? X(arena_malloc)(n) : X(malloc_plain)(n))
+
+/* bytes allocated so far by this thread, freed or not, so that
+   differences tell what an operation allocates (0 without
+   THREAD_LOCAL) */
+size_t X(thread_malloc_bytes)(void);
 
 /*-----------------------------------------------------------------------*/
 /* low-resolution clock */
@@ -332,12 +420,17 @@ double X(elapsed_since)(const planner *plnr, const problem *p,
  * ops counter.  The total number of additions is add + fma
  * and the total number of multiplications is mul + fma.
  * Total flops = add + mul + 2 * fma
+ *
+ * thr counts the operations that threads save, by running them at the
+ * same time as others, net of the cost of the threads (negative if they
+ * cost more than they save); see threads/conf.c
  */
 typedef struct {
      double add;
      double mul;
      double fma;
      double other;
+     double thr;
 } opcnt;
 
 void X(ops_zero)(opcnt *dst);
@@ -384,9 +477,13 @@ typedef struct {
      unsigned char c[64]; /* stuff not yet processed */
      unsigned l;  /* total length.  Should be 64 bits long, but this is
 		     good enough for us */
+     md5uint w[4]; /* words not yet processed (fast mode) */
+     int fast;     /* not MD5 but the planner's fast hash */
 } md5;
 
 void X(md5begin)(md5 *p);
+void X(md5begin_fast)(md5 *p);
+void X(md5putw)(md5 *p, md5uint w);
 void X(md5putb)(md5 *p, const void *d_, size_t len);
 void X(md5puts)(md5 *p, const char *s);
 void X(md5putc)(md5 *p, unsigned char c);
@@ -395,6 +492,10 @@ void X(md5INT)(md5 *p, INT i);
 void X(md5unsigned)(md5 *p, unsigned i);
 void X(md5end)(md5 *p);
 
+/* names the fast hash in binary wisdom, which stores some of its words:
+   change it whenever the fast hash changes */
+#define MD5_FAST_ID 1
+
 /*-----------------------------------------------------------------------*/
 /* tensor.c: */
 #define STRUCT_HACK_KR
@@ -500,6 +601,11 @@ typedef struct {
      void (*zero) (const problem *ego);
      void (*print) (const problem *ego, printer *p);
      void (*destroy) (problem *ego);
+
+     /* optional: same problem on private copies of its arrays, for
+	measuring plans concurrently (see planner.c).  *buf is the
+	copy, to be freed with X(ifree) after the problem. */
+     problem *(*clone_io) (const problem *ego, R **buf);
 } problem_adt;
 
 struct problem_s {
@@ -509,6 +615,7 @@ struct problem_s {
 problem *X(mkproblem)(size_t sz, const problem_adt *adt);
 void X(problem_destroy)(problem *ego);
 problem *X(mkproblem_unsolvable)(void);
+R *X(problem_clone_arrays)(int n, R *const *in, R **out, const tensor *t);
 
 /*-----------------------------------------------------------------------*/
 /* print.c */
@@ -561,12 +668,18 @@ struct plan_s {
      double pcost;
      enum wakefulness wakefulness; /* used for debugging only */
      int could_prune_now_p;
+     arena *mem; /* holds this plan and its children, if not 0 */
+     int nthr; /* threads it runs on, at most */
+     size_t scratch; /* bytes of X(scratch_malloc), children included */
+     opcnt cldops; /* ops of the plans it made through the planner */
+     double cldcost; /* sum of their pcost, negative if unknown */
 };
 
 plan *X(mkplan)(size_t size, const plan_adt *adt);
 void X(plan_destroy_internal)(plan *ego);
 IFFTW_EXTERN void X(plan_awake)(plan *ego, enum wakefulness wakefulness);
 void X(plan_null_destroy)(plan *ego);
+void X(own_ops)(const plan *ego, opcnt *dst);
 
 /*-----------------------------------------------------------------------*/
 /* solver.c: */
@@ -725,6 +838,13 @@ typedef struct {
 
 typedef enum { COST_SUM, COST_MAX } cost_kind;
 
+/* process-wide table of blessed solutions, shared by the per-thread
+   planners of concurrent planning */
+typedef struct shtab_s shtab;
+
+/* binary wisdom images attached to a planner */
+typedef struct bwisdom_s bwisdom;
+
 struct planner_s {
      const planner_adt *adt;
      void (*hook)(struct planner_s *plnr, plan *pln, 
@@ -746,7 +866,21 @@ struct planner_s {
      hashtab htab_blessed;
      hashtab htab_unblessed;
 
+     bwisdom *bwis;       /* binary wisdom (in SHARED, if planning concurrently) */
+     shtab *shared;       /* 0 unless planning concurrently */
+     arena *mem;          /* for the objects of a search */
+     unsigned shared_gen; /* generation of SHARED mirrored in htab_blessed */
+
      int nthr;
+     int nchunk; /* blocks per thread of split loops, > 1 to steal them */
+     int cldnthr; /* max nthr of the plans made by the current solver */
+     size_t cldscratch; /* max scratch of the plans made by it */
+     opcnt cldops; /* sum of the ops of the plans made by it */
+     double cldcost; /* sum of their pcost, negative if unknown */
+     double mkcost; /* cost of the plan mkplan returned last, 0 if unknown */
+     int nmeasure; /* max concurrent measurements (1 = serial) */
+     int robust_timing; /* median of many runs instead of the minimum;
+			   2: on a pinned thread */
      flags_t flags;
 
      crude_time start_time;
@@ -763,6 +897,15 @@ struct planner_s {
 planner *X(mkplanner)(void);
 void X(planner_destroy)(planner *ego);
 
+shtab *X(mkshtab)(void);
+void X(shtab_destroy)(shtab *t);
+
+size_t X(planner_format_binary)(planner *ego, void *image, size_t nslot);
+size_t X(planner_export_binary)(planner *ego, void **image);
+int X(planner_attach_binary)(planner *ego, const void *image, size_t n,
+			     int writable,
+			     void (*release)(void *arg), void *arg);
+
 /*
   Iterate over all solvers.   Read:
  
@@ -890,6 +1033,16 @@ typedef struct twid_s {
 } twid;
 
 INT X(twiddle_length)(INT r, const tw_instr *p);
+
+/* twiddle factors and rader omegas are cached process-wide; planners
+   that run concurrently serialize access through these hooks */
+extern void (*X(lock_caches_hook))(void);
+extern void (*X(unlock_caches_hook))(void);
+#define LOCK_CACHES() \
+     do { if (X(lock_caches_hook)) X(lock_caches_hook)(); } while (0)
+#define UNLOCK_CACHES() \
+     do { if (X(unlock_caches_hook)) X(unlock_caches_hook)(); } while (0)
+
 void X(twiddle_awake)(enum wakefulness wakefulness,
 		      twid **pp, const tw_instr *instr, INT n, INT r, INT m);
 
@@ -950,8 +1103,10 @@ INT X(modulo)(INT a, INT n);
 /* rader.c: */
 typedef struct rader_tls rader_tl;
 
-void X(rader_tl_insert)(INT k1, INT k2, INT k3, R *W, rader_tl **tl);
-R *X(rader_tl_find)(INT k1, INT k2, INT k3, rader_tl *t);
+void X(rader_tl_insert)(INT k1, INT k2, INT k3, enum wakefulness wakefulness,
+			R *W, rader_tl **tl);
+R *X(rader_tl_find)(INT k1, INT k2, INT k3, enum wakefulness wakefulness,
+		    rader_tl *t);
 void X(rader_tl_delete)(R *W, rader_tl **tl);
 
 /*-----------------------------------------------------------------------*/
@@ -1017,7 +1172,41 @@ extern unsigned X(random_estimate_seed);
 #endif
 
 double X(measure_execution_time)(const planner *plnr, 
-				 plan *pln, const problem *p);
+				 plan *pln, const problem *p, double bound);
+double X(measure_awake_plan)(const planner *plnr, 
+			     plan *pln, const problem *p, double bound);
+double X(measure_ratio)(const planner *plnr,
+			plan *a, plan *b, const problem *p);
+
+/* relative precision of robust timings; plans closer than this are
+   considered equally fast */
+#define ROBUST_TIMING_TOL 0.02
+
+/* calibrated estimates (see planner.c) */
+typedef struct {
+     opcnt w;        /* time per operation of each kind, in timer units */
+     double call;    /* time per execution of a plan, apart from them */
+     unsigned nfactor;
+     double *factor; /* overhead of each solver, by slvndx */
+} costmodel;
+
+extern const costmodel *X(cost_model);
+extern void (*X(measurement_hook))(const planner *ego, unsigned slvndx,
+				   const plan *pln, const problem *p,
+				   double t);
+
+/* run f(data, i, slot) for 0 <= i < n on up to nslots threads, one
+   slot per thread; if PIN, each thread is bound to its own cpu.
+   Installed by the threads library, null otherwise. */
+typedef void (*measure_function)(void *data, int i, int slot);
+extern void (*X(measure_loop_hook))(int n, int nslots, int pin,
+				    measure_function f, void *data);
+
+/* bind the calling thread to the cpu it runs on, returning what
+   X(measure_unpin_hook) needs to give it back its affinity, or null if
+   it was not bound.  Installed by the threads library, null otherwise. */
+extern void *(*X(measure_pin_hook))(void);
+extern void (*X(measure_unpin_hook))(void *saved);
 IFFTW_EXTERN int X(ialignment_of)(R *p);
 unsigned X(hash)(const char *s);
 INT X(nbuf)(INT n, INT vl, INT maxnbuf);
@@ -138,7 +138,108 @@ void *X(kernel_malloc)(size_t n)
      return p;
 }
 
+/* Huge pages.  A block of X(kernel_malloc_huge) is a mapping of its
+   own, aligned to HUGE_PAGE_SIZE, with a header in its first
+   HUGE_HDR bytes; X(kernel_free) tells it from other blocks by the
+   offset of the pointer in its page and by the header, which is on
+   the same page as the pointer and thus readable either way. */
+#if defined(HAVE_SYS_MMAN_H) && !defined(_WIN32)
+#  include <sys/mman.h>
+#  if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#    define MAP_ANONYMOUS MAP_ANON
+#  endif
+#  if defined(MAP_ANONYMOUS)
+#    define HAVE_HUGE_MMAP 1
+#  endif
+#endif
+
+void (*X(first_touch_hook))(void *p, size_t n) = 0;
+
+#ifdef HAVE_HUGE_MMAP
+#define HUGE_HDR 64
+#define HUGE_MAGIC ((size_t) 0x68756765)
+
+typedef struct {
+     size_t len;		/* of the mapping */
+     size_t check;		/* HUGE_MAGIC ^ len */
+} huge_hdr;
+
+static char *huge_map(size_t len)
+{
+     char *p, *q;
+
+#  if defined(MAP_HUGETLB)
+     /* explicit huge pages, if the system has any reserved */
+     p = (char *) mmap(0, len, PROT_READ | PROT_WRITE,
+		       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB
+#    if defined(MAP_HUGE_SHIFT)
+		       | (21 << MAP_HUGE_SHIFT)
+#    endif
+		       , -1, 0);
+     if (p != (char *) MAP_FAILED)
+	  return p;
+#  endif
+
+     /* else transparent ones: an aligned range, advised */
+     p = (char *) mmap(0, len + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+		       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+     if (p == (char *) MAP_FAILED)
+	  return 0;
+     q = (char *) (((uintptr_t) p + HUGE_PAGE_SIZE - 1)
+		   & ~(uintptr_t) (HUGE_PAGE_SIZE - 1));
+     if (q > p)
+	  munmap(p, (size_t) (q - p));
+     munmap(q + len, (size_t) (p + HUGE_PAGE_SIZE - q));
+#  if defined(MADV_HUGEPAGE)
+     madvise(q, len, MADV_HUGEPAGE);
+#  endif
+     return q;
+}
+
+static huge_hdr *huge_of(void *p)
+{
+     huge_hdr *h = (huge_hdr *) ((char *) p - HUGE_HDR);
+
+     if (((uintptr_t) p & (HUGE_PAGE_SIZE - 1)) == HUGE_HDR
+	 && h->check == (HUGE_MAGIC ^ h->len))
+	  return h;
+     return 0;
+}
+#endif
+
+/* N bytes on huge pages where the system has them, first touched by
+   X(first_touch_hook) if any; blocks smaller than a huge page, and all
+   blocks if there is no mmap, come from X(kernel_malloc) */
+void *X(kernel_malloc_huge)(size_t n)
+{
+#ifdef HAVE_HUGE_MMAP
+     if (n >= HUGE_PAGE_SIZE && n < (size_t) -1 - 2 * HUGE_PAGE_SIZE) {
+	  size_t len = (n + HUGE_HDR + HUGE_PAGE_SIZE - 1)
+	       & ~(HUGE_PAGE_SIZE - 1);
+	  char *q = huge_map(len);
+
+	  if (q) {
+	       huge_hdr *h = (huge_hdr *) q;
+	       h->len = len;
+	       h->check = HUGE_MAGIC ^ len;
+	       if (X(first_touch_hook))
+		    X(first_touch_hook)(q + HUGE_HDR, n);
+	       return q + HUGE_HDR;
+	  }
+     }
+#endif
+     return X(kernel_malloc)(n);
+}
+
 void X(kernel_free)(void *p)
 {
+#ifdef HAVE_HUGE_MMAP
+     huge_hdr *h;
+
+     if (p && (h = huge_of(p))) {
+	  munmap(h, h->len);
+	  return;
+     }
+#endif
      real_free(p);
 }
@@ -19,18 +19,40 @@
  */
 
 #include "kernel/ifftw.h"
+#include <string.h>
 
 
+/* In fast mode, the utilities below hash words: an int or unsigned
+   is one, an INT one or two, and bytes and strings are packed four to
+   a word. */
+
 void X(md5putb)(md5 *p, const void *d_, size_t len)
 {
      size_t i;
      const unsigned char *d = (const unsigned char *)d_;
+     if (p->fast) {
+	  md5uint w = 0;
+	  for (i = 0; i < len; ++i) {
+	       w |= (md5uint)d[i] << (8 * (i % 4));
+	       if (i % 4 == 3) {
+		    X(md5putw)(p, w);
+		    w = 0;
+	       }
+	  }
+	  if (len % 4)
+	       X(md5putw)(p, w);
+	  return;
+     }
      for (i = 0; i < len; ++i)
 	  X(md5putc)(p, d[i]);
 }
 
 void X(md5puts)(md5 *p, const char *s)
 {
+     if (p->fast) {
+	  X(md5putb)(p, s, strlen(s) + 1);
+	  return;
+     }
      /* also hash final '\0' */
      do {
 	  X(md5putc)(p, (unsigned)(*s & 0xFF));
@@ -39,16 +61,26 @@ void X(md5puts)(md5 *p, const char *s)
 
 void X(md5int)(md5 *p, int i)
 {
-     X(md5putb)(p, &i, sizeof(i));
+     if (p->fast)
+	  X(md5putw)(p, (md5uint)(unsigned)i);
+     else
+	  X(md5putb)(p, &i, sizeof(i));
 }
 
 void X(md5INT)(md5 *p, INT i)
 {
-     X(md5putb)(p, &i, sizeof(i));
+     if (p->fast) {
+	  X(md5putw)(p, (md5uint)(unsigned)i);
+	  if (sizeof(INT) > 4)
+	       X(md5putw)(p, (md5uint)(unsigned)((i >> 16) >> 16));
+     } else
+	  X(md5putb)(p, &i, sizeof(i));
 }
 
 void X(md5unsigned)(md5 *p, unsigned i)
 {
-     X(md5putb)(p, &i, sizeof(i));
+     if (p->fast)
+	  X(md5putw)(p, (md5uint)i);
+     else
+	  X(md5putb)(p, &i, sizeof(i));
 }
-
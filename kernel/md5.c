@@ -24,6 +24,9 @@
 
    Optimized for small code size, not speed.  Works as long as
    sizeof(md5uint) >= 4.
+
+   The same md5 object also computes the planner's fast hash, see
+   X(md5begin_fast) below.
 */
 
 #include "kernel/ifftw.h"
@@ -114,10 +117,103 @@ void X(md5begin)(md5 *p)
      p->s[2] = 0x98badcfe;
      p->s[3] = 0x10325476;
      p->l = 0;
+     p->fast = 0;
+}
+
+/* The fast hash keys the planner's in-memory tables, which it probes
+   for every subproblem; wisdom files need MD5, which the planner
+   computes only for the solutions it blesses.  It takes whole words,
+   not bytes, into four 32-bit lanes mixed in the manner of
+   MurmurHash3 (x86_128): a block of four words costs a dozen
+   multiplies, against MD5's 64 rounds per 16 words fed one byte at a
+   time.  It is not meant to resist an adversary.  Binary wisdom keeps
+   two of its words per entry, for its filter, and records MD5_FAST_ID
+   with them: the id must change whenever the hash does, so that images
+   of another hash are probed without their filter. */
+#define M32(a) ((a) & (md5uint)0xffffffffUL)
+#define ROL32(a, s) M32(((a) << (s)) | (M32(a) >> (32 - (s))))
+
+static const md5uint fastk[4] = {
+     0x239b961b, 0xab0e9789, 0x38b34ae5, 0xa1e38b93
+};
+static const md5uint fasth[4] = {
+     0x561ccd1b, 0x0bcaa747, 0x96cd1c35, 0x32ac3b17
+};
+static const char fastr[2][4] = { { 15, 16, 17, 18 }, { 19, 17, 15, 13 } };
+
+static void fastblock(md5sig h, const md5uint *w)
+{
+     md5uint k[4];
+     int i;
+
+     /* independent lanes */
+     for (i = 0; i < 4; ++i) {
+	  k[i] = M32(w[i] * fastk[i]);
+	  k[i] = ROL32(k[i], fastr[0][i]);
+	  k[i] = M32(k[i] * fastk[(i + 1) & 3]);
+     }
+
+     for (i = 0; i < 4; ++i) {
+	  h[i] ^= k[i];
+	  h[i] = ROL32(h[i], fastr[1][i]);
+	  h[i] = M32(h[i] + h[(i + 1) & 3]);
+	  h[i] = M32(h[i] * 5 + fasth[i]);
+     }
+}
+
+static md5uint fmix(md5uint h)
+{
+     h ^= h >> 16;
+     h = M32(h * 0x85ebca6b);
+     h ^= h >> 13;
+     h = M32(h * 0xc2b2ae35);
+     return h ^ (h >> 16);
+}
+
+void X(md5begin_fast)(md5 *p)
+{
+     p->s[0] = p->s[1] = p->s[2] = p->s[3] = 0;
+     p->l = 0;
+     p->fast = 1;
+}
+
+/* a word of 32 bits; in MD5 mode, its bytes in little-endian order */
+void X(md5putw)(md5 *p, md5uint w)
+{
+     if (p->fast) {
+	  p->w[p->l % 4] = M32(w);
+	  if (((++p->l) % 4) == 0) fastblock(p->s, p->w);
+     } else {
+	  int i;
+	  for (i = 0; i < 4; ++i, w >>= 8)
+	       X(md5putc)(p, (unsigned char)(w & 0xFF));
+     }
+}
+
+static void fastend(md5 *p)
+{
+     md5uint *h = p->s;
+     unsigned n = p->l;
+
+     while ((p->l % 4) != 0)
+	  p->w[p->l++ % 4] = 0;
+     if (n % 4)
+	  fastblock(h, p->w);
+
+     h[0] ^= n; h[1] ^= n; h[2] ^= n; h[3] ^= n;
+     h[0] = M32(h[0] + h[1] + h[2] + h[3]);
+     h[1] = M32(h[1] + h[0]); h[2] = M32(h[2] + h[0]); h[3] = M32(h[3] + h[0]);
+     h[0] = fmix(h[0]); h[1] = fmix(h[1]); h[2] = fmix(h[2]); h[3] = fmix(h[3]);
+     h[0] = M32(h[0] + h[1] + h[2] + h[3]);
+     h[1] = M32(h[1] + h[0]); h[2] = M32(h[2] + h[0]); h[3] = M32(h[3] + h[0]);
 }
 
 void X(md5putc)(md5 *p, unsigned char c)
 {
+     if (p->fast) {
+	  X(md5putw)(p, c);
+	  return;
+     }
      p->c[p->l % 64] = c;
      if (((++p->l) % 64) == 0) doblock(p->s, p->c);
 }
@@ -126,6 +222,11 @@ void X(md5end)(md5 *p)
 {
      unsigned l, i;
 
+     if (p->fast) {
+	  fastend(p);
+	  return;
+     }
+
      l = 8 * p->l; /* length before padding, in bits */
 
      /* rfc 1321 section 3.1: padding */
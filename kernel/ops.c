@@ -23,7 +23,7 @@
 
 void X(ops_zero)(opcnt *dst)
 {
-     dst->add = dst->mul = dst->fma = dst->other = 0;
+     dst->add = dst->mul = dst->fma = dst->other = dst->thr = 0;
 }
 
 void X(ops_cpy)(const opcnt *src, opcnt *dst)
@@ -43,6 +43,7 @@ void X(ops_madd)(INT m, const opcnt *a, const opcnt *b, opcnt *dst)
      dst->mul = m * a->mul + b->mul;
      dst->fma = m * a->fma + b->fma;
      dst->other = m * a->other + b->other;
+     dst->thr = m * a->thr + b->thr;
 }
 
 void X(ops_add)(const opcnt *a, const opcnt *b, opcnt *dst)
@@ -35,19 +35,50 @@ plan *X(mkplan)(size_t size, const plan_adt *adt)
      p->pcost = 0.0;
      p->wakefulness = SLEEPY;
      p->could_prune_now_p = 0;
+     p->mem = 0;
+     p->nthr = 1;
+     p->scratch = 0;
+     X(ops_zero)(&p->cldops);
+     p->cldcost = 0.0;
      
      return p;
 }
 
+static double nonneg(double x)
+{
+     return x > 0 ? x : 0;
+}
+
+/* the ops of EGO that are not those of the plans it made through the
+   planner (cldops); a count that comes out negative, because a child
+   was made and then dropped, counts as none.  The saving of threads
+   (thr) is the plan's own, whatever its sign. */
+void X(own_ops)(const plan *ego, opcnt *dst)
+{
+     dst->add = nonneg(ego->ops.add - ego->cldops.add);
+     dst->mul = nonneg(ego->ops.mul - ego->cldops.mul);
+     dst->fma = nonneg(ego->ops.fma - ego->cldops.fma);
+     dst->other = nonneg(ego->ops.other - ego->cldops.other);
+     dst->thr = ego->ops.thr - ego->cldops.thr;
+}
+
 /*
  * destroy a plan
  */
 void X(plan_destroy_internal)(plan *ego)
 {
      if (ego) {
+	  arena *mem = ego->mem, *prev = 0;
+
 	  A(ego->wakefulness == SLEEPY);
+	  if (mem)
+	       prev = X(arena_enter)(mem);
           ego->adt->destroy(ego);
-	  X(ifree)(ego);
+	  X(arena_ifree)(ego);
+	  if (mem) {
+	       X(arena_leave)(prev);
+	       X(arena_destroy)(mem);
+	  }
      }
 }
 
@@ -61,10 +92,16 @@ void X(plan_null_destroy)(plan *ego)
 void X(plan_awake)(plan *ego, enum wakefulness wakefulness)
 {
      if (ego) {
+	  arena *prev = 0;
+
 	  A(((wakefulness == SLEEPY) ^ (ego->wakefulness == SLEEPY)));
 	  
+	  if (ego->mem)
+	       prev = X(arena_enter)(ego->mem);
 	  ego->adt->awake(ego, wakefulness);
 	  ego->wakefulness = wakefulness;
+	  if (ego->mem)
+	       X(arena_leave)(prev);
      }
 }
 
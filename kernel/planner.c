@@ -167,11 +167,19 @@ static unsigned h2(const hashtab *ht, const md5sig s)
      return h;
 }
 
-static void md5hash(md5 *m, const problem *p, const planner *plnr)
+/* The planner keys its tables by the fast hash of problems, and
+   wisdom by their MD5 (see md5.c). */
+static void md5hash(md5 *m, const problem *p, const planner *plnr,
+		    int wisdom)
 {
-     X(md5begin)(m);
+     if (wisdom)
+	  X(md5begin)(m);
+     else
+	  X(md5begin_fast)(m);
      X(md5unsigned)(m, sizeof(R)); /* so we don't mix different precisions */
      X(md5int)(m, plnr->nthr);
+     if (plnr->nchunk > 1)
+	  X(md5int)(m, plnr->nchunk);
      p->adt->hash(p, m);
      X(md5end)(m);
 }
@@ -186,6 +194,30 @@ static void sigcpy(const md5sig a, md5sig b)
      b[0] = a[0]; b[1] = a[1]; b[2] = a[2]; b[3] = a[3];
 }
 
+/* the signatures of the problem being planned: M keys the tables, and
+   W, computed when first needed, keys wisdom */
+typedef struct {
+     md5 m, w;
+     int have_w;
+     const problem *p;
+} psig;
+
+static void psig_init(psig *sg, const problem *p, const planner *plnr)
+{
+     md5hash(&sg->m, p, plnr, 0);
+     sg->have_w = 0;
+     sg->p = p;
+}
+
+static const md5uint *wsig(const planner *plnr, psig *sg)
+{
+     if (!sg->have_w) {
+	  md5hash(&sg->w, sg->p, plnr, 1);
+	  sg->have_w = 1;
+     }
+     return sg->w.s;
+}
+
 /*
   memoization routines :
 */
@@ -197,7 +229,9 @@ static void sigcpy(const md5sig a, md5sig b)
 */
 struct solution_s {
      md5sig s;
+     md5sig w; /* in htab_blessed only */
      flags_t flags;
+     double pcost; /* of the plan found, if searched here; else 0 */
 };
 
 static solution *htab_lookup(hashtab *ht, const md5sig s, 
@@ -236,16 +270,8 @@ static solution *htab_lookup(hashtab *ht, const md5sig s,
      return best;
 }
 
-static solution *hlookup(planner *ego, const md5sig s, 
-			 const flags_t *flagsp)
-{
-     solution *sol = htab_lookup(&ego->htab_blessed, s, flagsp);
-     if (!sol) sol = htab_lookup(&ego->htab_unblessed, s, flagsp);
-     return sol;
-}
-
-static void fill_slot(hashtab *ht, const md5sig s, const flags_t *flagsp,
-		      unsigned slvndx, solution *slot)
+static void fill_slot(hashtab *ht, const md5sig s, const md5uint *w,
+		      const flags_t *flagsp, unsigned slvndx, solution *slot)
 {
      ++ht->insert;
      ++ht->nelem;
@@ -255,11 +281,14 @@ static void fill_slot(hashtab *ht, const md5sig s, const flags_t *flagsp,
      slot->flags.timelimit_impatience = flagsp->timelimit_impatience;
      slot->flags.hash_info |= H_VALID | H_LIVE;
      SLVNDX(slot) = slvndx;
+     slot->pcost = 0.0;
 
      /* keep this check enabled in case we add so many solvers
 	that the bitfield overflows */
      CK(SLVNDX(slot) == slvndx);     
      sigcpy(s, slot->s);
+     if (w)
+	  sigcpy(w, slot->w);
 }
 
 static void kill_slot(hashtab *ht, solution *slot)
@@ -270,8 +299,8 @@ static void kill_slot(hashtab *ht, solution *slot)
      slot->flags.hash_info = H_VALID;
 }
 
-static void hinsert0(hashtab *ht, const md5sig s, const flags_t *flagsp, 
-		     unsigned slvndx)
+static solution *hinsert0(hashtab *ht, const md5sig s, const md5uint *w,
+			  const flags_t *flagsp, unsigned slvndx)
 {
      solution *l;
      unsigned g, h = h1(ht, s), d = h2(ht, s); 
@@ -286,7 +315,8 @@ static void hinsert0(hashtab *ht, const md5sig s, const flags_t *flagsp,
 	  A((g + d) % ht->hashsiz != h);
      }
 
-     fill_slot(ht, s, flagsp, slvndx, l);
+     fill_slot(ht, s, w, flagsp, slvndx, l);
+     return l;
 }
 
 static void rehash(hashtab *ht, unsigned nsiz)
@@ -311,7 +341,7 @@ static void rehash(hashtab *ht, unsigned nsiz)
      for (h = 0; h < osiz; ++h) {
 	  solution *l = osol + h;
 	  if (LIVEP(l))
-	       hinsert0(ht, l->s, &l->flags, SLVNDX(l));
+	       hinsert0(ht, l->s, l->w, &l->flags, SLVNDX(l))->pcost = l->pcost;
      }
 
      X(ifree0)(osol);
@@ -344,8 +374,8 @@ static void hshrink(hashtab *ht)
 }
 #endif
 
-static void htab_insert(hashtab *ht, const md5sig s, const flags_t *flagsp,
-			unsigned slvndx)
+static solution *htab_insert(hashtab *ht, const md5sig s, const md5uint *w,
+			     const flags_t *flagsp, unsigned slvndx)
 {
      unsigned g, h = h1(ht, s), d = h2(ht, s);
      solution *first = 0;
@@ -378,19 +408,806 @@ static void htab_insert(hashtab *ht, const md5sig s, const flags_t *flagsp,
 
      if (first) {
 	  /* overwrite FIRST */
-	  fill_slot(ht, s, flagsp, slvndx, first);
+	  fill_slot(ht, s, w, flagsp, slvndx, first);
+	  return first;
      } else {
 	  /* create a new entry */
  	  hgrow(ht);
-	  hinsert0(ht, s, flagsp, slvndx);
+	  return hinsert0(ht, s, w, flagsp, slvndx);
+     }
+}
+
+static void htab_destroy(hashtab *ht)
+{
+     X(ifree)(ht->solutions);
+     ht->solutions = 0;
+     ht->nelem = 0U;
+}
+
+static void mkhashtab(hashtab *ht)
+{
+     ht->nrehash = 0;
+     ht->succ_lookup = ht->lookup = ht->lookup_iter = 0;
+     ht->insert = ht->insert_iter = ht->insert_unknown = 0;
+
+     ht->solutions = 0;
+     ht->hashsiz = ht->nelem = 0U;
+     hgrow(ht);			/* so that hashsiz > 0 */
+}
+
+/*
+  binary wisdom:
+
+  A file image of blessed solutions that planners query in place, so
+  that importing it costs the same however much wisdom it holds.
+  Layout, in native byte order:
+
+     bwis_header
+     bwis_entry slot[nslot]   open addressing on s[0], linear probing;
+                              empty slots have u == BWIS_EMPTY
+     md5uint filter[nslot]    Bloom filter of the entries' fast hash
+
+  Solutions name their solver by slvndx, which is meaningful because
+  the configuration signature of the planner must match the one in the
+  header.  Images are chained: each import, binary or text, adds one.
+
+  Entries are keyed by MD5, which costs much more than the fast hash
+  that keys the planner's tables, so a planner probes an image only if
+  the filter says that it may hold the problem, and computes the MD5
+  only then.  Each entry keeps two words of the fast hash (f), from
+  which the filter is rebuilt when the entry is copied.  Text wisdom
+  names problems by MD5 alone: an image holding such entries counts
+  them in unfiltered, and is always probed.  So is an image whose
+  fasthash is not our MD5_FAST_ID, whose f words are then ignored, and
+  to which we publish unfiltered entries.
+
+  A writable image is a segment of memory shared by several processes,
+  to which each of them publishes the solutions it blesses.  A writer
+  claims an empty slot by swapping its u to BWIS_BUSY, fills it, and
+  then stores the real u; readers skip busy slots.  There are no
+  locks, so a process dying at any point costs at most one slot.
+*/
+#define BWIS_MAGIC "FFTWbwis"
+#define BWIS_VERSION 3
+#define BWIS_BYTEORDER 0x01020304U
+#define BWIS_EMPTY 0xffffffffU	/* not a valid flags.u */
+#define BWIS_BUSY 0xfffffffeU	/* nor is this */
+
+typedef struct {
+     char magic[8];
+     md5uint version, byteorder;
+     md5uint config[4];
+     md5uint nslot, nentry;
+     md5uint unfiltered;	/* entries not in the filter */
+     md5uint fasthash;		/* MD5_FAST_ID of f and the filter */
+} bwis_header;
+
+typedef struct {
+     md5sig s;
+     md5uint l, u, timelimit_impatience, slvndx;
+     md5uint f[2];		/* of the fast hash, or 0 if unknown */
+} bwis_entry;
+
+struct bwisdom_s {
+     const bwis_header *hdr;
+     const bwis_entry *slot;
+     const md5uint *filter;
+     int filtered;		/* fasthash is ours */
+     int writable;
+     void (*release)(void *arg);
+     void *arg;
+     struct bwisdom_s *next;	/* older image */
+     struct bwisdom_s *retired;
+};
+
+static void bwis_release(bwisdom *b)
+{
+     while (b) {
+	  bwisdom *next = b->next;
+	  if (b->release)
+	       b->release(b->arg);
+	  X(ifree)(b);
+	  b = next;
+     }
+}
+
+/*
+  shared wisdom:
+
+  When planning concurrently, every thread has its own planner, and
+  blessed solutions are also published to a process-wide table so that
+  a solution found by one thread is wisdom for all.  Lookups take no
+  lock.  The table is an open-addressing array of pointers to immutable
+  entries; an insertion claims an empty slot, or replaces an entry that
+  it subsumes, with compare-and-swap, so threads that miss plan in
+  parallel and publish without waiting for one another.  Growing the
+  table freezes each slot of the old array (MOVED) before copying it.
+  A lookup that races with a resize may miss, which only costs a
+  search.
+
+  Replaced entries and arrays, and forgotten images, may still be in use
+  by a concurrent operation, so they are retired rather than freed.
+  Every operation on the table counts itself, from shenter to shleave,
+  in the active count of the current phase.  When there is retired
+  memory, the thread that leaves takes it and bumps the phase: nobody
+  who enters after that can reach it, so it is freed once the active
+  count of the old phase drops to zero, by whichever thread leaves next.
+  One reclamation is pending at a time, so retired memory lasts about
+  as long as the longest operation in progress, not until
+  X(shtab_destroy).
+
+  A planner mirrors the shared entries it uses in its own htab_blessed;
+  forgetting the shared table bumps its generation, which tells every
+  planner to drop its mirror.
+*/
+#if defined(__GNUC__)
+#  define HAVE_SHTAB 1
+#  define ALOAD(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#  define ACAS(p, o, n) __sync_bool_compare_and_swap(p, o, n)
+#  define AINC(p) __sync_fetch_and_add(p, 1)
+#  define ADEC(p) __sync_fetch_and_sub(p, 1)
+#  define ALOADU(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#  define ASTOREU(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#  define ACASU(p, o, n) __sync_bool_compare_and_swap(p, o, n)
+#  define AORU(p, v) __sync_fetch_and_or(p, v)
+#elif defined(_MSC_VER)
+#  include <intrin.h>
+#  define HAVE_SHTAB 1
+#  define ALOAD(p) (*(p)) /* volatile reads acquire under /volatile:ms */
+#  define ACAS(p, o, n) \
+     (_InterlockedCompareExchangePointer((void *volatile *)(p), n, o) == (o))
+#  define AINC(p) _InterlockedIncrement((volatile long *)(p))
+#  define ADEC(p) _InterlockedDecrement((volatile long *)(p))
+#  define ALOADU(p) (*(volatile md5uint *)(p))
+#  define ASTOREU(p, v) (*(volatile md5uint *)(p) = (v))
+#  define ACASU(p, o, n) \
+     (_InterlockedCompareExchange((volatile long *)(p), (long)(n), \
+				  (long)(o)) == (long)(o))
+#  define AORU(p, v) _InterlockedOr((volatile long *)(p), (long)(v))
+#endif
+
+#ifndef HAVE_SHTAB
+#  define ALOADU(p) (*(p)) /* read-only images only */
+#endif
+
+#ifdef HAVE_SHTAB
+
+typedef struct shentry_s {
+     md5sig s, w;
+     flags_t flags;
+     struct shentry_s *retired;
+} shentry;
+
+typedef struct sharray_s {
+     unsigned siz, used;	/* power of 2; claimed slots */
+     struct sharray_s *volatile next; /* set when growing */
+     struct sharray_s *retired;
+     void *volatile slot[1];
+} sharray;
+
+struct shtab_s {
+     sharray *volatile cur;
+     volatile unsigned gen;
+     shentry *volatile retired_entries;
+     sharray *volatile retired_arrays;
+     bwisdom *volatile bwis;		/* images, newest first */
+     bwisdom *volatile retired_bwis;	/* forgotten chains */
+
+     /* reclamation of the retired memory */
+     volatile unsigned phase;
+     volatile unsigned active[2];	/* operations, by parity of phase */
+     volatile unsigned reclaiming;	/* owns the pending lists */
+     volatile int pending;		/* waiting for active[pending_phase] */
+     unsigned pending_phase;
+     shentry *pending_entries;
+     sharray *pending_arrays;
+     bwisdom *pending_bwis;
+};
+
+static char moved_mark, tomb_mark;
+#define MOVED ((void *) &moved_mark)
+#define TOMB ((void *) &tomb_mark)
+
+static sharray *mksharray(unsigned siz)
+{
+     unsigned i;
+     sharray *a = (sharray *)MALLOC(sizeof(sharray) 
+				    + (siz - 1) * sizeof(void *), HASHT);
+     a->siz = siz;
+     a->used = 0;
+     a->next = 0;
+     a->retired = 0;
+     for (i = 0; i < siz; ++i)
+	  a->slot[i] = 0;
+     return a;
+}
+
+shtab *X(mkshtab)(void)
+{
+     shtab *t = (shtab *)MALLOC(sizeof(shtab), HASHT);
+     t->cur = mksharray(256);
+     t->gen = 0;
+     t->retired_entries = 0;
+     t->retired_arrays = 0;
+     t->bwis = 0;
+     t->retired_bwis = 0;
+     t->phase = 0;
+     t->active[0] = t->active[1] = 0;
+     t->reclaiming = 0;
+     t->pending = 0;
+     t->pending_phase = 0;
+     t->pending_entries = 0;
+     t->pending_arrays = 0;
+     t->pending_bwis = 0;
+     return t;
+}
+
+static void free_entries(shentry *e)
+{
+     while (e) {
+	  shentry *next = e->retired;
+	  X(ifree)(e);
+	  e = next;
+     }
+}
+
+static void free_arrays(sharray *a)
+{
+     while (a) {
+	  sharray *next = a->retired;
+	  X(ifree)(a);
+	  a = next;
+     }
+}
+
+static void free_bwis(bwisdom *b)
+{
+     while (b) {
+	  bwisdom *next = b->retired;
+	  bwis_release(b);
+	  b = next;
+     }
+}
+
+void X(shtab_destroy)(shtab *t)
+{
+     sharray *a = t->cur;
+     unsigned i;
+
+     /* no operations may be in progress */
+     for (i = 0; i < a->siz; ++i)
+	  if (a->slot[i] && a->slot[i] != TOMB && a->slot[i] != MOVED)
+	       X(ifree)(a->slot[i]);
+     X(ifree)(a);
+     free_arrays(t->retired_arrays);
+     free_entries(t->retired_entries);
+     bwis_release(t->bwis);
+     free_bwis(t->retired_bwis);
+     free_arrays(t->pending_arrays);
+     free_entries(t->pending_entries);
+     free_bwis(t->pending_bwis);
+     X(ifree)(t);
+}
+
+/* take the list at P, atomically */
+static void *take_list(void *volatile *p)
+{
+     void *x;
+     do
+	  x = ALOAD(p);
+     while (x && !ACAS(p, x, 0));
+     return x;
+}
+
+/* free the pending memory if its phase is over, then make the retired
+   memory pending; no-op if another thread is at it */
+static void shreclaim(shtab *t)
+{
+     if (!ACASU(&t->reclaiming, 0, 1))
+	  return;
+     if (t->pending) {
+	  if (ALOADU(&t->active[t->pending_phase & 1]))
+	       goto done;
+	  free_arrays(t->pending_arrays);
+	  free_entries(t->pending_entries);
+	  free_bwis(t->pending_bwis);
+	  t->pending_entries = 0;
+	  t->pending_arrays = 0;
+	  t->pending_bwis = 0;
+	  t->pending = 0;
+     }
+     if (ALOAD(&t->retired_entries) || ALOAD(&t->retired_arrays)
+	 || ALOAD(&t->retired_bwis)) {
+	  t->pending_entries =
+	       (shentry *) take_list((void *volatile *) &t->retired_entries);
+	  t->pending_arrays =
+	       (sharray *) take_list((void *volatile *) &t->retired_arrays);
+	  t->pending_bwis =
+	       (bwisdom *) take_list((void *volatile *) &t->retired_bwis);
+	  t->pending_phase = ALOADU(&t->phase);
+	  t->pending = 1;
+	  AINC(&t->phase);
+     }
+ done:
+     ASTOREU(&t->reclaiming, 0);
+}
+
+/* an operation on T begins; returns its phase, for shleave */
+static unsigned shenter(shtab *t)
+{
+     unsigned phase;
+
+     if (!t)
+	  return 0;
+     for (;;) {
+	  phase = ALOADU(&t->phase);
+	  AINC(&t->active[phase & 1]);
+	  if (ALOADU(&t->phase) == phase)
+	       return phase;
+	  ADEC(&t->active[phase & 1]); /* it moved on: count in the new one */
      }
 }
 
-static void hinsert(planner *ego, const md5sig s, const flags_t *flagsp, 
-		    unsigned slvndx)
+static void shleave(shtab *t, unsigned phase)
 {
-     htab_insert(BLISS(*flagsp) ? &ego->htab_blessed : &ego->htab_unblessed,
-		 s, flagsp, slvndx );
+     if (!t)
+	  return;
+     ADEC(&t->active[phase & 1]);
+     if (t->pending || ALOAD(&t->retired_entries) 
+	 || ALOAD(&t->retired_arrays) || ALOAD(&t->retired_bwis))
+	  shreclaim(t);
+}
+
+static void retire_entry(shtab *t, shentry *e)
+{
+     do 
+	  e->retired = ALOAD(&t->retired_entries);
+     while (!ACAS(&t->retired_entries, e->retired, e));
+}
+
+static void retire_array(shtab *t, sharray *a)
+{
+     do 
+	  a->retired = ALOAD(&t->retired_arrays);
+     while (!ACAS(&t->retired_arrays, a->retired, a));
+}
+
+/* put E in the first free slot of A (or of its successor) */
+static void shcopy(sharray *a, shentry *e)
+{
+     unsigned g = e->s[0] & (a->siz - 1), n;
+
+     for (n = 0; n < a->siz; g = (g + 1) & (a->siz - 1), ++n) {
+	  void *x = ALOAD(&a->slot[g]);
+	  if (x == MOVED) {
+	       /* A is growing too; chase it.  An entry copied behind
+		  the grower is lost, i.e. forgotten */
+	       shcopy(ALOAD(&a->next), e);
+	       return;
+	  }
+	  if (!x && ACAS(&a->slot[g], 0, e)) {
+	       AINC(&a->used);
+	       return;
+	  }
+     }
+}
+
+/* move every entry of A into a twice larger array, then install it */
+static void shgrow(shtab *t, sharray *a)
+{
+     sharray *na = ALOAD(&a->next);
+     unsigned i;
+
+     if (!na) {
+	  na = mksharray(2 * a->siz);
+	  if (!ACAS(&a->next, 0, na)) {
+	       X(ifree)(na);
+	       na = ALOAD(&a->next);
+	  }
+     }
+
+     for (i = 0; i < a->siz; ++i) {
+	  for (;;) {
+	       void *x = ALOAD(&a->slot[i]);
+	       if (x == MOVED)
+		    break;
+	       if (ACAS(&a->slot[i], x, MOVED)) {
+		    if (x && x != TOMB)
+			 shcopy(na, (shentry *)x);
+		    break;
+	       }
+	  }
+     }
+
+     if (ACAS(&t->cur, a, na))
+	  retire_array(t, a);
+}
+
+/* the current array, with no resize in progress */
+static sharray *shsettle(shtab *t)
+{
+     sharray *a;
+     while (ALOAD(&(a = ALOAD(&t->cur))->next))
+	  shgrow(t, a);
+     return a;
+}
+
+static int shtab_lookup(shtab *t, const md5sig s, const flags_t *flagsp,
+			flags_t *result, md5sig w)
+{
+     sharray *a = ALOAD(&t->cur);
+     shentry *best;
+     unsigned g, n;
+
+ again:
+     best = 0;
+     g = s[0] & (a->siz - 1);
+     for (n = 0; n < a->siz; g = (g + 1) & (a->siz - 1), ++n) {
+	  void *x = ALOAD(&a->slot[g]);
+	  shentry *e;
+	  if (!x)
+	       break;
+	  if (x == MOVED) {
+	       a = ALOAD(&a->next);
+	       goto again;
+	  }
+	  if (x == TOMB)
+	       continue;
+	  e = (shentry *)x;
+	  if (md5eq(s, e->s)
+	      && subsumes(&e->flags, e->flags.slvndx, flagsp)
+	      && (!best || LEQ(e->flags.u, best->flags.u)))
+	       best = e;
+     }
+
+     if (best) {
+	  *result = best->flags;
+	  sigcpy(best->w, w);
+     }
+     return best != 0;
+}
+
+static void shtab_insert(shtab *t, const md5sig s, const md5sig w,
+			 const flags_t *flagsp, unsigned slvndx)
+{
+     shentry *ne = (shentry *)MALLOC(sizeof(shentry), HASHT);
+     int placed;
+
+     sigcpy(s, ne->s);
+     sigcpy(w, ne->w);
+     ne->flags = *flagsp;
+     ne->flags.slvndx = slvndx;
+     ne->flags.hash_info = BLESSING;
+
+ retry:
+     {
+	  sharray *a = ALOAD(&t->cur);
+	  unsigned g = s[0] & (a->siz - 1), n;
+
+	  if (4 * (ALOAD(&a->used) + 1) > 3 * a->siz) {
+	       shgrow(t, a);
+	       goto retry;
+	  }
+
+	  /* replace the first entry subsumed by NE, tombstone the others,
+	     and claim an empty slot if nothing was replaced */
+	  placed = 0;
+	  for (n = 0; n < a->siz; ) {
+	       void *x = ALOAD(&a->slot[g]);
+	       if (x == MOVED) {
+		    shgrow(t, a);
+		    if (placed) 
+			 return; /* NE was copied by the grower */
+		    goto retry;
+	       }
+	       if (!x) {
+		    if (placed) 
+			 return;
+		    if (ACAS(&a->slot[g], 0, ne)) {
+			 AINC(&a->used);
+			 return;
+		    }
+		    continue; /* lost the slot; look at it again */
+	       }
+	       if (x != TOMB) {
+		    shentry *e = (shentry *)x;
+		    if (e != ne && md5eq(s, e->s)
+			&& subsumes(&ne->flags, slvndx, &e->flags)) {
+			 if (!ACAS(&a->slot[g], x, placed ? TOMB : (void *)ne))
+			      continue;
+			 placed = 1;
+			 retire_entry(t, e);
+		    }
+	       }
+	       g = (g + 1) & (a->siz - 1);
+	       ++n;
+	  }
+	  if (placed)
+	       return;
+	  /* full of tombstones */
+	  shgrow(t, a);
+	  goto retry;
+     }
+}
+
+static bwisdom *shtab_bwis(shtab *t)
+{
+     return ALOAD(&t->bwis);
+}
+
+static void shtab_attach(shtab *t, bwisdom *b)
+{
+     do
+	  b->next = ALOAD(&t->bwis);
+     while (!ACAS(&t->bwis, b->next, b));
+}
+
+static void shtab_forget(shtab *t)
+{
+     sharray *a = shsettle(t);
+     bwisdom *b;
+     unsigned i;
+
+     /* lookups may still be reading the images: retire the chain */
+     do
+	  b = ALOAD(&t->bwis);
+     while (b && !ACAS(&t->bwis, b, 0));
+     if (b) {
+	  do
+	       b->retired = ALOAD(&t->retired_bwis);
+	  while (!ACAS(&t->retired_bwis, b->retired, b));
+     }
+
+     AINC(&t->gen);
+     for (i = 0; i < a->siz; ++i) {
+	  for (;;) {
+	       void *x = ALOAD(&a->slot[i]);
+	       if (!x || x == TOMB || x == MOVED)
+		    break;
+	       if (ACAS(&a->slot[i], x, TOMB)) {
+		    retire_entry(t, (shentry *)x);
+		    break;
+	       }
+	  }
+     }
+}
+
+static unsigned shtab_gen(shtab *t)
+{
+     return ALOAD(&t->gen);
+}
+
+#else /* !HAVE_SHTAB */
+
+/* no atomic operations: concurrent planning is not available */
+shtab *X(mkshtab)(void) { return 0; }
+void X(shtab_destroy)(shtab *t) { UNUSED(t); }
+static int shtab_lookup(shtab *t, const md5sig s, const flags_t *flagsp,
+			flags_t *result, md5sig w)
+{
+     UNUSED(t); UNUSED(s); UNUSED(flagsp); UNUSED(result); UNUSED(w);
+     return 0;
+}
+static void shtab_insert(shtab *t, const md5sig s, const md5sig w,
+			 const flags_t *flagsp, unsigned slvndx)
+{
+     UNUSED(t); UNUSED(s); UNUSED(w); UNUSED(flagsp); UNUSED(slvndx);
+}
+static void shtab_forget(shtab *t) { UNUSED(t); }
+static unsigned shenter(shtab *t) { UNUSED(t); return 0; }
+static void shleave(shtab *t, unsigned phase) { UNUSED(t); UNUSED(phase); }
+static bwisdom *shtab_bwis(shtab *t) { UNUSED(t); return 0; }
+static void shtab_attach(shtab *t, bwisdom *b) { UNUSED(t); UNUSED(b); }
+static unsigned shtab_gen(shtab *t) { UNUSED(t); return 0; }
+
+#endif /* HAVE_SHTAB */
+
+/* drop the mirror of shared entries if the shared table was forgotten */
+static void shared_sync(planner *ego)
+{
+     unsigned gen = shtab_gen(ego->shared);
+     if (gen != ego->shared_gen) {
+	  htab_destroy(&ego->htab_blessed);
+	  mkhashtab(&ego->htab_blessed);
+	  ego->shared_gen = gen;
+     }
+}
+
+static bwisdom *bwis_of(const planner *ego)
+{
+     return ego->shared ? shtab_bwis(ego->shared) : ego->bwis;
+}
+
+/* the filter bits of an entry whose fast hash words are F */
+static md5uint bwis_bit(const bwis_header *hdr, const md5uint *f, int i)
+{
+     return f[i] & (hdr->nslot * 32 - 1);
+}
+
+#define BWIS_TEST(filter, x) ((ALOADU(&(filter)[(x) / 32]) >> ((x) % 32)) & 1)
+#define BWIS_MASK(x) ((md5uint) 1 << ((x) % 32))
+
+/* whether some image may hold the problem of fast hash FS */
+static int bwis_maybe(const bwisdom *b, const md5sig fs)
+{
+     for (; b; b = b->next) {
+	  md5uint x = bwis_bit(b->hdr, fs + 2, 0);
+	  md5uint y = bwis_bit(b->hdr, fs + 2, 1);
+	  if (!b->filtered || ALOADU(&b->hdr->unfiltered)
+	      || (BWIS_TEST(b->filter, x) && BWIS_TEST(b->filter, y)))
+	       return 1;
+     }
+     return 0;
+}
+
+/* flags of E, if E is a sane entry for EGO */
+static int bwis_flags(const planner *ego, const bwis_entry *e, flags_t *f)
+{
+     f->l = e->l;
+     f->u = e->u;
+     f->timelimit_impatience = e->timelimit_impatience;
+     f->hash_info = BLESSING;
+     f->slvndx = e->slvndx;
+     if (f->l != e->l || f->u != e->u 
+	 || f->timelimit_impatience != e->timelimit_impatience
+	 || f->slvndx != e->slvndx)
+	  return 0;
+     if (e->slvndx == INFEASIBLE_SLVNDX)
+	  return 1;
+     return e->slvndx < ego->nslvdesc && e->timelimit_impatience == 0;
+}
+
+static int bwis_lookup(const planner *ego, const bwisdom *b, 
+		       const md5sig s, const flags_t *flagsp, 
+		       flags_t *result)
+{
+     int found = 0;
+
+     for (; b; b = b->next) {
+	  md5uint mask = b->hdr->nslot - 1, g = s[0] & mask, n;
+	  for (n = 0; n <= mask; ++n, g = (g + 1) & mask) {
+	       const bwis_entry *e = b->slot + g;
+	       md5uint u = ALOADU(&e->u);
+	       flags_t f;
+	       if (u == BWIS_EMPTY)
+		    break;
+	       if (u != BWIS_BUSY && md5eq(s, e->s) && bwis_flags(ego, e, &f)
+		   && subsumes(&f, f.slvndx, flagsp)
+		   && (!found || LEQ(f.u, result->u))) {
+		    *result = f;
+		    found = 1;
+	       }
+	  }
+     }
+     return found;
+}
+
+/* whether some image holds exactly this solution */
+static int bwis_contains(const planner *ego, const bwisdom *b, 
+			 const md5sig s, const flags_t *flagsp)
+{
+     for (; b; b = b->next) {
+	  md5uint mask = b->hdr->nslot - 1, g = s[0] & mask, n;
+	  for (n = 0; n <= mask; ++n, g = (g + 1) & mask) {
+	       const bwis_entry *e = b->slot + g;
+	       md5uint u = ALOADU(&e->u);
+	       flags_t f;
+	       if (u == BWIS_EMPTY)
+		    break;
+	       if (u != BWIS_BUSY && md5eq(s, e->s) && bwis_flags(ego, e, &f)
+		   && f.l == flagsp->l && f.u == flagsp->u 
+		   && f.timelimit_impatience == flagsp->timelimit_impatience
+		   && f.slvndx == flagsp->slvndx)
+		    return 1;
+	  }
+     }
+     return 0;
+}
+
+#ifdef HAVE_SHTAB
+/* add a blessed solution to the writable images */
+static void bwis_publish(planner *ego, const md5sig s, const md5sig fs,
+			 const flags_t *flagsp, unsigned slvndx)
+{
+     bwisdom *b;
+
+     for (b = bwis_of(ego); b; b = b->next) {
+	  bwis_header *hdr = (bwis_header *) b->hdr;
+	  bwis_entry *slot = (bwis_entry *) b->slot;
+	  md5uint *filter = (md5uint *) b->filter;
+	  md5uint mask = hdr->nslot - 1, g = s[0] & mask, n;
+	  md5uint x = bwis_bit(hdr, fs + 2, 0), y = bwis_bit(hdr, fs + 2, 1);
+
+	  if (!b->writable || ALOADU(&hdr->nentry) >= hdr->nslot / 4 * 3)
+	       continue; /* read-only, or full */
+
+	  for (n = 0; n <= mask; ) {
+	       bwis_entry *e = slot + g;
+	       md5uint u = ALOADU(&e->u);
+	       if (u == BWIS_EMPTY) {
+		    if (!ACASU(&e->u, BWIS_EMPTY, BWIS_BUSY))
+			 continue; /* somebody else took it: look again */
+		    sigcpy(s, e->s);
+		    e->l = flagsp->l;
+		    e->timelimit_impatience = flagsp->timelimit_impatience;
+		    e->slvndx = slvndx;
+		    /* in the filter before it can be found */
+		    if (b->filtered) {
+			 e->f[0] = fs[2];
+			 e->f[1] = fs[3];
+			 AORU(&filter[x / 32], BWIS_MASK(x));
+			 AORU(&filter[y / 32], BWIS_MASK(y));
+		    } else {
+			 e->f[0] = e->f[1] = 0;
+			 AINC(&hdr->unfiltered);
+		    }
+		    ASTOREU(&e->u, flagsp->u);
+		    AINC(&hdr->nentry);
+		    break;
+	       }
+	       if (u == flagsp->u && md5eq(s, e->s) && e->l == flagsp->l
+		   && e->slvndx == slvndx)
+		    break; /* already there */
+	       ++n;
+	       g = (g + 1) & mask;
+	  }
+     }
+}
+#else
+static void bwis_publish(planner *ego, const md5sig s, const md5sig fs,
+			 const flags_t *flagsp, unsigned slvndx)
+{
+     UNUSED(ego); UNUSED(s); UNUSED(fs); UNUSED(flagsp); UNUSED(slvndx);
+}
+#endif
+
+static solution *hlookup(planner *ego, psig *sg, const flags_t *flagsp)
+{
+     const md5uint *s = sg->m.s;
+     solution *sol = htab_lookup(&ego->htab_blessed, s, flagsp);
+     if (!sol) sol = htab_lookup(&ego->htab_unblessed, s, flagsp);
+     if (!sol) {
+	  flags_t flags;
+	  md5sig w;
+	  unsigned phase = shenter(ego->shared);
+	  bwisdom *b = bwis_of(ego);
+	  int found = 0;
+
+	  if (ego->shared)
+	       found = shtab_lookup(ego->shared, s, flagsp, &flags, w);
+	  /* images are keyed by MD5: look there last, and compute the
+	     MD5 only if some image may hold the problem */
+	  if (!found && b && bwis_maybe(b, s)
+	      && bwis_lookup(ego, b, wsig(ego, sg), flagsp, &flags)) {
+	       sigcpy(sg->w.s, w);
+	       found = 1;
+	  }
+	  shleave(ego->shared, phase);
+	  if (found) {
+	       /* mirror it, so that we find it here next time */
+	       htab_insert(&ego->htab_blessed, s, w, &flags, flags.slvndx);
+	       sol = htab_lookup(&ego->htab_blessed, s, flagsp);
+	  }
+     }
+     return sol;
+}
+
+static void hinsert(planner *ego, psig *sg, const flags_t *flagsp, 
+		    unsigned slvndx, double pcost)
+{
+     if (BLISS(*flagsp)) {
+	  const md5uint *w = wsig(ego, sg);
+	  unsigned phase;
+	  htab_insert(&ego->htab_blessed, sg->m.s, w, flagsp, slvndx)->pcost =
+	       pcost;
+	  phase = shenter(ego->shared);
+	  if (ego->shared)
+	       shtab_insert(ego->shared, sg->m.s, w, flagsp, slvndx);
+	  bwis_publish(ego, w, sg->m.s, flagsp, slvndx);
+	  shleave(ego->shared, phase);
+     } else
+	  htab_insert(&ego->htab_unblessed, sg->m.s, 0, flagsp, slvndx)->pcost =
+	       pcost;
 }
 
 
@@ -435,55 +1252,279 @@ double X(iestimate_cost)(const planner *ego, const plan *pln, const problem *p)
 	  + 2 * pln->ops.fma
 #endif
 	  
-	  + pln->ops.other;
+	  + pln->ops.other
+	  - pln->ops.thr;
      if (ego->cost_hook)
 	  cost = ego->cost_hook(p, cost, COST_MAX);
      return cost;
 }
 
-static void evaluate_plan(planner *ego, plan *pln, const problem *p)
+static int needs_evaluation(const planner *ego, const plan *pln)
 {
-     if (ESTIMATEP(ego) || !BELIEVE_PCOSTP(ego) || pln->pcost == 0.0) {
-	  ego->nplan++;
+     return ESTIMATEP(ego) || !BELIEVE_PCOSTP(ego) || pln->pcost == 0.0;
+}
+
+/* Calibrated estimates.  X(measurement_hook), if set, is told of
+   every plan the planner times, so that a program may collect them
+   (api/cost-model.c).  A cost model fitted to such measurements prices
+   each kind of operation, each execution of a plan, and the overhead
+   of the solver that made the plan, in the units of
+   X(measure_execution_time); while X(cost_model) is set, estimates use
+   it instead of the operation count.  As with measured plans, a plan
+   costs what its children cost (their pcost) plus its own work, which
+   is all that the model prices: the ops that are not its children's
+   and one execution, times the factor of its solver, at the pace
+   at which its children go, relative to the weights (much of the own
+   work of a loop over a child is running the child again). */
+void (*X(measurement_hook))(const planner *ego, unsigned slvndx,
+			    const plan *pln, const problem *p,
+			    double t) = 0;
+const costmodel *X(cost_model) = 0;
+
+static double weigh(const costmodel *m, const opcnt *ops)
+{
+     return m->w.add * ops->add + m->w.mul * ops->mul
+	  + m->w.fma * ops->fma + m->w.other * ops->other;
+}
+
+static double model_cost(const planner *ego, const costmodel *m,
+			 unsigned slvndx, const plan *pln, const problem *p)
+{
+     opcnt own;
+     double cost, cld = weigh(m, &pln->cldops), pace = 1.0;
+
+     X(own_ops)(pln, &own);
+     if (cld > 0 && pln->cldcost > 0)
+	  pace = pln->cldcost / cld;
+     cost = weigh(m, &own) + m->call - m->w.add * own.thr;
+     if (slvndx < m->nfactor)
+	  cost *= m->factor[slvndx];
+     cost = cost * pace + pln->cldcost;
+     if (ego->cost_hook)
+	  cost = ego->cost_hook(p, cost, COST_MAX);
+     return cost;
+}
+
+static void estimate_plan(planner *ego, plan *pln, const problem *p,
+			  unsigned slvndx)
+{
+     const costmodel *m = X(cost_model);
 
-	  if (ESTIMATEP(ego)) {
-	  estimate:
-	       /* heuristic */
+     /* heuristic */
 #ifdef FFTW_RANDOM_ESTIMATOR
-	       pln->pcost = random_estimate(ego, pln, p);
-	       ego->epcost += X(iestimate_cost)(ego, pln, p);
+     pln->pcost = random_estimate(ego, pln, p);
+     ego->epcost += X(iestimate_cost)(ego, pln, p);
+     UNUSED(m); UNUSED(slvndx);
 #else
-	       pln->pcost = X(iestimate_cost)(ego, pln, p);
-	       ego->epcost += pln->pcost;
+     if (m)
+	  pln->pcost = model_cost(ego, m, slvndx, pln, p);
+     else
+	  pln->pcost = X(iestimate_cost)(ego, pln, p);
+     ego->epcost += pln->pcost;
 #endif
-	  } else {
-	       double t = X(measure_execution_time)(ego, pln, p);
-	       
-	       if (t < 0) {  /* unavailable cycle counter */
-		    /* Real programmers can write FORTRAN in any language */
-		    goto estimate;
-	       }
+}
 
-	       pln->pcost = t;
-	       ego->pcost += t;
-	       ego->need_timeout_check = 1;
-	  }
+static void record_time(planner *ego, plan *pln, const problem *p,
+			unsigned slvndx, double t)
+{
+     if (t < 0) {  /* unavailable cycle counter */
+	  /* Real programmers can write FORTRAN in any language */
+	  estimate_plan(ego, pln, p, slvndx);
+     } else {
+	  pln->pcost = t;
+	  ego->pcost += t;
+	  ego->need_timeout_check = 1;
+	  if (X(measurement_hook))
+	       X(measurement_hook)(ego, slvndx, pln, p, t);
+     }
+}
+
+/* PLN was made by solver SLVNDX; BOUND is the cost to beat, if
+   positive */
+static void evaluate_plan(planner *ego, plan *pln, const problem *p,
+			  unsigned slvndx, double bound)
+{
+     if (needs_evaluation(ego, pln)) {
+	  ego->nplan++;
+
+	  if (ESTIMATEP(ego))
+	       estimate_plan(ego, pln, p, slvndx);
+	  else
+	       record_time(ego, pln, p, slvndx,
+			   X(measure_execution_time)(ego, pln, p, bound));
      }
      
      invoke_hook(ego, pln, p, 0);
 }
 
+/* whether plan A beats plan B, which came earlier, on P.  With robust
+   timing only a clear win counts, so that among plans equally fast
+   within the noise the first one is chosen, run after run; and since
+   two medians taken at different times differ by more than that on a
+   busy machine, the call is made by timing A and B in turns
+   (X(measure_ratio)). */
+static int beats(const planner *ego, plan *a, plan *b, const problem *p)
+{
+     if (ego->robust_timing && !ESTIMATEP(ego)) {
+	  double r = X(measure_ratio)(ego, a, b, p);
+	  if (r < 0)
+	       return a->pcost < b->pcost * (1.0 - ROBUST_TIMING_TOL);
+	  return r < 1.0 - ROBUST_TIMING_TOL;
+     }
+     return a->pcost < b->pcost;
+}
+
+/*
+  Concurrent measurement.  search0_concurrent() creates the candidate
+  plans of a problem exactly as search0() does, serially and hence
+  with the same hash-table insertions, and then times all of them at
+  once through X(measure_loop_hook).  Each timing thread owns a private
+  copy of the problem's arrays (problem_adt.clone_io) and, when plans
+  are serial, its own cpu, so that timings do not disturb one another.
+  Candidates that come within MEASURE_TIE of the best are timed again
+  serially on P, so that close calls are decided as in serial planning.
+*/
+void (*X(measure_loop_hook))(int n, int nslots, int pin,
+			     measure_function f, void *data) = 0;
+
+#define MEASURE_TIE 1.05
+
+typedef struct {
+     const planner *plnr;
+     plan **plns;
+     double *t;
+     problem **p; /* one per slot */
+} measure_data;
+
+static void measure_one(void *data, int i, int slot)
+{
+     measure_data *d = (measure_data *) data;
+     const problem *p = d->p[slot];
+
+     p->adt->zero(p);
+     d->t[i] = X(measure_awake_plan)(d->plnr, d->plns[i], p, 0.0);
+}
+
+static int measure_slots(const planner *ego, const problem *p)
+{
+     /* the cost hook (MPI) may communicate, hence it must not be
+	called from several threads */
+     if (ESTIMATEP(ego) || ego->nmeasure < 2 || !X(measure_loop_hook)
+	 || ego->cost_hook || !p->adt->clone_io)
+	  return 1;
+
+     /* each measurement of a threaded plan uses NTHR cpus */
+     return ego->nmeasure / ego->nthr;
+}
+
+static void evaluate_plans(planner *ego, const problem *p, 
+			   plan **plns, const unsigned *slvndx, int n,
+			   int nslots)
+{
+     measure_data d;
+     R **buf;
+     int *ndx;
+     int i, j, m, best, ntie;
+
+     ndx = (int *)MALLOC(n * sizeof(int), OTHER);
+     for (i = m = 0; i < n; ++i)
+	  if (needs_evaluation(ego, plns[i]))
+	       ndx[m++] = i;
+
+     if (m < 2) {
+	  X(ifree)(ndx);
+	  for (i = 0; i < n; ++i)
+	       evaluate_plan(ego, plns[i], p, slvndx[i], 0.0);
+	  return;
+     }
+
+     nslots = X(imin)(nslots, m);
+     d.plnr = ego;
+     d.plns = (plan **)MALLOC(m * sizeof(plan *), OTHER);
+     d.t = (double *)MALLOC(m * sizeof(double), OTHER);
+     d.p = (problem **)MALLOC(nslots * sizeof(problem *), OTHER);
+     buf = (R **)MALLOC(nslots * sizeof(R *), OTHER);
+
+     for (j = 0; j < nslots; ++j)
+	  d.p[j] = p->adt->clone_io(p, buf + j);
+
+     /* waking up touches the shared twiddle cache; do it here */
+     for (j = 0; j < m; ++j) {
+	  d.plns[j] = plns[ndx[j]];
+	  X(plan_awake)(d.plns[j], AWAKE_ZERO);
+     }
+
+     X(measure_loop_hook)(m, nslots, ego->nthr == 1, measure_one, &d);
+
+     for (j = 0; j < m; ++j)
+	  X(plan_awake)(d.plns[j], SLEEPY);
+
+     for (j = 0; j < nslots; ++j) {
+	  X(problem_destroy)(d.p[j]);
+	  X(ifree)(buf[j]);
+     }
+
+     /* settle close calls serially */
+     for (j = 0, best = -1; j < m; ++j)
+	  if (d.t[j] >= 0 && (best < 0 || d.t[j] < d.t[best]))
+	       best = j;
+     if (best >= 0) {
+	  double limit = d.t[best] * MEASURE_TIE;
+	  for (j = ntie = 0; j < m; ++j)
+	       if (d.t[j] >= 0 && d.t[j] <= limit)
+		    ++ntie;
+	  if (ntie > 1)
+	       for (j = 0; j < m; ++j)
+		    if (d.t[j] >= 0 && d.t[j] <= limit)
+			 d.t[j] = X(measure_execution_time)(ego, d.plns[j], p,
+							    0.0);
+     }
+
+     for (i = j = 0; i < n; ++i) {
+	  if (j < m && ndx[j] == i) {
+	       ego->nplan++;
+	       record_time(ego, plns[i], p, slvndx[i], d.t[j++]);
+	  }
+	  invoke_hook(ego, plns[i], p, 0);
+     }
+
+     X(ifree)(buf);
+     X(ifree)(d.p);
+     X(ifree)(d.t);
+     X(ifree)(d.plns);
+     X(ifree)(ndx);
+}
+
 /* maintain dynamic scoping of flags, nthr: */
 static plan *invoke_solver(planner *ego, const problem *p, solver *s, 
 			   const flags_t *nflags)
 {
      flags_t flags = ego->flags;
-     int nthr = ego->nthr;
+     int nthr = ego->nthr, cldnthr = ego->cldnthr;
+     size_t cldscratch = ego->cldscratch;
+     opcnt cldops = ego->cldops;
+     double cldcost = ego->cldcost;
      plan *pln;
      ego->flags = *nflags;
+     ego->cldnthr = 1;
+     ego->cldscratch = 0;
+     X(ops_zero)(&ego->cldops);
+     ego->cldcost = 0.0;
      PLNR_TIMELIMIT_IMPATIENCE(ego) = 0;
      A(p->adt->problem_kind == s->adt->problem_kind);
      pln = s->adt->mkplan(s, p, ego);
+     if (pln) {
+	  /* a plan runs on as many threads as its children, and calls
+	     them one at a time while it holds its own scratch */
+	  pln->nthr = X(imax)(pln->nthr, ego->cldnthr);
+	  pln->scratch += ego->cldscratch;
+	  pln->cldops = ego->cldops;
+	  pln->cldcost = ego->cldcost;
+     }
+     ego->cldnthr = cldnthr;
+     ego->cldscratch = cldscratch;
+     ego->cldops = cldops;
+     ego->cldcost = cldcost;
      ego->nthr = nthr;
      ego->flags = flags;
      return pln;
@@ -515,17 +1556,95 @@ static int timeout_p(planner *ego, const problem *p)
      return 0;
 }
 
+static plan *search0_concurrent(planner *ego, const problem *p, 
+				unsigned *slvndx, const flags_t *flagsp,
+				int nslots)
+{
+     plan **cand = 0;
+     unsigned *cndx = 0;
+     int i, n = 0, nalloc = 0, best;
+
+     FORALL_SOLVERS_OF_KIND(p->adt->problem_kind, ego, s, sp, {
+	  plan *pln;
+
+	  pln = invoke_solver(ego, p, s, flagsp);
+
+	  if (ego->need_timeout_check) 
+	       if (timeout_p(ego, p)) {
+		    X(plan_destroy_internal)(pln);
+		    for (i = 0; i < n; ++i)
+			 X(plan_destroy_internal)(cand[i]);
+		    X(ifree0)(cand);
+		    X(ifree0)(cndx);
+		    return 0;
+	       }
+
+	  if (pln) {
+	       int could_prune_now_p = pln->could_prune_now_p;
+
+	       if (n >= nalloc) {
+		    plan **ncand;
+		    unsigned *nndx;
+		    nalloc = 2 * nalloc + 8;
+		    ncand = (plan **)MALLOC(nalloc * sizeof(plan *), OTHER);
+		    nndx = (unsigned *)MALLOC(nalloc * sizeof(unsigned), OTHER);
+		    for (i = 0; i < n; ++i) {
+			 ncand[i] = cand[i];
+			 nndx[i] = cndx[i];
+		    }
+		    X(ifree0)(cand);
+		    X(ifree0)(cndx);
+		    cand = ncand;
+		    cndx = nndx;
+	       }
+	       cand[n] = pln;
+	       cndx[n] = (unsigned)/*from ptrdiff_t*/(sp - ego->slvdescs);
+	       ++n;
+
+	       if (ALLOW_PRUNINGP(ego) && could_prune_now_p) 
+		    break;
+	  }
+     });
+
+     if (!n)
+	  return 0;
+
+     /* as in search0(), a lone candidate is not timed */
+     if (n > 1)
+	  evaluate_plans(ego, p, cand, cndx, n, nslots);
+
+     /* first minimum, as in search0() */
+     for (best = 0, i = 1; i < n; ++i)
+	  if (beats(ego, cand[i], cand[best], p))
+	       best = i;
+     for (i = 0; i < n; ++i)
+	  if (i != best)
+	       X(plan_destroy_internal)(cand[i]);
+
+     *slvndx = cndx[best];
+     {
+	  plan *pln = cand[best];
+	  X(ifree)(cand);
+	  X(ifree)(cndx);
+	  return pln;
+     }
+}
+
 static plan *search0(planner *ego, const problem *p, unsigned *slvndx, 
 		     const flags_t *flagsp)
 {
      plan *best = 0;
      int best_not_yet_timed = 1;
+     int nslots;
 
      /* Do not start a search if the planner timed out. This check is
 	necessary, lest the relaxation mechanism kick in */
      if (timeout_p(ego, p))
 	  return 0;
 
+     if ((nslots = measure_slots(ego, p)) > 1)
+	  return search0_concurrent(ego, p, slvndx, flagsp, nslots);
+
      FORALL_SOLVERS_OF_KIND(p->adt->problem_kind, ego, s, sp, {
 	  plan *pln;
 
@@ -545,11 +1664,13 @@ static plan *search0(planner *ego, const problem *p, unsigned *slvndx,
 
 	       if (best) {
 		    if (best_not_yet_timed) {
-			 evaluate_plan(ego, best, p);
+			 evaluate_plan(ego, best, p, *slvndx, 0.0);
 			 best_not_yet_timed = 0;
 		    }
-		    evaluate_plan(ego, pln, p);
-		    if (pln->pcost < best->pcost) {
+		    evaluate_plan(ego, pln, p,
+				  (unsigned)/*from ptrdiff_t*/
+				  (sp - ego->slvdescs), best->pcost);
+		    if (beats(ego, pln, best, p)) {
 			 X(plan_destroy_internal)(best);
 			 best = pln;
                          *slvndx = (unsigned)/*from ptrdiff_t*/(sp - ego->slvdescs);
@@ -566,6 +1687,13 @@ static plan *search0(planner *ego, const problem *p, unsigned *slvndx,
 	  }
      });
 
+     /* a lone candidate wins untimed, unless the cost of its parent
+	is to be composed from it: by the cost model, or in the
+	measurements recorded to fit one */
+     if (best && best_not_yet_timed
+	 && (ESTIMATEP(ego) ? X(cost_model) != 0 : X(measurement_hook) != 0))
+	  evaluate_plan(ego, best, p, *slvndx, 0.0);
+
      return best;
 }
 
@@ -623,11 +1751,12 @@ static plan *search(planner *ego, const problem *p, unsigned *slvndx,
 static plan *mkplan(planner *ego, const problem *p)
 {
      plan *pln;
-     md5 m;
+     psig sg;
      unsigned slvndx;
      flags_t flags_of_solution;
      solution *sol;
      solver *s;
+     double pcost = 0.0;
 
      ASSERT_ALIGNED_DOUBLE;
      A(LEQ(PLNR_L(ego), PLNR_U(ego)));
@@ -647,13 +1776,16 @@ static plan *mkplan(planner *ego, const problem *p)
 
      ego->timed_out = 0;
 
+     if (ego->shared)
+	  shared_sync(ego);
+
      ++ego->nprob;
-     md5hash(&m, p, ego);
+     psig_init(&sg, p, ego);
 
      flags_of_solution = ego->flags;
 
      if (ego->wisdom_state != WISDOM_IGNORE_ALL) {
-	  if ((sol = hlookup(ego, m.s, &flags_of_solution))) { 
+	  if ((sol = hlookup(ego, &sg, &flags_of_solution))) { 
 	       /* wisdom is acceptable */
 	       wisdom_state_t owisdom_state = ego->wisdom_state;
 	       
@@ -672,6 +1804,7 @@ static plan *mkplan(planner *ego, const problem *p)
 	       }
 	       
 	       flags_of_solution = sol->flags;
+	       pcost = sol->pcost;
 	       
 	       /* inherit blessing either from wisdom
 		  or from the planner */
@@ -693,6 +1826,12 @@ static plan *mkplan(planner *ego, const problem *p)
 	       
 	       if (!pln)
 		    goto wisdom_is_bogus;
+
+	       /* not evaluated; a cost found by a patient search is not
+		  comparable with the estimates, so price it the same way */
+	       if (ESTIMATEP(ego) && X(cost_model))
+		    pcost = pln->pcost = model_cost(ego, X(cost_model),
+						    slvndx, pln, p);
 	       
 	       ego->wisdom_state = owisdom_state;
 	       
@@ -710,6 +1849,8 @@ static plan *mkplan(planner *ego, const problem *p)
      flags_of_solution = ego->flags;
      pln = search(ego, p, &slvndx, &flags_of_solution);
      CHECK_FOR_BOGOSITY; 	  /* catch error in child solvers */
+     if (pln)
+	  pcost = pln->pcost;
 
      if (ego->timed_out) {
 	  A(!pln);
@@ -731,13 +1872,14 @@ static plan *mkplan(planner *ego, const problem *p)
      if (ego->wisdom_state == WISDOM_NORMAL ||
 	 ego->wisdom_state == WISDOM_ONLY) {
 	  if (pln) {
-	       hinsert(ego, m.s, &flags_of_solution, slvndx);
+	       hinsert(ego, &sg, &flags_of_solution, slvndx, pcost);
 	       invoke_hook(ego, pln, p, 1);
 	  } else {
-	       hinsert(ego, m.s, &flags_of_solution, INFEASIBLE_SLVNDX);
+	       hinsert(ego, &sg, &flags_of_solution, INFEASIBLE_SLVNDX, 0.0);
 	  }
      }
 
+     ego->mkcost = pcost;
      return pln;
 
  wisdom_is_bogus:
@@ -746,30 +1888,20 @@ static plan *mkplan(planner *ego, const problem *p)
      return 0;
 }
 
-static void htab_destroy(hashtab *ht)
-{
-     X(ifree)(ht->solutions);
-     ht->solutions = 0;
-     ht->nelem = 0U;
-}
-
-static void mkhashtab(hashtab *ht)
-{
-     ht->nrehash = 0;
-     ht->succ_lookup = ht->lookup = ht->lookup_iter = 0;
-     ht->insert = ht->insert_iter = ht->insert_unknown = 0;
-
-     ht->solutions = 0;
-     ht->hashsiz = ht->nelem = 0U;
-     hgrow(ht);			/* so that hashsiz > 0 */
-}
-
 /* destroy hash table entries.  If FORGET_EVERYTHING, destroy the whole
    table.  If FORGET_ACCURSED, then destroy entries that are not blessed. */
 static void forget(planner *ego, amnesia a)
 {
      switch (a) {
 	 case FORGET_EVERYTHING:
+	      if (ego->shared) {
+		   unsigned phase = shenter(ego->shared);
+		   shtab_forget(ego->shared);
+		   ego->shared_gen = shtab_gen(ego->shared);
+		   shleave(ego->shared, phase);
+	      }
+	      bwis_release(ego->bwis);
+	      ego->bwis = 0;
 	      htab_destroy(&ego->htab_blessed);
 	      mkhashtab(&ego->htab_blessed);
 	      /* fall through */
@@ -786,11 +1918,92 @@ static void forget(planner *ego, amnesia a)
 #define WISDOM_PREAMBLE PACKAGE "-" VERSION " " STRINGIZE(X(wisdom))
 static const char stimeout[] = "TIMEOUT";
 
+/* call F on every blessed solution that EGO knows of: the images,
+   then the planner's own (or, when planning concurrently, the shared)
+   solutions that are not in an image */
+typedef void (*blessed_visitor)(planner *ego, const md5sig s, 
+				const md5uint *f, const flags_t *flagsp,
+				void *data);
+
+static void forall_blessed0(planner *ego, blessed_visitor f, void *data)
+{
+     bwisdom *b0 = bwis_of(ego), *b;
+     unsigned h;
+
+     for (b = b0; b; b = b->next) {
+	  for (h = 0; h < b->hdr->nslot; ++h) {
+	       const bwis_entry *e = b->slot + h;
+	       md5uint u = ALOADU(&e->u);
+	       flags_t flags;
+	       if (u != BWIS_EMPTY && u != BWIS_BUSY 
+		   && bwis_flags(ego, e, &flags))
+		    f(ego, e->s, b->filtered && (e->f[0] | e->f[1]) ? e->f : 0,
+		      &flags, data);
+	  }
+     }
+
+#ifdef HAVE_SHTAB
+     if (ego->shared) {
+	  /* the wisdom of all threads */
+	  sharray *a = shsettle(ego->shared);
+	  for (h = 0; h < a->siz; ++h) {
+	       void *x = ALOAD(&a->slot[h]);
+	       if (x && x != TOMB && x != MOVED) {
+		    shentry *e = (shentry *)x;
+		    if (!bwis_contains(ego, b0, e->w, &e->flags))
+			 f(ego, e->w, e->s + 2, &e->flags, data);
+	       }
+	  }
+	  return;
+     }
+#endif
+
+     {
+	  hashtab *ht = &ego->htab_blessed;
+	  for (h = 0; h < ht->hashsiz; ++h) {
+	       solution *l = ht->solutions + h;
+	       if (LIVEP(l) && !bwis_contains(ego, b0, l->w, &l->flags))
+		    f(ego, l->w, l->s + 2, &l->flags, data);
+	  }
+     }
+}
+
+static void forall_blessed(planner *ego, blessed_visitor f, void *data)
+{
+     unsigned phase = shenter(ego->shared);
+     forall_blessed0(ego, f, data);
+     shleave(ego->shared, phase);
+}
+
+static void exprt1(planner *ego, const md5sig s, const md5uint *f,
+		   const flags_t *flagsp, void *data)
+{
+     printer *p = (printer *) data;
+     const char *reg_nam;
+     int reg_id;
+
+     UNUSED(f);
+
+     if (flagsp->slvndx == INFEASIBLE_SLVNDX) {
+	  reg_nam = stimeout;
+	  reg_id = 0;
+     } else {
+	  slvdesc *sp = ego->slvdescs + flagsp->slvndx;
+	  reg_nam = sp->reg_nam;
+	  reg_id = sp->reg_id;
+     }
+
+     /* qui salvandos salvas gratis
+	salva me fons pietatis */
+     p->print(p, "  (%s %d #x%x #x%x #x%x #x%M #x%M #x%M #x%M)\n",
+	      reg_nam, reg_id, 
+	      flagsp->l, flagsp->u, flagsp->timelimit_impatience, 
+	      s[0], s[1], s[2], s[3]);
+}
+
 /* tantus labor non sit cassus */
 static void exprt(planner *ego, printer *p)
 {
-     unsigned h;
-     hashtab *ht = &ego->htab_blessed;
      md5 m;
 
      signature_of_configuration(&m, ego);
@@ -798,31 +2011,177 @@ static void exprt(planner *ego, printer *p)
      p->print(p, 
 	      "(" WISDOM_PREAMBLE " #x%M #x%M #x%M #x%M\n",
 	      m.s[0], m.s[1], m.s[2], m.s[3]);
+     forall_blessed(ego, exprt1, p);
+     p->print(p, ")\n");
+}
 
-     for (h = 0; h < ht->hashsiz; ++h) {
-	  solution *l = ht->solutions + h;
-	  if (LIVEP(l)) {
-	       const char *reg_nam;
-	       int reg_id;
-
-	       if (SLVNDX(l) == INFEASIBLE_SLVNDX) {
-		    reg_nam = stimeout;
-		    reg_id = 0;
-	       } else {
-		    slvdesc *sp = ego->slvdescs + SLVNDX(l);
-		    reg_nam = sp->reg_nam;
-		    reg_id = sp->reg_id;
-	       }
+/* binary wisdom image of all the blessed solutions of EGO */
+typedef struct {
+     bwis_header *hdr;
+     bwis_entry *slot;
+     md5uint *filter;
+} bwis_builder;
 
-	       /* qui salvandos salvas gratis
-		  salva me fons pietatis */
-	       p->print(p, "  (%s %d #x%x #x%x #x%x #x%M #x%M #x%M #x%M)\n",
-			reg_nam, reg_id, 
-			l->flags.l, l->flags.u, l->flags.timelimit_impatience, 
-			l->s[0], l->s[1], l->s[2], l->s[3]);
+/* F, the fast hash words of the entry, is null if unknown */
+static void bwis_add(planner *ego, const md5sig s, const md5uint *f,
+		     const flags_t *flagsp, void *data)
+{
+     bwis_builder *bb = (bwis_builder *) data;
+     md5uint mask = bb->hdr->nslot - 1, g = s[0] & mask;
+     UNUSED(ego);
+
+     for (;; g = (g + 1) & mask) {
+	  bwis_entry *e = bb->slot + g;
+	  if (e->u == BWIS_EMPTY) {
+	       sigcpy(s, e->s);
+	       e->l = flagsp->l;
+	       e->u = flagsp->u;
+	       e->timelimit_impatience = flagsp->timelimit_impatience;
+	       e->slvndx = flagsp->slvndx;
+	       if (f) {
+		    md5uint x = bwis_bit(bb->hdr, f, 0);
+		    md5uint y = bwis_bit(bb->hdr, f, 1);
+		    e->f[0] = f[0];
+		    e->f[1] = f[1];
+		    bb->filter[x / 32] |= BWIS_MASK(x);
+		    bb->filter[y / 32] |= BWIS_MASK(y);
+	       } else
+		    ++bb->hdr->unfiltered;
+	       ++bb->hdr->nentry;
+	       return;
 	  }
+	  if (md5eq(s, e->s) && e->l == flagsp->l && e->u == flagsp->u
+	      && e->timelimit_impatience == flagsp->timelimit_impatience
+	      && e->slvndx == flagsp->slvndx)
+	       return; /* duplicate */
      }
-     p->print(p, ")\n");
+}
+
+static void bwis_count(planner *ego, const md5sig s, const md5uint *f,
+		       const flags_t *flagsp, void *data)
+{
+     UNUSED(ego); UNUSED(s); UNUSED(f); UNUSED(flagsp);
+     ++*(size_t *) data;
+}
+
+/* Write an empty binary wisdom image of NSLOT slots (a power of 2) for
+   the configuration of EGO to IMAGE, if IMAGE is not null.  Returns the
+   size of the image. */
+size_t X(planner_format_binary)(planner *ego, void *image, size_t nslot)
+{
+     bwis_header *hdr = (bwis_header *) image;
+     bwis_entry *slot;
+     md5 m;
+     size_t i;
+
+     if (hdr) {
+	  slot = (bwis_entry *) (hdr + 1);
+	  memset(hdr, 0, sizeof(bwis_header));
+	  memcpy(hdr->magic, BWIS_MAGIC, sizeof(hdr->magic));
+	  hdr->version = BWIS_VERSION;
+	  hdr->byteorder = BWIS_BYTEORDER;
+	  signature_of_configuration(&m, ego);
+	  sigcpy(m.s, hdr->config);
+	  hdr->nslot = (md5uint) nslot;
+	  hdr->nentry = 0;
+	  hdr->unfiltered = 0;
+	  hdr->fasthash = MD5_FAST_ID;
+	  memset(slot, 0, nslot * (sizeof(bwis_entry) + sizeof(md5uint)));
+	  for (i = 0; i < nslot; ++i)
+	       slot[i].u = BWIS_EMPTY;
+     }
+     return sizeof(bwis_header) 
+	  + nslot * (sizeof(bwis_entry) + sizeof(md5uint));
+}
+
+/* an empty image for N solutions, at most half full */
+static size_t mkimage(planner *ego, size_t n, bwis_builder *bb)
+{
+     size_t nslot = 16, sz;
+
+     while (nslot < 2 * n)
+	  nslot *= 2;
+
+     sz = X(planner_format_binary)(ego, 0, nslot);
+     bb->hdr = (bwis_header *) MALLOC(sz, OTHER);
+     bb->slot = (bwis_entry *) (bb->hdr + 1);
+     bb->filter = (md5uint *) (bb->slot + nslot);
+     X(planner_format_binary)(ego, bb->hdr, nslot);
+     return sz;
+}
+
+size_t X(planner_export_binary)(planner *ego, void **image)
+{
+     size_t n = 0, sz;
+     bwis_builder bb;
+
+     forall_blessed(ego, bwis_count, &n);
+     sz = mkimage(ego, n, &bb);
+     forall_blessed(ego, bwis_add, &bb);
+
+     *image = bb.hdr;
+     return sz;
+}
+
+/* Attach the binary wisdom IMAGE of N bytes, which must stay valid
+   until RELEASE(ARG) is called.  If WRITABLE, the planner also
+   publishes its blessed solutions there.  Returns 0 (and does not call
+   RELEASE) if IMAGE is not binary wisdom for this configuration.  Only
+   the header is checked; a bogus entry is found bogus when it is
+   used. */
+int X(planner_attach_binary)(planner *ego, const void *image, size_t n,
+			     int writable, 
+			     void (*release)(void *arg), void *arg)
+{
+     const bwis_header *hdr = (const bwis_header *) image;
+     bwisdom *b;
+     md5 m;
+
+     if (n < sizeof(bwis_header) 
+	 || ((size_t) image) % sizeof(md5uint)
+	 || memcmp(hdr->magic, BWIS_MAGIC, sizeof(hdr->magic))
+	 || hdr->version != BWIS_VERSION
+	 || hdr->byteorder != BWIS_BYTEORDER
+	 || hdr->nslot == 0 || (hdr->nslot & (hdr->nslot - 1))
+	 || hdr->nslot > 0xffffffffU / 32
+	 || ((n - sizeof(bwis_header))
+	     / (sizeof(bwis_entry) + sizeof(md5uint))) < hdr->nslot)
+	  return 0;
+
+#ifndef HAVE_SHTAB
+     if (writable)
+	  return 0; /* no atomic operations */
+#endif
+
+     signature_of_configuration(&m, ego);
+     if (!md5eq(m.s, hdr->config))
+	  return 0;
+
+     b = (bwisdom *) MALLOC(sizeof(bwisdom), OTHER);
+     b->hdr = hdr;
+     b->slot = (const bwis_entry *) (hdr + 1);
+     b->filter = (const md5uint *) (b->slot + hdr->nslot);
+     b->filtered = hdr->fasthash == MD5_FAST_ID;
+     b->writable = writable;
+     b->release = release;
+     b->arg = arg;
+     b->retired = 0;
+
+     if (ego->shared) {
+	  unsigned phase = shenter(ego->shared);
+	  shtab_attach(ego->shared, b);
+	  shleave(ego->shared, phase);
+     }
+     else {
+	  b->next = ego->bwis;
+	  ego->bwis = b;
+     }
+     return 1;
+}
+
+static void release_image(void *image)
+{
+     X(ifree)(image);
 }
 
 /* mors stupebit et natura
@@ -835,8 +2194,9 @@ static int imprt(planner *ego, scanner *sc)
      flags_t flags;
      int reg_id;
      unsigned slvndx;
-     hashtab *ht = &ego->htab_blessed;
-     hashtab old;
+     solution *sol = 0;
+     size_t n = 0, nalloc = 0, i, sz;
+     bwis_builder bb;
      md5 m;
 
      if (!sc->scan(sc, 
@@ -851,15 +2211,6 @@ static int imprt(planner *ego, scanner *sc)
 	  return 0;
      }
      
-     /* make a backup copy of the hash table (cache the hash) */
-     {
-	  unsigned h, hsiz = ht->hashsiz;
-	  old = *ht;
-	  old.solutions = (solution *)MALLOC(hsiz * sizeof(solution), HASHT);
-	  for (h = 0; h < hsiz; ++h)
-	       old.solutions[h] = ht->solutions[h];
-     }
-
      while (1) {
 	  if (sc->scan(sc, ")"))
 	       break;
@@ -886,22 +2237,41 @@ static int imprt(planner *ego, scanner *sc)
 	  flags.u = u;
 	  flags.timelimit_impatience = timelimit_impatience;
 	  flags.hash_info = BLESSING;
+	  flags.slvndx = slvndx;
 
 	  CK(flags.l == l);
 	  CK(flags.u == u);
 	  CK(flags.timelimit_impatience == timelimit_impatience);
 
-	  if (!hlookup(ego, sig, &flags))
-	       hinsert(ego, sig, &flags, slvndx);
+	  if (n == nalloc) {
+	       solution *osol = sol;
+	       nalloc = nalloc ? 2 * nalloc : 64;
+	       sol = (solution *)MALLOC(nalloc * sizeof(solution), HASHT);
+	       if (n)
+		    memcpy(sol, osol, n * sizeof(solution));
+	       X(ifree0)(osol);
+	  }
+	  sigcpy(sig, sol[n].w);
+	  sol[n].flags = flags;
+	  ++n;
      }
 
-     X(ifree0)(old.solutions);
+     /* Text wisdom, read in full, becomes an image: the planner does
+	not know the problems, only their MD5, which it computes for
+	lookups in images alone (and, the image being unfiltered, on
+	every miss). */
+     if (n) {
+	  sz = mkimage(ego, n, &bb);
+	  for (i = 0; i < n; ++i)
+	       bwis_add(ego, sol[i].w, 0, &sol[i].flags, &bb);
+	  X(planner_attach_binary)(ego, bb.hdr, sz, 0, release_image, bb.hdr);
+     }
+     X(ifree0)(sol);
      return 1;
 
  bad:
      /* ``The wisdom of FFTW must be above suspicion.'' */
-     X(ifree0)(ht->solutions);
-     *ht = old;
+     X(ifree0)(sol);
      return 0;
 }
 
@@ -937,11 +2307,23 @@ planner *X(mkplanner)(void)
      p->flags.timelimit_impatience = 0;
      p->flags.hash_info = 0;
      p->nthr = 1;
+     p->nchunk = 1;
+     p->cldnthr = 1;
+     p->cldscratch = 0;
+     X(ops_zero)(&p->cldops);
+     p->cldcost = 0.0;
+     p->mkcost = 0.0;
+     p->nmeasure = 1;
+     p->robust_timing = 0;
      p->need_timeout_check = 1;
      p->timelimit = -1;
 
      mkhashtab(&p->htab_blessed);
      mkhashtab(&p->htab_unblessed);
+     p->shared = 0;
+     p->shared_gen = 0;
+     p->bwis = 0;
+     p->mem = X(mkarena)(16384);
 
      for (i = 0; i < PROBLEM_LAST; ++i)
 	  p->slvdescs_for_problem_kind[i] = -1;
@@ -954,6 +2336,7 @@ void X(planner_destroy)(planner *ego)
      /* destroy hash table */
      htab_destroy(&ego->htab_blessed);
      htab_destroy(&ego->htab_unblessed);
+     bwis_release(ego->bwis);
 
      /* destroy solvdesc table */
      FORALL_SOLVERS(ego, s, sp, {
@@ -962,6 +2345,7 @@ void X(planner_destroy)(planner *ego)
      });
 
      X(ifree0)(ego->slvdescs);
+     X(arena_destroy)(ego->mem);
      X(ifree)(ego); /* dona eis requiem */
 }
 
@@ -969,6 +2353,19 @@ plan *X(mkplan_d)(planner *ego, problem *p)
 {
      plan *pln = ego->adt->mkplan(ego, p);
      X(problem_destroy)(p);
+     if (pln) {
+	  ego->cldnthr = X(imax)(ego->cldnthr, pln->nthr);
+	  if (pln->scratch > ego->cldscratch)
+	       ego->cldscratch = pln->scratch;
+	  X(ops_add2)(&pln->ops, &ego->cldops);
+	  /* a plan from wisdom is not timed, but the cost of the one
+	     found by the search is in the hash table; once any child
+	     cost is unknown, so is the sum (negative) */
+	  if (ego->cldcost < 0 || (ego->mkcost <= 0.0 && !ESTIMATEP(ego)))
+	       ego->cldcost = -1.0;
+	  else
+	       ego->cldcost += ego->mkcost;
+     }
      return pln;
 }
 
@@ -20,6 +20,7 @@
 
 
 #include "kernel/ifftw.h"
+#include <string.h>
 
 /* constructor */
 problem *X(mkproblem)(size_t sz, const problem_adt *adt)
@@ -66,7 +67,8 @@ static const problem_adt padt =
      unsolvable_hash,
      unsolvable_zero,
      unsolvable_print,
-     unsolvable_destroy
+     unsolvable_destroy,
+     0 /* clone_io */
 };
 
 /* there is no point in malloc'ing this one */
@@ -76,3 +78,72 @@ problem *X(mkproblem_unsolvable)(void)
 {
      return &the_unsolvable_problem;
 }
+
+/* Private copies of the arrays that the N pointers IN index through
+   tensor T, for timing a plan away from the user's arrays.  Pointers
+   into the same array stay in the same copy, at the same offsets,
+   alignment and taint.  The copies are zeroed, not filled from the
+   originals.  Returns the block to X(ifree); OUT receives the new
+   pointers. */
+#define CLONE_ALIGN 64
+#define CLONE_MAXPTR 8
+
+R *X(problem_clone_arrays)(int n, R *const *in, R **out, const tensor *t)
+{
+     uintptr_t start[CLONE_MAXPTR], end[CLONE_MAXPTR], off[CLONE_MAXPTR];
+     int order[CLONE_MAXPTR], region[CLONE_MAXPTR];
+     INT lo = 0, hi = 1;
+     size_t total = 0;
+     char *blk, *base;
+     int i, j, nreg = 0;
+
+     A(n <= CLONE_MAXPTR);
+     A(FINITE_RNK(t->rnk));
+
+     /* extent of the tensor on either side of each pointer */
+     for (i = 0; i < t->rnk; ++i) {
+	  const iodim *d = t->dims + i;
+	  lo += (d->n - 1) * X(imax)(0, -X(imin)(d->is, d->os));
+	  hi += (d->n - 1) * X(imax)(0, X(imax)(d->is, d->os));
+     }
+
+     /* sort the pointers by address and merge overlapping extents */
+     for (i = 0; i < n; ++i) {
+	  for (j = i; j > 0 && UNTAINT(in[order[j - 1]]) > UNTAINT(in[i]); --j)
+	       order[j] = order[j - 1];
+	  order[j] = i;
+     }
+     for (i = 0; i < n; ++i) {
+	  uintptr_t a = (uintptr_t)UNTAINT(in[order[i]]);
+	  uintptr_t s = (a - (uintptr_t)lo * sizeof(R)) & ~(uintptr_t)(CLONE_ALIGN - 1);
+	  uintptr_t e = a + (uintptr_t)hi * sizeof(R);
+	  if (nreg > 0 && s <= end[nreg - 1]) {
+	       if (e > end[nreg - 1]) end[nreg - 1] = e;
+	  } else {
+	       start[nreg] = s;
+	       end[nreg] = e;
+	       ++nreg;
+	  }
+	  region[order[i]] = nreg - 1;
+     }
+
+     for (i = 0; i < nreg; ++i) {
+	  off[i] = total;
+	  total += (end[i] - start[i] + CLONE_ALIGN - 1)
+	       & ~(size_t)(CLONE_ALIGN - 1);
+     }
+
+     blk = (char *)MALLOC(total + CLONE_ALIGN, BUFFERS);
+     base = (char *)(((uintptr_t)blk + CLONE_ALIGN - 1)
+		     & ~(uintptr_t)(CLONE_ALIGN - 1));
+     memset(base, 0, total);
+
+     for (i = 0; i < n; ++i) {
+	  int r = region[i];
+	  uintptr_t a = (uintptr_t)UNTAINT(in[i]);
+	  out[i] = (R *)((uintptr_t)(base + off[r] + (a - start[r]))
+			 | TAINTOF(in[i]));
+     }
+
+     return (R *)blk;
+}
@@ -25,24 +25,32 @@
 */
 
 
-/* shared twiddle and omega lists, keyed by two/three integers. */
+/* shared twiddle and omega lists, keyed by two/three integers and by
+   how the entry was computed.  (Omegas computed while AWAKE_ZERO for
+   measurement are all zero; a plan being measured in one thread must
+   not lend them to a plan being woken for real in another.) */
 struct rader_tls {
      INT k1, k2, k3;
+     enum wakefulness wakefulness;
      R *W;
      int refcnt;
      rader_tl *cdr; 
 };
 
-void X(rader_tl_insert)(INT k1, INT k2, INT k3, R *W, rader_tl **tl)
+void X(rader_tl_insert)(INT k1, INT k2, INT k3, enum wakefulness wakefulness,
+			R *W, rader_tl **tl)
 {
      rader_tl *t = (rader_tl *) MALLOC(sizeof(rader_tl), TWIDDLES);
      t->k1 = k1; t->k2 = k2; t->k3 = k3; t->W = W;
+     t->wakefulness = wakefulness;
      t->refcnt = 1; t->cdr = *tl; *tl = t;
 }
 
-R *X(rader_tl_find)(INT k1, INT k2, INT k3, rader_tl *t)
+R *X(rader_tl_find)(INT k1, INT k2, INT k3, enum wakefulness wakefulness,
+		    rader_tl *t)
 {
-     while (t && (t->k1 != k1 || t->k2 != k2 || t->k3 != k3))
+     while (t && (t->k1 != k1 || t->k2 != k2 || t->k3 != k3
+		  || t->wakefulness != wakefulness))
 	  t = t->cdr;
      if (t) {
 	  ++t->refcnt;
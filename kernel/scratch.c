@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Scratch workspaces.
+
+   The buffers that plans allocate while they execute are freed before
+   the plan returns, in the reverse order, so a workspace is a stack:
+   X(scratch_malloc) bumps its top, X(scratch_ifree) pops it back.  A
+   plan's scratch field bounds the depth that its execution reaches (its
+   own buffers plus the deepest of its children's), so that a workspace
+   of that size, made current by X(scratch_enter) around the execution,
+   serves every buffer without touching the heap.  Buffers that do not
+   fit, and those allocated while no workspace is current, come from the
+   heap.
+
+   The current workspace is kept in thread-local storage, so that a
+   workspace made current in one thread (say, by the execution of an
+   FFTW_REALTIME plan) never serves the buffers of another, with or
+   without the threads library.  Compilers without THREAD_LOCAL get it
+   through the hooks below, which the threads library sets; until then
+   no workspace is ever current, and every buffer comes from the heap.
+
+   The threads library also gives each thread a pool
+   (X(scratch_pool_hook)) that keeps the heap buffers it frees, by size
+   class, for the next executions of any plan in that thread: executing
+   again stops calling malloc, and the memory kept is that of the
+   largest execution of the thread rather than the sum over the plans.
+   Every POOL_TRIM buffers, a pool gives back to the heap the idle
+   buffers of each class beyond the most of that class in use at once
+   since the previous trim, and it never keeps more than
+   X(scratch_pool_budget) idle bytes.  Without the threads library
+   there is no pool, since plans may be executed by several threads at
+   once. */
+
+#include "kernel/ifftw.h"
+
+#ifdef THREAD_LOCAL
+static THREAD_LOCAL scratch *cur = 0;
+#else
+scratch *(*X(scratch_get_hook))(void) = 0;
+void (*X(scratch_set_hook))(scratch *s) = 0;
+#endif
+scratch_pool *(*X(scratch_pool_hook))(void) = 0;
+size_t X(scratch_pool_budget) = (size_t) 64 * 1024 * 1024;
+
+/* classes of 4 sizes an octave, from 1 << POOL_MIN_LG bytes; larger
+   buffers bypass the pool */
+#define POOL_MIN_LG 8
+#define POOL_NCLASS 64
+#define POOL_TRIM 256
+
+/* before each heap buffer, keeping its alignment */
+typedef struct block_s {
+     struct block_s *next;	/* in the free list of its class */
+     scratch_pool *pool;	/* that it came from, or 0 */
+     int cls;			/* in POOL, or -1 */
+} block;
+
+#define HDR SCRATCH_SIZE(sizeof(block))
+
+struct scratch_pool_s {
+     struct {
+	  block *free;
+	  int nfree, live, hwm;	/* idle, in use, max in use */
+     } c[POOL_NCLASS];
+     int nalloc;		/* since the last trim */
+     size_t held, idle, peak;
+     double hits, misses, trimmed;
+};
+
+static int class_of(size_t n)
+{
+     size_t oct = (size_t) 1 << POOL_MIN_LG;
+     int c = 0;
+
+     if (n <= oct)
+	  return 0;
+     while (n > 2 * oct) {
+	  oct *= 2;
+	  c += 4;
+     }
+     c += (int) ((n - oct + (oct / 4 - 1)) / (oct / 4));
+     return c < POOL_NCLASS ? c : -1;
+}
+
+static size_t class_size(int c)
+{
+     return (size_t) (4 + c % 4) << (c / 4 + POOL_MIN_LG - 2);
+}
+
+scratch_pool *X(mkscratch_pool)(void)
+{
+     scratch_pool *p = (scratch_pool *) MALLOC(sizeof(scratch_pool), OTHER);
+     int c;
+
+     for (c = 0; c < POOL_NCLASS; ++c) {
+	  p->c[c].free = 0;
+	  p->c[c].nfree = p->c[c].live = p->c[c].hwm = 0;
+     }
+     p->nalloc = 0;
+     p->held = p->idle = p->peak = 0;
+     p->hits = p->misses = p->trimmed = 0;
+     return p;
+}
+
+/* give an idle buffer of class C back to the heap */
+static void release(scratch_pool *p, int c)
+{
+     block *b = p->c[c].free;
+
+     p->c[c].free = b->next;
+     --p->c[c].nfree;
+     p->idle -= class_size(c);
+     p->held -= class_size(c);
+     ++p->trimmed;
+     X(ifree)(b);
+}
+
+static void trim(scratch_pool *p)
+{
+     int c;
+
+     p->nalloc = 0;
+     for (c = POOL_NCLASS - 1; c >= 0; --c) {
+	  while (p->c[c].nfree > 0
+		 && (p->c[c].nfree + p->c[c].live > p->c[c].hwm
+		     || p->idle > X(scratch_pool_budget)))
+	       release(p, c);
+	  p->c[c].hwm = p->c[c].live;
+     }
+}
+
+/* give every idle buffer back to the heap */
+void X(scratch_pool_flush)(scratch_pool *p)
+{
+     int c;
+
+     for (c = 0; c < POOL_NCLASS; ++c)
+	  while (p->c[c].nfree > 0)
+	       release(p, c);
+}
+
+/* no buffer of P may be in use */
+void X(scratch_pool_destroy)(scratch_pool *p)
+{
+     X(scratch_pool_flush)(p);
+     X(ifree)(p);
+}
+
+void X(scratch_pool_add_stats)(const scratch_pool *p, scratch_pool_stats *s)
+{
+     s->bytes += p->held;
+     s->peak += p->peak;
+     s->hits += p->hits;
+     s->misses += p->misses;
+     s->trimmed += p->trimmed;
+}
+
+static void *heap_malloc(size_t n)
+{
+     scratch_pool *p = X(scratch_pool_hook) ? X(scratch_pool_hook)() : 0;
+     int c = (p && X(scratch_pool_budget)) ? class_of(n) : -1;
+     block *b;
+
+     if (p && ++p->nalloc >= POOL_TRIM)
+	  trim(p);
+     if (c < 0) {
+	  b = (block *) MALLOC(HDR + n, BUFFERS);
+     } else {
+	  if ((b = p->c[c].free)) {
+	       p->c[c].free = b->next;
+	       --p->c[c].nfree;
+	       p->idle -= class_size(c);
+	       ++p->hits;
+	  } else {
+	       b = (block *) MALLOC(HDR + class_size(c), BUFFERS);
+	       p->held += class_size(c);
+	       if (p->held > p->peak)
+		    p->peak = p->held;
+	       ++p->misses;
+	  }
+	  if (++p->c[c].live > p->c[c].hwm)
+	       p->c[c].hwm = p->c[c].live;
+     }
+     b->pool = c < 0 ? 0 : p;
+     b->cls = c;
+     return (char *) b + HDR;
+}
+
+static void heap_ifree(void *q)
+{
+     block *b = (block *) ((char *) q - HDR);
+     scratch_pool *p = b->pool;
+     int c = b->cls;
+
+     if (!p) {
+	  X(ifree)(b);
+	  return;
+     }
+
+     /* back to the pool it came from, which only its thread touches:
+	a plan frees its buffers in the thread that allocated them */
+     A(!X(scratch_pool_hook) || p == X(scratch_pool_hook)());
+     --p->c[c].live;
+     b->next = p->c[c].free;
+     p->c[c].free = b;
+     ++p->c[c].nfree;
+     p->idle += class_size(c);
+     if (p->idle > X(scratch_pool_budget))
+	  release(p, c);
+}
+
+#ifdef THREAD_LOCAL
+static scratch *current(void) { return cur; }
+static void set_current(scratch *s) { cur = s; }
+#else
+static scratch *current(void)
+{
+     return X(scratch_get_hook) ? X(scratch_get_hook)() : 0;
+}
+
+static void set_current(scratch *s)
+{
+     if (X(scratch_set_hook))
+	  X(scratch_set_hook)(s);
+}
+#endif
+
+/* S is the SIZE bytes at MEM, less what aligning them costs */
+void X(scratch_init)(scratch *s, void *mem, size_t size)
+{
+     uintptr_t a = ((uintptr_t) mem + (SCRATCH_ALIGN - 1))
+	  & ~(uintptr_t) (SCRATCH_ALIGN - 1);
+
+     s->used = 0;
+     if (mem && size >= (size_t) (a - (uintptr_t) mem) + SCRATCH_ALIGN) {
+	  s->base = (char *) a;
+	  s->size = size - (size_t) (a - (uintptr_t) mem);
+     } else {
+	  s->base = 0;
+	  s->size = 0;
+     }
+}
+
+/* make S current in this thread; returns the workspace it replaces, to
+   be given to X(scratch_leave) */
+scratch *X(scratch_enter)(scratch *s)
+{
+     scratch *prev = current();
+
+     if (s != prev)
+	  set_current(s);
+     return prev;
+}
+
+void X(scratch_leave)(scratch *prev)
+{
+     if (current() != prev)
+	  set_current(prev);
+}
+
+void *X(scratch_malloc)(size_t n)
+{
+     scratch *s = current();
+
+     if (s && s->base) {
+	  size_t m = SCRATCH_SIZE(n);
+	  if (m <= s->size - s->used) {
+	       void *p = s->base + s->used;
+	       s->used += m;
+	       return p;
+	  }
+     }
+     return heap_malloc(n);
+}
+
+void X(scratch_ifree)(void *p)
+{
+     scratch *s = current();
+
+     if (s && (char *) p >= s->base && (char *) p < s->base + s->size) {
+	  A((size_t) ((char *) p - s->base) < s->used);
+	  s->used = (size_t) ((char *) p - s->base);
+     } else
+	  heap_ifree(p);
+}
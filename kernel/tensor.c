@@ -54,9 +54,9 @@ tensor *X(mktensor)(int rnk)
 void X(tensor_destroy)(tensor *sz)
 {
 #if !defined(STRUCT_HACK_C99) && !defined(STRUCT_HACK_KR)
-     X(ifree0)(sz->dims);
+     X(arena_ifree)(sz->dims);
 #endif
-     X(ifree)(sz);
+     X(arena_ifree)(sz);
 }
 
 INT X(tensor_sz)(const tensor *sz)
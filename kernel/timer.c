@@ -33,6 +33,9 @@
 #define FFTW_TIME_LIMIT 2.0  /* don't run for more than two seconds */
 #endif
 
+void *(*X(measure_pin_hook))(void) = 0;
+void (*X(measure_unpin_hook))(void *saved) = 0;
+
 /* the following code is disabled for now, because it seems to
    require that we #include <windows.h> in ifftw.h to 
    typedef LARGE_INTEGER crude_time, and this pulls in the whole
@@ -139,14 +142,135 @@ typedef crude_time ticks;
   }
 
 
-  double X(measure_execution_time)(const planner *plnr, 
-				   plan *pln, const problem *p)
+  /* Robust timing.  The minimum of a few runs rewards the plan that
+     got lucky once; on a busy machine, or one whose clock changes
+     speed, it need not be the plan that wins in steady state.  Here
+     the runs that find the iteration count, and a few more, are
+     thrown away as warm-up, and the result is the median of at least
+     ROBUST_MIN runs.  Sampling stops as soon as the median is known
+     to within ROBUST_TIMING_TOL, or is clearly slower than BOUND (the
+     best plan so far), or time runs out.  In the pinned mode
+     (robust_timing == 2) the calling thread stays on one cpu for all
+     the runs of a plan, so that they do not differ by where the
+     scheduler put them, nor by the caches they left behind. */
+#  define ROBUST_WARMUP 2
+#  define ROBUST_MIN 5
+#  define ROBUST_MAX 15
+#  ifndef ROBUST_TIME_MIN
+#    define ROBUST_TIME_MIN (TIME_MIN * 10.0)
+#  endif
+
+  static void sort(double *t, int n)
+  {
+       int i, j;
+       for (i = 1; i < n; ++i) {
+	    double x = t[i];
+	    for (j = i; j > 0 && t[j - 1] > x; --j)
+		 t[j] = t[j - 1];
+	    t[j] = x;
+       }
+  }
+
+  static double median_of_sorted(const double *s, int n)
+  {
+       return (n % 2) ? s[n / 2] : 0.5 * (s[n / 2 - 1] + s[n / 2]);
+  }
+
+  /* median of T[0..N-1], and the square of the half-width of its 95%
+     confidence interval: 1.4826 MAD estimates sigma, and the standard
+     error of the median is 1.2533 sigma / sqrt(n) */
+  static double median_ci(const double *t, int n, double *hw2)
+  {
+       double s[ROBUST_MAX], med, mad, k;
+       int i;
+
+       for (i = 0; i < n; ++i) s[i] = t[i];
+       sort(s, n);
+       med = median_of_sorted(s, n);
+       for (i = 0; i < n; ++i) 
+	    s[i] = (t[i] > med) ? t[i] - med : med - t[i];
+       sort(s, n);
+       mad = median_of_sorted(s, n);
+
+       k = 1.96 * 1.2533 * 1.4826 * mad;
+       *hw2 = k * k / n;
+       return med;
+  }
+
+  /* an iteration count that makes a sample of PLN long enough to
+     average out interrupts and the like */
+  static int robust_iter(const planner *plnr, plan *pln, const problem *p)
+  {
+       int iter;
+
+       for (;;) {
+	    for (iter = 1; iter; iter *= 2) {
+		 double t0 = measure(pln, p, iter);
+		 if (plnr->cost_hook)
+		      t0 = plnr->cost_hook(p, t0, COST_MAX);
+		 if (t0 < 0)
+		      break;
+		 if (t0 >= ROBUST_TIME_MIN)
+		      return iter;
+	    }
+       }
+  }
+
+  static double measure_robust(const planner *plnr, plan *pln,
+			       const problem *p, double bound)
+  {
+       double t[ROBUST_MAX];
+       int iter, n, i;
+       crude_time begin;
+       void *pinned = 0;
+
+       if (plnr->robust_timing > 1 && X(measure_pin_hook))
+	    pinned = X(measure_pin_hook)();
+
+  start_over:
+       iter = robust_iter(plnr, pln, p);
+       for (i = 0; i < ROBUST_WARMUP; ++i)
+	    measure(pln, p, iter);
+
+       begin = X(get_crude_time)();
+       for (n = 0; n < ROBUST_MAX; ) {
+	    double hw2, med, x = measure(pln, p, iter);
+
+	    if (plnr->cost_hook)
+		 x = plnr->cost_hook(p, x, COST_MAX);
+	    if (x < 0)
+		 goto start_over;
+	    t[n++] = x / (double) iter;
+
+	    if (n < ROBUST_MIN)
+		 continue;
+	    med = median_ci(t, n, &hw2);
+	    if (hw2 <= (ROBUST_TIMING_TOL * med) * (ROBUST_TIMING_TOL * med))
+		 break; /* precise enough */
+	    if (bound > 0 && med > bound && (med - bound) * (med - bound) > hw2)
+		 break; /* slower than BOUND beyond doubt */
+	    if (X(elapsed_since)(plnr, p, begin) > FFTW_TIME_LIMIT)
+		 break;
+       }
+
+       if (pinned)
+	    X(measure_unpin_hook)(pinned);
+       sort(t, n);
+       return median_of_sorted(t, n);
+  }
+
+  /* time PLN, which must be awake, on P.  Does not touch any global
+     state, so distinct plans may be timed concurrently on distinct
+     problems (see planner.c).  BOUND, if positive, is the time of the
+     best plan so far, which robust timing uses to stop early. */
+  double X(measure_awake_plan)(const planner *plnr, 
+			       plan *pln, const problem *p, double bound)
   {
        int iter;
        int repeat;
 
-       X(plan_awake)(pln, AWAKE_ZERO);
-       p->adt->zero(p);
+       if (plnr->robust_timing)
+	    return measure_robust(plnr, pln, p, bound);
 
   start_over:
        for (iter = 1; iter; iter *= 2) {
@@ -172,19 +296,120 @@ typedef crude_time ticks;
 		      break;
 	    }
 
-	    if (tmin >= TIME_MIN) {
-		 X(plan_awake)(pln, SLEEPY);
+	    if (tmin >= TIME_MIN)
 		 return tmin / (double) iter;
-	    }
        }
        goto start_over; /* may happen if timer is screwed up */
   }
 
+  /* Paired timing.  Two plans timed one after the other still differ
+     by how fast the machine happened to be at either time, which on a
+     busy or throttling machine is more than the few percent that
+     separate close plans; so a call decided by two medians comes out
+     either way from one run to the next.  Here A and B run
+     in turns, alternating which goes first, and the result is the
+     median of the ratios of their times in each turn: whatever slows
+     the machine slows both alike and cancels.  Sampling stops once
+     the ratio is known to be below or above 1 - ROBUST_TIMING_TOL, or
+     after ROBUST_MAX turns, or when time runs out. */
+  double X(measure_ratio)(const planner *plnr,
+			  plan *a, plan *b, const problem *p)
+  {
+       double r[ROBUST_MAX];
+       int itera, iterb, n, i;
+       crude_time begin;
+       void *pinned = 0;
+
+       if (plnr->robust_timing > 1 && X(measure_pin_hook))
+	    pinned = X(measure_pin_hook)();
+
+       X(plan_awake)(a, AWAKE_ZERO);
+       X(plan_awake)(b, AWAKE_ZERO);
+       p->adt->zero(p);
+
+  start_over:
+       itera = robust_iter(plnr, a, p);
+       iterb = robust_iter(plnr, b, p);
+       for (i = 0; i < ROBUST_WARMUP; ++i) {
+	    measure(a, p, itera);
+	    measure(b, p, iterb);
+       }
+
+       begin = X(get_crude_time)();
+       for (n = 0; n < ROBUST_MAX; ) {
+	    double ta, tb, hw2, med, d;
+
+	    if (n % 2) {
+		 tb = measure(b, p, iterb);
+		 ta = measure(a, p, itera);
+	    } else {
+		 ta = measure(a, p, itera);
+		 tb = measure(b, p, iterb);
+	    }
+	    if (plnr->cost_hook) {
+		 ta = plnr->cost_hook(p, ta, COST_MAX);
+		 tb = plnr->cost_hook(p, tb, COST_MAX);
+	    }
+	    if (ta < 0 || tb <= 0)
+		 goto start_over;
+	    r[n++] = (ta / (double) itera) / (tb / (double) iterb);
+
+	    if (n < ROBUST_MIN)
+		 continue;
+	    med = median_ci(r, n, &hw2);
+	    d = med - (1.0 - ROBUST_TIMING_TOL);
+	    if (d * d > hw2)
+		 break; /* decided */
+	    if (X(elapsed_since)(plnr, p, begin) > FFTW_TIME_LIMIT)
+		 break;
+       }
+
+       X(plan_awake)(b, SLEEPY);
+       X(plan_awake)(a, SLEEPY);
+       if (pinned)
+	    X(measure_unpin_hook)(pinned);
+       sort(r, n);
+       return median_of_sorted(r, n);
+  }
+
+  double X(measure_execution_time)(const planner *plnr, 
+				   plan *pln, const problem *p, double bound)
+  {
+       double t;
+
+       X(plan_awake)(pln, AWAKE_ZERO);
+       p->adt->zero(p);
+       t = X(measure_awake_plan)(plnr, pln, p, bound);
+       X(plan_awake)(pln, SLEEPY);
+       return t;
+  }
+
 #else /* no cycle counter */
 
+  double X(measure_ratio)(const planner *plnr,
+			  plan *a, plan *b, const problem *p)
+  {
+       UNUSED(plnr);
+       UNUSED(a);
+       UNUSED(b);
+       UNUSED(p);
+       return -1.0;
+  }
+
   double X(measure_execution_time)(const planner *plnr, 
-				   plan *pln, const problem *p)
+				   plan *pln, const problem *p, double bound)
+  {
+       UNUSED(bound);
+       UNUSED(plnr);
+       UNUSED(p);
+       UNUSED(pln);
+       return -1.0;
+  }
+
+  double X(measure_awake_plan)(const planner *plnr, 
+			       plan *pln, const problem *p, double bound)
   {
+       UNUSED(bound);
        UNUSED(plnr);
        UNUSED(p);
        UNUSED(pln);
@@ -242,9 +242,13 @@ static void twiddle_destroy(twid **pp)
 }
 
 
+void (*X(lock_caches_hook))(void) = 0;
+void (*X(unlock_caches_hook))(void) = 0;
+
 void X(twiddle_awake)(enum wakefulness wakefulness, twid **pp, 
 		      const tw_instr *instr, INT n, INT r, INT m)
 {
+     LOCK_CACHES();
      switch (wakefulness) {
 	 case SLEEPY: 
 	      twiddle_destroy(pp);
@@ -253,4 +257,5 @@ void X(twiddle_awake)(enum wakefulness wakefulness, twid **pp,
 	      mktwiddle(wakefulness, pp, instr, n, r, m);
 	      break;
      }
+     UNLOCK_CACHES();
 }
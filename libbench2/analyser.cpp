@@ -0,0 +1,297 @@
+#include "analyser.h"
+
+#include "api/fftw3.h"
+#include "portaudio-19.7.0/src/common/pa_ringbuffer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <time.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ANALYSER_SSE2 1
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static AnalyserConfig config;
+static double analyserRate = 48000.0;
+static std::atomic<bool> running(false);
+static std::thread worker;
+
+// 1. ݹ -> м : ׷    
+static PaUtilRingBuffer ring;
+static std::vector<float> ringData;
+static std::atomic<unsigned long> dropped(0);
+
+// 2. м  (    Ҵ)
+static std::vector<float> block;                        //  ۿ  ͸ 
+static std::vector<float> history[ANALYSER_CHANNELS];   //  (fftSize - hop) +  batch * hop
+static std::vector<double> window;
+static double* fftIn = nullptr;                         // [ä * batch + ][fftSize]
+static fftw_complex* fftOut = nullptr;                  // [ä * batch + ][bins]
+static fftw_plan plan = nullptr;
+static float magOffsetDb = 0.0f;                        // â ̵  (   dBFS)
+
+// 3. Ʈ : м  back   middle  ¹ٲ,
+//    д      middle  front  ¹ٲ
+constexpr int TRIPLE_FRESH = 4;
+static SpectrumFrame slots[3];
+static std::atomic<int> middle(2);
+static int back = 0;
+static int front = 1;
+
+static std::atomic<unsigned long> framesAnalysed(0);
+static std::atomic<long long> busyNs(0);
+
+AnalyserConfig defaultAnalyserConfig() {
+    AnalyserConfig cfg;
+    cfg.fftSize = 4096;
+    cfg.hop = 1024;       // 75% ħ
+    cfg.batch = 4;
+    cfg.planFlags = FFTW_MEASURE;
+    return cfg;
+}
+
+// 4. α ũ: db[k] = 10 log10(|X[k]|^2) + offsetDb
+// log2   Ʈ +  ׽ ( 1e-4 dB ), SSE2  4
+static const float LOG2_C1 = 1.44182512f, LOG2_C2 = -0.70867494f,
+    LOG2_C3 = 0.41539777f, LOG2_C4 = -0.19439043f, LOG2_C5 = 0.04587075f;
+static const float DB_PER_LOG2 = 3.01029996f;   // 10 log10(2)
+static const float POWER_FLOOR = 1e-30f;
+
+static inline float fastDb(float p, float offsetDb) {
+    if (p < POWER_FLOOR) p = POWER_FLOOR;
+    unsigned int bits;
+    memcpy(&bits, &p, sizeof(bits));
+    float e = (float)((int)(bits >> 23) - 127);
+    bits = (bits & 0x007fffff) | 0x3f800000;
+    float x;
+    memcpy(&x, &bits, sizeof(x));
+    x -= 1.0f;
+    float l = x * (LOG2_C1 + x * (LOG2_C2 + x * (LOG2_C3 + x * (LOG2_C4 + x * LOG2_C5))));
+    return (e + l) * DB_PER_LOG2 + offsetDb;
+}
+
+static void logMagnitude(const fftw_complex* X, float* db, int n, float offsetDb) {
+    int k = 0;
+#ifdef ANALYSER_SSE2
+    const __m128 floor = _mm_set1_ps(POWER_FLOOR);
+    const __m128 mantMask = _mm_castsi128_ps(_mm_set1_epi32(0x007fffff));
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128i bias = _mm_set1_epi32(127);
+    const __m128 scale = _mm_set1_ps(DB_PER_LOG2);
+    const __m128 offset = _mm_set1_ps(offsetDb);
+
+    for (; k + 4 <= n; k += 4) {
+        __m128d c0 = _mm_loadu_pd(X[k]), c1 = _mm_loadu_pd(X[k + 1]);
+        __m128d c2 = _mm_loadu_pd(X[k + 2]), c3 = _mm_loadu_pd(X[k + 3]);
+        c0 = _mm_mul_pd(c0, c0);
+        c1 = _mm_mul_pd(c1, c1);
+        c2 = _mm_mul_pd(c2, c2);
+        c3 = _mm_mul_pd(c3, c3);
+        __m128d p01 = _mm_add_pd(_mm_unpacklo_pd(c0, c1), _mm_unpackhi_pd(c0, c1));
+        __m128d p23 = _mm_add_pd(_mm_unpacklo_pd(c2, c3), _mm_unpackhi_pd(c2, c3));
+        __m128 p = _mm_movelh_ps(_mm_cvtpd_ps(p01), _mm_cvtpd_ps(p23));
+        p = _mm_max_ps(p, floor);
+
+        __m128i bits = _mm_castps_si128(p);
+        __m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), bias));
+        __m128 x = _mm_sub_ps(_mm_or_ps(_mm_and_ps(p, mantMask), one), one);
+        __m128 l = _mm_add_ps(_mm_set1_ps(LOG2_C4), _mm_mul_ps(x, _mm_set1_ps(LOG2_C5)));
+        l = _mm_add_ps(_mm_set1_ps(LOG2_C3), _mm_mul_ps(x, l));
+        l = _mm_add_ps(_mm_set1_ps(LOG2_C2), _mm_mul_ps(x, l));
+        l = _mm_add_ps(_mm_set1_ps(LOG2_C1), _mm_mul_ps(x, l));
+        l = _mm_mul_ps(x, l);
+
+        _mm_storeu_ps(db + k, _mm_add_ps(_mm_mul_ps(_mm_add_ps(e, l), scale), offset));
+    }
+#endif
+    for (; k < n; ++k) {
+        double re = X[k][0], im = X[k][1];
+        db[k] = fastDb((float)(re * re + im * im), offsetDb);
+    }
+}
+
+static float levelDb(double power) {
+    return power > 1e-20 ? (float)(10.0 * log10(power)) : -200.0f;
+}
+
+//  尡  CPU ð (ns).  CPU ð谡  ð 
+static long long threadCpuNs() {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#endif
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void publish() {
+    back = middle.exchange(back | TRIPLE_FRESH, std::memory_order_acq_rel) & 3;
+}
+
+// 5. м 
+static void analyserLoop() {
+    const int N = config.fftSize, H = config.hop, B = config.batch;
+    const int bins = N / 2 + 1;
+    const int keep = N - H;
+    const int fresh = B * H;
+    const std::chrono::microseconds idle((long long)(fresh / analyserRate * 1e6 / 4));
+    unsigned long long samplesIn = 0;
+    unsigned long seq = 0;
+
+    while (running.load(std::memory_order_acquire)) {
+        if (PaUtil_GetRingBufferReadAvailable(&ring) < fresh) {
+            std::this_thread::sleep_for(idle);
+            continue;
+        }
+        long long t0 = threadCpuNs();
+
+        PaUtil_ReadRingBuffer(&ring, block.data(), fresh);
+        for (int c = 0; c < ANALYSER_CHANNELS; ++c) {
+            float* h = history[c].data() + keep;
+            for (int i = 0; i < fresh; ++i)
+                h[i] = block[i * ANALYSER_CHANNELS + c];
+        }
+
+        for (int c = 0; c < ANALYSER_CHANNELS; ++c)
+            for (int b = 0; b < B; ++b) {
+                const float* h = history[c].data() + b * H;
+                double* in = fftIn + (size_t)(c * B + b) * N;
+                for (int n = 0; n < N; ++n)
+                    in[n] = h[n] * window[n];
+            }
+        fftw_execute(plan);
+
+        for (int b = 0; b < B; ++b) {
+            SpectrumFrame& f = slots[back];
+            for (int c = 0; c < ANALYSER_CHANNELS; ++c) {
+                logMagnitude(fftOut + (size_t)(c * B + b) * bins, f.magDb[c].data(), bins,
+                    magOffsetDb);
+
+                //  ӿ   hop 
+                const float* h = history[c].data() + b * H + keep;
+                double sum = 0.0, peak = 0.0;
+                for (int i = 0; i < H; ++i) {
+                    double x = h[i];
+                    sum += x * x;
+                    if (fabs(x) > peak) peak = fabs(x);
+                }
+                f.rmsDb[c] = levelDb(sum / H);
+                f.peakDb[c] = levelDb(peak * peak);
+            }
+            f.seq = ++seq;
+            f.time = (double)(samplesIn + (unsigned long long)(b + 1) * H) / analyserRate;
+            publish();
+        }
+        samplesIn += fresh;
+
+        for (int c = 0; c < ANALYSER_CHANNELS; ++c)
+            memmove(history[c].data(), history[c].data() + fresh, keep * sizeof(float));
+
+        framesAnalysed.fetch_add(B, std::memory_order_relaxed);
+        busyNs.fetch_add(threadCpuNs() - t0, std::memory_order_relaxed);
+    }
+}
+
+bool analyserStart(const AnalyserConfig& cfg, double sampleRate) {
+    analyserStop();
+
+    if (cfg.fftSize < 16 || cfg.hop < 1 || cfg.hop > cfg.fftSize || cfg.batch < 1)
+        return false;
+    config = cfg;
+    analyserRate = sampleRate;
+
+    const int N = config.fftSize, B = config.batch;
+    const int bins = N / 2 + 1;
+    const int howmany = ANALYSER_CHANNELS * B;
+
+    fftIn = fftw_alloc_real((size_t)howmany * N);
+    fftOut = fftw_alloc_complex((size_t)howmany * bins);
+    plan = fftw_plan_many_dft_r2c(1, &config.fftSize, howmany,
+        fftIn, nullptr, 1, N, fftOut, nullptr, 1, bins, config.planFlags);
+    if (!plan) {
+        analyserStop();
+        return false;
+    }
+
+    // ֱ Hann â,   0 dBFS  ǵ 
+    window.resize(N);
+    double windowSum = 0.0;
+    for (int n = 0; n < N; ++n) {
+        window[n] = 0.5 - 0.5 * cos(2.0 * M_PI * n / N);
+        windowSum += window[n];
+    }
+    magOffsetDb = (float)(20.0 * log10(2.0 / windowSum));
+
+    //  :    ̻, 2 ŵ
+    long ringFrames = 1 << 15;
+    while (ringFrames < 4L * (N + B * config.hop)) ringFrames <<= 1;
+    ringData.assign((size_t)ringFrames * ANALYSER_CHANNELS, 0.0f);
+    PaUtil_InitializeRingBuffer(&ring, sizeof(float) * ANALYSER_CHANNELS, ringFrames,
+        ringData.data());
+
+    block.assign((size_t)B * config.hop * ANALYSER_CHANNELS, 0.0f);
+    for (int c = 0; c < ANALYSER_CHANNELS; ++c)
+        history[c].assign(N - config.hop + B * config.hop, 0.0f);
+
+    for (int s = 0; s < 3; ++s) {
+        slots[s].seq = 0;
+        slots[s].time = 0.0;
+        for (int c = 0; c < ANALYSER_CHANNELS; ++c) {
+            slots[s].rmsDb[c] = slots[s].peakDb[c] = -200.0f;
+            slots[s].magDb[c].assign(bins, -200.0f);
+        }
+    }
+    back = 0;
+    front = 1;
+    middle.store(2);
+
+    dropped.store(0);
+    framesAnalysed.store(0);
+    busyNs.store(0);
+
+    running.store(true, std::memory_order_release);
+    worker = std::thread(analyserLoop);
+    return true;
+}
+
+void analyserStop() {
+    running.store(false, std::memory_order_release);
+    if (worker.joinable()) worker.join();
+
+    if (plan) fftw_destroy_plan(plan);
+    if (fftIn) fftw_free(fftIn);
+    if (fftOut) fftw_free(fftOut);
+    plan = nullptr;
+    fftIn = nullptr;
+    fftOut = nullptr;
+}
+
+void analyserPush(const float* interleaved, unsigned long frames) {
+    if (!running.load(std::memory_order_relaxed)) return;
+    ring_buffer_size_t n = PaUtil_WriteRingBuffer(&ring, interleaved, (ring_buffer_size_t)frames);
+    if ((unsigned long)n < frames)
+        dropped.fetch_add(frames - n, std::memory_order_relaxed);
+}
+
+const SpectrumFrame& analyserLatest() {
+    if (middle.load(std::memory_order_relaxed) & TRIPLE_FRESH)
+        front = middle.exchange(front, std::memory_order_acq_rel) & 3;
+    return slots[front];
+}
+
+AnalyserStats analyserStats() {
+    AnalyserStats s;
+    s.framesAnalysed = framesAnalysed.load(std::memory_order_relaxed);
+    s.samplesDropped = dropped.load(std::memory_order_relaxed);
+    s.busySeconds = busyNs.load(std::memory_order_relaxed) * 1e-9;
+    return s;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>
+
+//  ͸ ǽð Ʈ/ м
+// -  ݹ analyserPush      (PaUtilRingBuffer) ֱ⸸ 
+// - м (ǽð) â Լ + FFTW r2c  (plan_many) ϰ
+//   α ũ⸦  Ʈ ۷ Խ
+// - ȭ  analyserLatest   ֱ    
+
+constexpr int ANALYSER_CHANNELS = 2;
+
+struct AnalyserConfig {
+    int fftSize;            // FFT ũ (â )
+    int hop;                //   (fftSize / 4 ̸ 75% ħ)
+    int batch;              //   ȯϴ   (äθ)
+    unsigned int planFlags; // FFTW ÷ ÷
+};
+
+struct SpectrumFrame {
+    unsigned long seq;                          // Խ  (0:  )
+    double time;                                //   ð ()
+    float rmsDb[ANALYSER_CHANNELS];             //   hop   (dBFS)
+    float peakDb[ANALYSER_CHANNELS];
+    std::vector<float> magDb[ANALYSER_CHANNELS]; // fftSize / 2 + 1   (dBFS)
+};
+
+struct AnalyserStats {
+    unsigned long framesAnalysed;   // Խ Ʈ  
+    unsigned long samplesDropped;   //  ۰      
+    double busySeconds;             // м 尡 꿡  CPU ð
+};
+
+AnalyserConfig defaultAnalyserConfig();
+
+//    ȣ (FFTW ÷   忡)
+bool analyserStart(const AnalyserConfig& cfg, double sampleRate);
+void analyserStop();
+
+//  ݹ鿡: ͸ ׷   (Ҵ/ , ġ )
+void analyserPush(const float* interleaved, unsigned long frames);
+
+// ȭ   ϳ:  ֱ  ( ȣ  ȿ)
+const SpectrumFrame& analyserLatest();
+
+AnalyserStats analyserStats();
@@ -0,0 +1,209 @@
+#include "room.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+constexpr float SPEED_OF_SOUND = 343.0f;    // m/s
+constexpr int ROOM_MAX_BLOCK = 4096;        //   ִ  
+constexpr unsigned int ROOM_BUS_MASK = ROOM_BUS_LENGTH - 1;
+constexpr unsigned int ROOM_MAX_DELAY = ROOM_BUS_LENGTH - ROOM_MAX_BLOCK - 2;
+constexpr int ROOM_FDN_MAX = 8192;          // FDN  ִ 
+
+static RoomConfig room;
+static float roomSampleRate = 44100.0f;
+
+//  : ̷ ġ  ְ  ġ   0 
+static float busData[ROOM_DIRECTIONS][ROOM_BUS_LENGTH];
+static float busGainL[ROOM_DIRECTIONS];
+static float busGainR[ROOM_DIRECTIONS];
+static unsigned int busBase = 0;
+
+// FDN 
+static float fdnData[ROOM_FDN_LINES][ROOM_FDN_MAX];
+static int fdnLength[ROOM_FDN_LINES];
+static int fdnPos[ROOM_FDN_LINES];
+static float fdnGain[ROOM_FDN_LINES];
+static float fdnLowpass[ROOM_FDN_LINES];
+constexpr float FDN_DAMPING = 0.35f;        //   (0: , 1: )
+
+RoomConfig defaultRoomConfig() {
+    RoomConfig cfg;
+    cfg.width = 6.0f;
+    cfg.height = 3.0f;
+    cfg.depth = 8.0f;
+    cfg.listenerX = 3.0f;
+    cfg.listenerY = 1.5f;
+    cfg.listenerZ = 3.0f;
+    cfg.sourceDistance = 2.0f;
+    cfg.absorption = 0.3f;
+    cfg.order = 2;
+    cfg.earlyLevel = 0.5f;
+    cfg.lateLevel = 0.15f;
+    return cfg;
+}
+
+static bool isPrime(int n) {
+    if (n < 2) return false;
+    for (int d = 2; d * d <= n; ++d)
+        if (n % d == 0) return false;
+    return true;
+}
+
+static float clampf(float v, float lo, float hi) {
+    if (v < lo) return lo;
+    if (v > hi) return hi;
+    return v;
+}
+
+void roomInit(const RoomConfig& cfg, float sampleRate) {
+    room = cfg;
+    roomSampleRate = sampleRate;
+    if (room.order < 1) room.order = 1;
+    if (room.order > ROOM_MAX_ORDER) room.order = ROOM_MAX_ORDER;
+    room.absorption = clampf(room.absorption, 0.01f, 1.0f);
+
+    //   д ( 0,  +),  Ӹ ׸  ణ 
+    for (int b = 0; b < ROOM_DIRECTIONS; ++b) {
+        float az = b * 2.0f * (float)M_PI / ROOM_DIRECTIONS;
+        float pan = sinf(az);
+        float rear = cosf(az) < 0.0f ? 0.7f : 1.0f;
+        busGainL[b] = (1.0f - pan) * 0.5f * rear;
+        busGainR[b] = (1.0f + pan) * 0.5f * rear;
+    }
+
+    // Sabine   ð 
+    float V = room.width * room.height * room.depth;
+    float S = 2.0f * (room.width * room.height + room.width * room.depth
+        + room.height * room.depth);
+    float rt60 = clampf(0.161f * V / (S * room.absorption), 0.1f, 5.0f);
+
+    //   θ  μ(Ҽ)  
+    float meanFreePath = 4.0f * V / S;
+    int base = (int)(meanFreePath / SPEED_OF_SOUND * sampleRate);
+    static const float spread[ROOM_FDN_LINES] = { 1.0f, 1.13f, 1.27f, 1.41f };
+    for (int k = 0; k < ROOM_FDN_LINES; ++k) {
+        int len = (int)(base * spread[k]);
+        if (len < 64) len = 64 + 16 * k;
+        if (len > ROOM_FDN_MAX - 1) len = ROOM_FDN_MAX - 1 - 16 * k;
+        while (!isPrime(len)) --len;
+        fdnLength[k] = len;
+        fdnGain[k] = powf(10.0f, -3.0f * len / (sampleRate * rt60));
+    }
+
+    roomReset();
+}
+
+void roomReset() {
+    memset(busData, 0, sizeof(busData));
+    memset(fdnData, 0, sizeof(fdnData));
+    for (int k = 0; k < ROOM_FDN_LINES; ++k) {
+        fdnPos[k] = 0;
+        fdnLowpass[k] = 0.0f;
+    }
+    busBase = 0;
+}
+
+//   n ° ̹ ǥ ( 0  size)
+static float imageCoord(int n, float pos, float size) {
+    return n * size + ((n & 1) ? size - pos : pos);
+}
+
+void roomUpdateSource(RoomSource& src, float x, float y, float z) {
+    float sx = clampf(room.listenerX + x * room.sourceDistance, 0.1f, room.width - 0.1f);
+    float sy = clampf(room.listenerY + y * room.sourceDistance, 0.1f, room.height - 0.1f);
+    float sz = clampf(room.listenerZ + z * room.sourceDistance, 0.1f, room.depth - 0.1f);
+
+    float dx0 = sx - room.listenerX, dy0 = sy - room.listenerY, dz0 = sz - room.listenerZ;
+    float direct = sqrtf(dx0 * dx0 + dy0 * dy0 + dz0 * dz0);
+    if (direct < 0.1f) direct = 0.1f;
+
+    float reflect = sqrtf(1.0f - room.absorption);
+    float samplesPerMeter = roomSampleRate / SPEED_OF_SOUND;
+    int N = room.order;
+
+    src.numTaps = 0;
+    for (int nx = -N; nx <= N; ++nx)
+        for (int ny = -N; ny <= N; ++ny)
+            for (int nz = -N; nz <= N; ++nz) {
+                int order = abs(nx) + abs(ny) + abs(nz);
+                if (order == 0 || order > N) continue;
+
+                float dx = imageCoord(nx, sx, room.width) - room.listenerX;
+                float dy = imageCoord(ny, sy, room.height) - room.listenerY;
+                float dz = imageCoord(nz, sz, room.depth) - room.listenerZ;
+                float dist = sqrtf(dx * dx + dy * dy + dz * dz);
+
+                float d = (dist - direct) * samplesPerMeter;
+                if (d < 0.0f) d = 0.0f;
+                if (d > (float)ROOM_MAX_DELAY) continue;
+
+                //     
+                float az = atan2f(dx, dz);
+                if (az < 0.0f) az += 2.0f * (float)M_PI;
+                int bus = (int)floorf(az / (2.0f * (float)M_PI) * ROOM_DIRECTIONS + 0.5f)
+                    % ROOM_DIRECTIONS;
+
+                RoomTap& t = src.taps[src.numTaps++];
+                t.bus = bus;
+                t.delay = (unsigned int)d;
+                t.frac = d - (float)t.delay;
+                t.gain = room.earlyLevel * powf(reflect, (float)order) * direct / dist;
+            }
+}
+
+void roomWriteSource(const RoomSource& src, float sample, unsigned int frame) {
+    unsigned int base = busBase + frame;
+    for (int k = 0; k < src.numTaps; ++k) {
+        const RoomTap& t = src.taps[k];
+        float v = sample * t.gain;
+        float* bus = busData[t.bus];
+        unsigned int p = (base + t.delay) & ROOM_BUS_MASK;
+        bus[p] += v * (1.0f - t.frac);
+        bus[(p + 1) & ROOM_BUS_MASK] += v * t.frac;
+    }
+}
+
+void roomProcess(float* out, unsigned long frames) {
+    for (unsigned long i = 0; i < frames; ++i) {
+        unsigned int p = (busBase + (unsigned int)i) & ROOM_BUS_MASK;
+
+        // 1. ʱ ݻ:    -> ׷
+        float early = 0.0f, left = 0.0f, right = 0.0f;
+        for (int b = 0; b < ROOM_DIRECTIONS; ++b) {
+            float v = busData[b][p];
+            busData[b][p] = 0.0f;
+            left += v * busGainL[b];
+            right += v * busGainR[b];
+            early += v;
+        }
+
+        // 2. ı : 4x4 Hadamard ȯ  FDN
+        float o[ROOM_FDN_LINES], g[ROOM_FDN_LINES];
+        for (int k = 0; k < ROOM_FDN_LINES; ++k) {
+            o[k] = fdnData[k][fdnPos[k]];
+            fdnLowpass[k] += (1.0f - FDN_DAMPING) * (o[k] - fdnLowpass[k]);
+            if (fabsf(fdnLowpass[k]) < 1e-15f) fdnLowpass[k] = 0.0f; // ȭ  
+            g[k] = fdnLowpass[k] * fdnGain[k];
+        }
+        float in = early * 0.5f;
+        float m[ROOM_FDN_LINES] = {
+            0.5f * (g[0] + g[1] + g[2] + g[3]),
+            0.5f * (g[0] - g[1] + g[2] - g[3]),
+            0.5f * (g[0] + g[1] - g[2] - g[3]),
+            0.5f * (g[0] - g[1] - g[2] + g[3])
+        };
+        for (int k = 0; k < ROOM_FDN_LINES; ++k) {
+            fdnData[k][fdnPos[k]] = in + m[k];
+            if (++fdnPos[k] >= fdnLength[k]) fdnPos[k] = 0;
+        }
+
+        out[i * 2] += left + room.lateLevel * (o[0] + o[2]) * 0.5f;
+        out[i * 2 + 1] += right + room.lateLevel * (o[1] + o[3]) * 0.5f;
+    }
+    busBase = (busBase + (unsigned int)frames) & ROOM_BUS_MASK;
+}
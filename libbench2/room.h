@@ -0,0 +1,49 @@
+#pragma once
+
+// ü(shoebox)  ʱ ݻ + FDN 
+// - ݻ (̹ ҽ)  ֱ( ٲ ) 
+// - ݻ ҽ  ʰ     
+//   м    
+// - ϴ  (  + FDN) , ҽ  
+
+constexpr int ROOM_MAX_ORDER = 3;       // ִ ݻ 
+constexpr int ROOM_DIRECTIONS = 8;      //     (45 )
+constexpr int ROOM_MAX_TAPS = 62;       // 3 ̹ ҽ  ( )
+constexpr int ROOM_BUS_LENGTH = 16384;  //    (2 ŵ)
+constexpr int ROOM_FDN_LINES = 4;       // FDN  
+
+struct RoomConfig {
+    float width, height, depth;          //  ũ (m): x, y, z
+    float listenerX, listenerY, listenerZ; // û ġ (m)
+    float sourceDistance;                //  ǥ ->  Ÿ (m)
+    float absorption;                    //   0~1
+    int order;                           // ݻ  1~3
+    float earlyLevel;                    // ʱ ݻ 
+    float lateLevel;                     // FDN  
+};
+
+struct RoomTap {
+    int bus;             //   ȣ
+    unsigned int delay;  //    ( )
+    float frac;          // м 
+    float gain;
+};
+
+struct RoomSource {
+    RoomTap taps[ROOM_MAX_TAPS];
+    int numTaps;
+};
+
+RoomConfig defaultRoomConfig();
+
+void roomInit(const RoomConfig& cfg, float sampleRate);
+void roomReset();
+
+//  ֱ: ҽ ġ(û   ǥ) ݻ  
+void roomUpdateSource(RoomSource& src, float x, float y, float z);
+
+//  ֱ:   frame °  ݻ ǿ  
+void roomWriteSource(const RoomSource& src, float sample, unsigned int frame);
+
+// ϸ  :  о ׷ out  ϰ FDN  
+void roomProcess(float* out, unsigned long frames);
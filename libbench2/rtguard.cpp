@@ -0,0 +1,245 @@
+//   ǽð  ˻ - rtguard.h 
+//
+// ä Լ ý (pthread.h, unistd.h, time.h ...) Ϻη
+//  ʴ´. C Ű  Ÿ ɺ  , 
+// 64Ʈ time_t ̷Ʈ   浹 ʰ ϱ .
+
+#include "rtguard.h"
+
+#ifdef SONIFY_RT_GUARD
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(__GLIBC__)
+#include <dlfcn.h>
+#include <execinfo.h>
+#define RT_GUARD_INTERPOSE 1
+#endif
+
+constexpr int RT_GUARD_FRAMES = 16;
+constexpr unsigned int RT_GUARD_LOG_SIZE = 256;   // 2 ŵ
+
+struct RtViolation {
+    int kind;
+    unsigned long thread;
+    int depth;
+    void* frames[RT_GUARD_FRAMES];
+};
+
+static const char* const kindNames[RT_VIOLATION_KINDS] = {
+    "malloc", "free", "mutex lock", "semaphore wait", "sleep", "blocking I/O"
+};
+
+// 1. 庰  (   TLS    Ҵ )
+static thread_local int rtDepth = 0;      // rtGuardEnter ø 
+static thread_local int rtPaActive = 0;   // PortAudio  μ 
+static thread_local int rtInGuard = 0;    //    
+
+static bool rtAbort = false;
+
+// 2.   α:    fetch_add   ä  seq  Խ,
+//    д (ǽð  ϳ) seq  ´ Ը 
+static RtViolation rtLog[RT_GUARD_LOG_SIZE];
+static std::atomic<unsigned int> rtLogSeq[RT_GUARD_LOG_SIZE];
+static std::atomic<unsigned int> rtLogWrite(0);
+static std::atomic<unsigned long> rtViolationCount(0);
+static unsigned int rtLogRead = 0;
+
+static void rtRecord(int kind) {
+    unsigned int i = rtLogWrite.fetch_add(1, std::memory_order_relaxed);
+    RtViolation& v = rtLog[i & (RT_GUARD_LOG_SIZE - 1)];
+    v.kind = kind;
+    v.thread = (unsigned long)&rtDepth;
+#ifdef RT_GUARD_INTERPOSE
+    v.depth = backtrace(v.frames, RT_GUARD_FRAMES);
+#else
+    v.depth = 0;
+#endif
+    rtLogSeq[i & (RT_GUARD_LOG_SIZE - 1)].store(i + 1, std::memory_order_release);
+    rtViolationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (rtAbort) {
+#ifdef RT_GUARD_INTERPOSE
+        backtrace_symbols_fd(v.frames, v.depth, 2);
+#endif
+        abort();
+    }
+}
+
+static inline void rtCheck(int kind) {
+    if ((rtDepth > 0 || rtPaActive) && !rtInGuard) {
+        rtInGuard = 1;
+        rtRecord(kind);
+        rtInGuard = 0;
+    }
+}
+
+void rtGuardEnter() { ++rtDepth; }
+void rtGuardLeave() { --rtDepth; }
+
+// PortAudio  PA_RT_GUARD    pa_process.c  ȣ
+extern "C" void PaUtil_RtGuardEnter(void) { rtPaActive = 1; }
+extern "C" void PaUtil_RtGuardLeave(void) { rtPaActive = 0; }
+
+unsigned long rtGuardViolations() {
+    return rtViolationCount.load(std::memory_order_relaxed);
+}
+
+unsigned long rtGuardDrain(FILE* f) {
+    unsigned long n = 0;
+    unsigned int end = rtLogWrite.load(std::memory_order_acquire);
+
+    while (rtLogRead != end) {
+        unsigned int slot = rtLogRead & (RT_GUARD_LOG_SIZE - 1);
+        unsigned int seq = rtLogSeq[slot].load(std::memory_order_acquire);
+        if (seq != rtLogRead + 1) {
+            if ((int)(seq - (rtLogRead + 1)) > 0) {
+                // б  
+                fprintf(f, "rt-guard: violation record lost (log overflow)\n");
+                ++rtLogRead;
+                continue;
+            }
+            break; //  Խõ 
+        }
+
+        const RtViolation& v = rtLog[slot];
+        fprintf(f, "rt-guard: %s on audio thread %#lx\n", kindNames[v.kind], v.thread);
+        fflush(f);
+#ifdef RT_GUARD_INTERPOSE
+        backtrace_symbols_fd(v.frames, v.depth, fileno(f));
+#endif
+        ++rtLogRead;
+        ++n;
+    }
+    return n;
+}
+
+#ifdef RT_GUARD_INTERPOSE
+
+// 3. Ҵ ä (glibc    ѱ)
+extern "C" {
+void* __libc_malloc(size_t n);
+void __libc_free(void* p);
+void* __libc_calloc(size_t n, size_t m);
+void* __libc_realloc(void* p, size_t n);
+void* __libc_memalign(size_t align, size_t n);
+
+void* malloc(size_t n) noexcept {
+    rtCheck(RT_MALLOC);
+    return __libc_malloc(n);
+}
+
+void free(void* p) noexcept {
+    if (p) rtCheck(RT_FREE);
+    __libc_free(p);
+}
+
+void* calloc(size_t n, size_t m) noexcept {
+    rtCheck(RT_MALLOC);
+    return __libc_calloc(n, m);
+}
+
+void* realloc(void* p, size_t n) noexcept {
+    rtCheck(RT_MALLOC);
+    return __libc_realloc(p, n);
+}
+
+void* memalign(size_t align, size_t n) noexcept {
+    rtCheck(RT_MALLOC);
+    return __libc_memalign(align, n);
+}
+
+void* aligned_alloc(size_t align, size_t n) noexcept {
+    rtCheck(RT_MALLOC);
+    return __libc_memalign(align, n);
+}
+
+int posix_memalign(void** p, size_t align, size_t n) noexcept {
+    rtCheck(RT_MALLOC);
+    if (align % sizeof(void*) != 0 || (align & (align - 1)) != 0)
+        return 22; // EINVAL
+    void* q = __libc_memalign(align, n);
+    if (!q) return 12; // ENOMEM
+    *p = q;
+    return 0;
+}
+}
+
+// 4. /ŷ ȣ ä (dlsym   Ǹ ã ѱ)
+#define RT_REAL(ret, name, params)                                  \
+    typedef ret (*name##_fn) params;                                \
+    static name##_fn real_##name() {                                \
+        static name##_fn fn = 0;                                    \
+        if (!fn) fn = (name##_fn)dlsym(RTLD_NEXT, #name);           \
+        return fn;                                                  \
+    }
+
+RT_REAL(int, pthread_mutex_lock, (void*))
+RT_REAL(int, sem_wait, (void*))
+RT_REAL(int, nanosleep, (const void*, void*))
+RT_REAL(int, usleep, (unsigned int))
+RT_REAL(long, read, (int, void*, size_t))
+RT_REAL(long, write, (int, const void*, size_t))
+RT_REAL(int, poll, (void*, unsigned long, int))
+
+extern "C" {
+int pthread_mutex_lock(void* m) {
+    rtCheck(RT_LOCK);
+    return real_pthread_mutex_lock()(m);
+}
+
+int sem_wait(void* s) {
+    rtCheck(RT_WAIT);
+    return real_sem_wait()(s);
+}
+
+int nanosleep(const void* req, void* rem) {
+    rtCheck(RT_SLEEP);
+    return real_nanosleep()(req, rem);
+}
+
+int usleep(unsigned int us) {
+    rtCheck(RT_SLEEP);
+    return real_usleep()(us);
+}
+
+long read(int fd, void* buf, size_t n) {
+    rtCheck(RT_IO);
+    return real_read()(fd, buf, n);
+}
+
+long write(int fd, const void* buf, size_t n) {
+    rtCheck(RT_IO);
+    return real_write()(fd, buf, n);
+}
+
+int poll(void* fds, unsigned long n, int timeout) {
+    rtCheck(RT_IO);
+    return real_poll()(fds, n, timeout);
+}
+}
+
+#endif /* RT_GUARD_INTERPOSE */
+
+void rtGuardInit(bool abortOnViolation) {
+    const char* env = getenv("SONIFY_RT_ABORT");
+    rtAbort = abortOnViolation || (env && env[0] == '1');
+
+#ifdef RT_GUARD_INTERPOSE
+    // ù backtrace  libgcc  о ̸ ҴϹǷ ̸   ȣ,
+    //  Լ ּҵ    Ȯ
+    void* frames[2];
+    backtrace(frames, 2);
+    real_pthread_mutex_lock();
+    real_sem_wait();
+    real_nanosleep();
+    real_usleep();
+    real_read();
+    real_write();
+    real_poll();
+#endif
+}
+
+#endif /* SONIFY_RT_GUARD */
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdio>
+
+//   ǽð  ˻ ( , SONIFY_RT_GUARD)
+//
+// rtGuardEnter/Leave  ǥ (ݹ) ȿ malloc/free 迭,
+// pthread ؽ/Ǻ/, ŷ ý ȣ ä
+// Ʈ̽ Բ   α׿ Ѵ. FFTW  ε
+//  ɺ Ƿ Բ  (glibc  ä ).
+//
+// PortAudio  PA_RT_GUARD  ϸ  μ
+// (PaUtil_Begin/EndBufferProcessing) ü ˻  ȴ.
+
+enum RtViolationKind {
+    RT_MALLOC,
+    RT_FREE,
+    RT_LOCK,
+    RT_WAIT,
+    RT_SLEEP,
+    RT_IO,
+    RT_VIOLATION_KINDS
+};
+
+#ifdef SONIFY_RT_GUARD
+
+//     : ɺ Ȯ, backtrace غ
+// abortOnViolation Ǵ ȯ溯 SONIFY_RT_ABORT=1 ̸   abort()
+void rtGuardInit(bool abortOnViolation);
+
+//   ˻  (ø )
+void rtGuardEnter();
+void rtGuardLeave();
+
+unsigned long rtGuardViolations();
+
+// ǽð ƴ 忡:  α׸ ϰ   
+unsigned long rtGuardDrain(FILE* f);
+
+#else
+
+inline void rtGuardInit(bool) {}
+inline void rtGuardEnter() {}
+inline void rtGuardLeave() {}
+inline unsigned long rtGuardViolations() { return 0; }
+inline unsigned long rtGuardDrain(FILE*) { return 0; }
+
+#endif
+
+struct RtGuardScope {
+    RtGuardScope() { rtGuardEnter(); }
+    ~RtGuardScope() { rtGuardLeave(); }
+};
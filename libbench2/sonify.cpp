@@ -0,0 +1,237 @@
+#include "sonify.h"
+#include "room.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// þ߰    (߿ degree ȯ )
+float horizontalFOV = 160.0f * M_PI / 180.0f; // ¿ þ, 20
+float verticalFOV = 60.0f * M_PI / 180.0f;   //  þ, 30
+
+std::vector<StockPoint> stockData;
+std::vector<Vec3> positions;
+
+unsigned int playbackPos = 0;
+bool playbackFinished = false;
+
+static SonifyConfig config = defaultSonifyConfig();
+
+// 迭(̽) 
+constexpr int MAX_VOICES = 64;
+static float phase[MAX_VOICES];
+
+//  ̸    (SoA, [ܰ * ̽  + ̽])
+//  ܰ ̽  ̶   迭 θ 
+struct RenderTable {
+    std::vector<double> phaseInc;       // ô   ( double  )
+    std::vector<float> gainL, gainR;    //  *  * 0.5
+    std::vector<float> roomGain;        // ݻ Է  ()
+    std::vector<RoomSource> room;       // ݻ  (  + Ÿ ), SPATIAL_ROOM 
+};
+static RenderTable table;
+
+unsigned int sampleCounter = 0;
+
+SonifyConfig defaultSonifyConfig() {
+    SonifyConfig cfg;
+    cfg.numPoints = 30;
+    cfg.numVoices = 1;
+    cfg.spatial = SPATIAL_ROOM;
+    cfg.samplesPerStep = SAMPLE_RATE / 4; // 0.25ʸ   ̵
+    return cfg;
+}
+
+// 1.    (迭  ޸)
+void generateVirtualStockData(int N, int numSeries) {
+    stockData.clear();
+    positions.clear();
+    float radius = 1.0f;
+
+    for (int s = 0; s < numSeries; ++s) {
+        for (int i = 0; i < N; ++i) {
+            float price = 10 + 90 * (0.5f + 0.5f * sinf(i * 0.15f + s * 1.3f));
+            stockData.push_back({ static_cast<float>(i), price });
+
+            //   þ߰   (¿ þ )
+            float angle = -horizontalFOV / 2.0f + (float)i / (N - 1) * horizontalFOV;
+            float x = radius * sinf(angle);   // ¿  (sin)
+            float z = radius * cosf(angle);   //   (cos)
+            float y = (price - 10) / 90.0f * 2.0f - 1.0f; //  -1~1
+
+            positions.push_back({ x, y, z });
+        }
+    }
+}
+
+
+// 2.   ļ ȯ
+float priceToFrequency(float price) {
+    float minPrice = 10.0f, maxPrice = 100.0f;
+    float minFreq = 200.0f, maxFreq = 1000.0f;
+
+    if (price < minPrice) price = minPrice;
+    if (price > maxPrice) price = maxPrice;
+
+    return minFreq + (price - minPrice) / (maxPrice - minPrice) * (maxFreq - minFreq);
+}
+
+// 3. ¿ д (-1: , +1: )
+float calcPanX(const Vec3& pos) {
+    // pos.x ̹ -sin(þ߰)  
+    // pos.x [-1, 1] ȭ(̹ þ  ġ ״ )
+    float pan = pos.x;
+    if (pan < -1.0f) pan = -1.0f;
+    if (pan > 1.0f) pan = 1.0f;
+    return pan;
+}
+
+// 4.   (0~1)
+float calcVolY(const Vec3& pos) {
+    // pos.y -1~1 ̷  ȭ Ǿ 
+    // verticalFOV  ϴ   
+    float vol = (pos.y + 1.0f) / 2.0f; // 0~1  ȯ
+    if (vol < 0.0f) vol = 0.0f;
+    if (vol > 1.0f) vol = 1.0f;
+    return vol;
+}
+
+// 5.  ̺ غ (ܰ [lo, hi) , 峢 ġ )
+static void prepareSteps(int lo, int hi) {
+    int N = config.numPoints;
+    int V = config.numVoices;
+    bool room = config.spatial == SPATIAL_ROOM;
+
+    for (int i = lo; i < hi; ++i) {
+        for (int v = 0; v < V; ++v) {
+            const Vec3& pos = positions[v * N + i];
+            size_t k = (size_t)i * V + v;
+
+            float freq = priceToFrequency(stockData[v * N + i].price);
+            float pan = calcPanX(pos);
+            float vol = calcVolY(pos);
+
+            table.phaseInc[k] = 2.0f * M_PI * freq / SAMPLE_RATE;
+            table.gainL[k] = (1.0f - pan) * 0.5f * vol;
+            table.gainR[k] = (1.0f + pan) * 0.5f * vol;
+            table.roomGain[k] = vol;
+            if (room) roomUpdateSource(table.room[k], pos.x, pos.y, pos.z);
+        }
+    }
+}
+
+static void prepareRenderTable() {
+    int N = config.numPoints;
+    size_t n = (size_t)N * config.numVoices;
+
+    table.phaseInc.assign(n, 0.0);
+    table.gainL.assign(n, 0.0f);
+    table.gainR.assign(n, 0.0f);
+    table.roomGain.assign(n, 0.0f);
+    table.room.resize(config.spatial == SPATIAL_ROOM ? n : 0);
+
+    // κ ݻ   ̶     
+    int workers = (int)std::thread::hardware_concurrency();
+    workers = std::min(workers, N / 64);
+    if (workers < 2) {
+        prepareSteps(0, N);
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    for (int w = 0; w < workers; ++w)
+        pool.emplace_back(prepareSteps, N * w / workers, N * (w + 1) / workers);
+    for (std::thread& t : pool) t.join();
+}
+
+void sonifyInit(const SonifyConfig& cfg) {
+    config = cfg;
+    if (config.numVoices < 1) config.numVoices = 1;
+    if (config.numVoices > MAX_VOICES) config.numVoices = MAX_VOICES;
+    if (config.samplesPerStep < 1) config.samplesPerStep = 1;
+
+    generateVirtualStockData(config.numPoints, config.numVoices);
+    roomInit(defaultRoomConfig(), SAMPLE_RATE);
+    prepareRenderTable();
+
+    playbackPos = 0;
+    sampleCounter = 0;
+    playbackFinished = false;
+
+    for (int v = 0; v < config.numVoices; ++v)
+        phase[v] = 0.0f;
+}
+
+// 6.   -   ϰ 
+// ܰ ȿ  ٲ Ƿ ܰ  ̺  ؼ ó
+bool renderBlock(float* out, unsigned long framesPerBuffer) {
+    unsigned int N = config.numPoints;
+    int V = config.numVoices;
+    bool room = config.spatial == SPATIAL_ROOM;
+    float voiceGain = 1.0f / V;
+
+    if (playbackFinished) {
+        for (unsigned int i = 0; i < framesPerBuffer; ++i) {
+            out[i * 2] = 0.0f;
+            out[i * 2 + 1] = 0.0f;
+        }
+        if (room) roomProcess(out, framesPerBuffer);
+        return true;
+    }
+
+    unsigned int i = 0;
+    while (i < framesPerBuffer) {
+        if (playbackPos >= N) {
+            playbackFinished = true;
+            for (; i < framesPerBuffer; ++i) {
+                out[i * 2] = 0.0f;
+                out[i * 2 + 1] = 0.0f;
+            }
+            break;
+        }
+
+        unsigned int run = std::min((unsigned int)framesPerBuffer - i,
+            config.samplesPerStep - sampleCounter);
+
+        size_t base = (size_t)playbackPos * V;
+        const double* inc = &table.phaseInc[base];
+        const float* gainL = &table.gainL[base];
+        const float* gainR = &table.gainR[base];
+        const float* roomGain = &table.roomGain[base];
+        const RoomSource* roomSrc = room ? &table.room[base] : nullptr;
+
+        for (unsigned int end = i + run; i < end; ++i) {
+            float left = 0.0f, right = 0.0f;
+            for (int v = 0; v < V; ++v) {
+                float sample = sinf(phase[v]) * voiceGain;
+
+                left += sample * gainL[v];
+                right += sample * gainR[v];
+
+                // ݻ ǿ (д )  
+                if (room) roomWriteSource(roomSrc[v], sample * roomGain[v], i);
+
+                phase[v] += inc[v];
+                if (phase[v] > 2.0f * M_PI) phase[v] -= 2.0f * M_PI;
+            }
+
+            out[i * 2] = left;
+            out[i * 2 + 1] = right;
+        }
+
+        //  ӵ :    ġ 
+        sampleCounter += run;
+        if (sampleCounter >= config.samplesPerStep) {
+            sampleCounter = 0;
+            playbackPos++;
+        }
+    }
+
+    // ʱ ݻ +  (ϴ  )
+    if (room) roomProcess(out, framesPerBuffer);
+    return false;
+}
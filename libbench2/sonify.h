@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+
+// Ҹ  (PortAudio  ) - main.cpp ݹ ׽Ʈ ϳ׽  
+
+constexpr int SAMPLE_RATE = 44100;
+constexpr int FRAMES_PER_BUFFER = 256;
+
+struct Vec3 {
+    float x, y, z;
+};
+
+struct StockPoint {
+    float time;
+    float price;
+};
+
+enum SpatialMode {
+    SPATIAL_PAN,    // ¿ д +  
+    SPATIAL_ROOM    // д + ʱ ݻ/ (room.h)
+};
+
+struct SonifyConfig {
+    int numPoints;                 // 迭   
+    int numVoices;                 // ÿ ϴ 迭 
+    SpatialMode spatial;
+    unsigned int samplesPerStep;   //   ϴ  
+};
+
+// 迭 v  i °  stockData[v * numPoints + i]
+extern std::vector<StockPoint> stockData;
+extern std::vector<Vec3> positions;
+
+extern unsigned int playbackPos;
+extern bool playbackFinished;
+
+SonifyConfig defaultSonifyConfig();
+
+void generateVirtualStockData(int N, int numSeries = 1);
+float priceToFrequency(float price);
+float calcPanX(const Vec3& pos);
+float calcVolY(const Vec3& pos);
+
+//   +   ʱȭ
+void sonifyInit(const SonifyConfig& cfg);
+
+// ׷ ͸  ,   true
+bool renderBlock(float* out, unsigned long frames);
@@ -25,7 +25,7 @@ static void destroy(problem *ego_)
      problem_mpi_dft *ego = (problem_mpi_dft *) ego_;
      XM(dtensor_destroy)(ego->sz);
      MPI_Comm_free(&ego->comm);
-     X(ifree)(ego_);
+     X(arena_ifree)(ego_);
 }
 
 static void hash(const problem *p_, md5 *m)
@@ -78,7 +78,8 @@ static const problem_adt padt =
      hash,
      zero,
      print,
-     destroy
+     destroy,
+     0 /* clone_io */
 };
 
 problem *XM(mkproblem_dft)(const dtensor *sz, INT vn,
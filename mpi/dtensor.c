@@ -53,9 +53,9 @@ dtensor *XM(mkdtensor)(int rnk)
 void XM(dtensor_destroy)(dtensor *sz)
 {
 #if !defined(STRUCT_HACK_C99) && !defined(STRUCT_HACK_KR)
-     X(ifree0)(sz->dims);
+     X(arena_ifree)(sz->dims);
 #endif
-     X(ifree)(sz);
+     X(arena_ifree)(sz);
 }
 
 void XM(dtensor_md5)(md5 *p, const dtensor *t)
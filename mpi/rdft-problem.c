@@ -26,9 +26,9 @@ static void destroy(problem *ego_)
      XM(dtensor_destroy)(ego->sz);
      MPI_Comm_free(&ego->comm);
 #if !defined(STRUCT_HACK_C99) && !defined(STRUCT_HACK_KR)
-     X(ifree0)(ego->kind);
+     X(arena_ifree)(ego->kind);
 #endif
-     X(ifree)(ego_);
+     X(arena_ifree)(ego_);
 }
 
 static void hash(const problem *p_, md5 *m)
@@ -84,7 +84,8 @@ static const problem_adt padt =
      hash,
      zero,
      print,
-     destroy
+     destroy,
+     0 /* clone_io */
 };
 
 problem *XM(mkproblem_rdft)(const dtensor *sz, INT vn,
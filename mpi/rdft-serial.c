@@ -97,7 +97,7 @@ static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
 			    X(mkproblem_rdft_d)(sz,
 						X(mktensor_1d)(p->vn, 1, 1),
 						p->I, p->O, kind));
-	  X(ifree0)(kind);
+	  X(arena_ifree)(kind);
      }
      else { /* idle process: make nop plan */
 	  cld = X(mkplan_d)(plnr,
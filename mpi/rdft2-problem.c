@@ -25,7 +25,7 @@ static void destroy(problem *ego_)
      problem_mpi_rdft2 *ego = (problem_mpi_rdft2 *) ego_;
      XM(dtensor_destroy)(ego->sz);
      MPI_Comm_free(&ego->comm);
-     X(ifree)(ego_);
+     X(arena_ifree)(ego_);
 }
 
 static void hash(const problem *p_, md5 *m)
@@ -82,7 +82,8 @@ static const problem_adt padt =
      hash,
      zero,
      print,
-     destroy
+     destroy,
+     0 /* clone_io */
 };
 
 problem *XM(mkproblem_rdft2)(const dtensor *sz, INT vn,
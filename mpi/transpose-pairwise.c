@@ -174,8 +174,8 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
 static void destroy(plan *ego_)
 {
      P *ego = (P *) ego_;
-     X(ifree0)(ego->sched);
-     X(ifree0)(ego->send_block_sizes);
+     X(arena_ifree)(ego->sched);
+     X(arena_ifree)(ego->send_block_sizes);
      MPI_Comm_free(&ego->comm);
      X(plan_destroy_internal)(ego->cld3);
      X(plan_destroy_internal)(ego->cld2rest);
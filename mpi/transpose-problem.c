@@ -24,7 +24,7 @@ static void destroy(problem *ego_)
 {
      problem_mpi_transpose *ego = (problem_mpi_transpose *) ego_;
      MPI_Comm_free(&ego->comm);
-     X(ifree)(ego_);
+     X(arena_ifree)(ego_);
 }
 
 static void hash(const problem *p_, md5 *m)
@@ -81,7 +81,8 @@ static const problem_adt padt =
      hash,
      zero,
      print,
-     destroy
+     destroy,
+     0 /* clone_io */
 };
 
 problem *XM(mkproblem_transpose)(INT nx, INT ny, INT vn,
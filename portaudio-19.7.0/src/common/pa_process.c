@@ -669,6 +669,8 @@ void PaUtil_Set2ndNonInterleavedOutputChannel( PaUtilBufferProcessor* bp,
 void PaUtil_BeginBufferProcessing( PaUtilBufferProcessor* bp,
         PaStreamCallbackTimeInfo* timeInfo, PaStreamCallbackFlags callbackStatusFlags )
 {
+    PA_RT_GUARD_ENTER();
+
     bp->timeInfo = timeInfo;
 
     /* the first streamCallback will be called to process samples which are
@@ -1649,6 +1651,8 @@ unsigned long PaUtil_EndBufferProcessing( PaUtilBufferProcessor* bp, int *stream
         }
     }
 
+    PA_RT_GUARD_LEAVE();
+
     return framesProcessed;
 }
 
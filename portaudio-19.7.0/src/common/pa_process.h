@@ -745,6 +745,24 @@ unsigned long PaUtil_ZeroOutput( PaUtilBufferProcessor* bufferProcessor,
         unsigned long frameCount );
 
 
+/** Realtime-safety checking hooks. When PortAudio is built with PA_RT_GUARD
+ defined, PaUtil_BeginBufferProcessing calls PaUtil_RtGuardEnter() and
+ PaUtil_EndBufferProcessing calls PaUtil_RtGuardLeave() on the host's audio
+ thread, so that a checker supplied by the application (which must define
+ both functions) can flag allocations, locks and blocking calls made anywhere
+ in the buffer processor, including format conversion and the stream callback.
+*/
+#ifdef PA_RT_GUARD
+void PaUtil_RtGuardEnter( void );
+void PaUtil_RtGuardLeave( void );
+#define PA_RT_GUARD_ENTER() PaUtil_RtGuardEnter()
+#define PA_RT_GUARD_LEAVE() PaUtil_RtGuardLeave()
+#else
+#define PA_RT_GUARD_ENTER()
+#define PA_RT_GUARD_LEAVE()
+#endif
+
+
 /*@}*/
 
 
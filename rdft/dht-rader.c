@@ -66,7 +66,7 @@ static void apply(const plan *ego_, R *I, R *O)
      R *buf, *omega;
      R r0;
 
-     buf = (R *) MALLOC(sizeof(R) * npad, BUFFERS);
+     buf = (R *) X(scratch_malloc)(sizeof(R) * npad);
 
      /* First, permute the input, storing in buf: */
      g = ego->g; 
@@ -151,21 +151,25 @@ static void apply(const plan *ego_, R *I, R *O)
 #endif
      A(gpower == 1);
 
-     X(ifree)(buf);
+     X(scratch_ifree)(buf);
 }
 
 static R *mkomega(enum wakefulness wakefulness,
 		  plan *p_, INT n, INT npad, INT ginv)
 {
      plan_rdft *p = (plan_rdft *) p_;
-     R *omega;
+     R *omega, *mine;
      INT i, gpower;
      trigreal scale;
      triggen *t;
 
-     if ((omega = X(rader_tl_find)(n, npad + 1, ginv, omegas))) 
+     LOCK_CACHES();
+     omega = X(rader_tl_find)(n, npad + 1, ginv, wakefulness, omegas);
+     UNLOCK_CACHES();
+     if (omega)
 	  return omega;
 
+     /* computed without the lock, as in dft/rader.c */
      omega = (R *)MALLOC(sizeof(R) * npad, TWIDDLES);
 
      scale = npad; /* normalization for convolution */
@@ -189,13 +193,22 @@ static R *mkomega(enum wakefulness wakefulness,
 
      p->apply(p_, omega, omega);
 
-     X(rader_tl_insert)(n, npad + 1, ginv, omega, &omegas);
+     mine = omega;
+     LOCK_CACHES();
+     if ((omega = X(rader_tl_find)(n, npad + 1, ginv, wakefulness, omegas)))
+	  X(ifree)(mine);	/* another thread made it meanwhile */
+     else
+	  X(rader_tl_insert)(n, npad + 1, ginv, wakefulness, omega = mine,
+			     &omegas);
+     UNLOCK_CACHES();
      return omega;
 }
 
 static void free_omega(R *omega)
 {
+     LOCK_CACHES();
      X(rader_tl_delete)(omega, &omegas);
+     UNLOCK_CACHES();
 }
 
 /***************************************************************************/
@@ -347,6 +360,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->omega = 0;
      pln->n = n;
      pln->npad = npad;
+     pln->super.super.scratch = SCRATCH_SIZE(sizeof(R) * npad);
      pln->is = is;
      pln->os = os;
 
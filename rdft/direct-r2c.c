@@ -311,8 +311,10 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 		  &ego->desc->ops,
 		  &pln->super.super.ops);
 
-     if (ego->bufferedp) 
+     if (ego->bufferedp) {
 	  pln->super.super.ops.other += 2 * n * pln->vl;
+	  pln->super.super.scratch = BUF_SCRATCH(n * b * sizeof(R));
+     }
 
      pln->super.super.could_prune_now_p = !ego->bufferedp;
 
@@ -213,6 +213,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 #if 0 /* these are nice pipelined sequential loads and should cost nothing */
      pln->super.super.ops.other = (n-1)*(2 + 1 + (n-1));  /* approximate */
 #endif
+     pln->super.super.scratch = BUF_SCRATCH(n * sizeof(E));
 
      return &(pln->super.super);
 }
@@ -240,8 +240,11 @@ static plan *mkcldw(const hc2hc_solver *ego_,
      X(ops_madd2)(v, &cld0->ops, &pln->super.super.ops);
      X(ops_madd2)(v, &cldm->ops, &pln->super.super.ops);
 
-     if (ego->bufferedp) 
+     if (ego->bufferedp) {
 	  pln->super.super.ops.other += 4 * r * (pln->me - pln->mb) * v;
+	  pln->super.super.scratch = BUF_SCRATCH(
+	       r * compute_batchsize(r) * 2 * sizeof(R));
+     }
 
      pln->super.super.could_prune_now_p =
 	  (!ego->bufferedp && r >= 5 && r < 64 && m >= r);
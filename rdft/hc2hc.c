@@ -182,6 +182,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->cldw = cldw;
      pln->r = r;
      X(ops_add)(&cld->ops, &cldw->ops, &pln->super.super.ops);
+     pln->super.super.scratch = cldw->scratch; /* not from mkplan_d */
 
      /* inherit could_prune_now_p attribute from cldw */
      pln->super.super.could_prune_now_p = cldw->could_prune_now_p;
@@ -26,10 +26,10 @@ static void destroy(problem *ego_)
 {
      problem_rdft *ego = (problem_rdft *) ego_;
 #if !defined(STRUCT_HACK_C99) && !defined(STRUCT_HACK_KR)
-     X(ifree0)(ego->kind);
+     X(arena_ifree)(ego->kind);
 #endif
      X(tensor_destroy2)(ego->vecsz, ego->sz);
-     X(ifree)(ego_);
+     X(arena_ifree)(ego_);
 }
 
 static void kind_hash(md5 *m, const rdft_kind *kind, int rnk)
@@ -113,13 +113,25 @@ static void zero(const problem *ego_)
      X(tensor_destroy)(sz);
 }
 
+static problem *clone_io(const problem *ego_, R **buf)
+{
+     const problem_rdft *ego = (const problem_rdft *) ego_;
+     R *in[2], *out[2];
+     tensor *sz = X(tensor_append)(ego->vecsz, ego->sz);
+     in[0] = ego->I; in[1] = ego->O;
+     *buf = X(problem_clone_arrays)(2, in, out, sz);
+     X(tensor_destroy)(sz);
+     return X(mkproblem_rdft)(ego->sz, ego->vecsz, out[0], out[1], ego->kind);
+}
+
 static const problem_adt padt =
 {
      PROBLEM_RDFT,
      hash,
      zero,
      print,
-     destroy
+     destroy,
+     clone_io
 };
 
 /* Dimensions of size 1 that are not REDFT/RODFT are no-ops and can be
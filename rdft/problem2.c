@@ -27,7 +27,7 @@ static void destroy(problem *ego_)
 {
      problem_rdft2 *ego = (problem_rdft2 *) ego_;
      X(tensor_destroy2)(ego->vecsz, ego->sz);
-     X(ifree)(ego_);
+     X(arena_ifree)(ego_);
 }
 
 static void hash(const problem *p_, md5 *m)
@@ -133,13 +133,26 @@ static void zero(const problem *ego_)
      }
 }
 
+static problem *clone_io(const problem *ego_, R **buf)
+{
+     const problem_rdft2 *ego = (const problem_rdft2 *) ego_;
+     R *in[4], *out[4];
+     tensor *sz = X(tensor_append)(ego->vecsz, ego->sz);
+     in[0] = ego->r0; in[1] = ego->r1; in[2] = ego->cr; in[3] = ego->ci;
+     *buf = X(problem_clone_arrays)(4, in, out, sz);
+     X(tensor_destroy)(sz);
+     return X(mkproblem_rdft2)(ego->sz, ego->vecsz, 
+			       out[0], out[1], out[2], out[3], ego->kind);
+}
+
 static const problem_adt padt =
 {
      PROBLEM_RDFT2,
      hash,
      zero,
      print,
-     destroy
+     destroy,
+     clone_io
 };
 
 problem *X(mkproblem_rdft2)(const tensor *sz, const tensor *vecsz,
@@ -82,7 +82,7 @@ static void apply_r2hc(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
      INT i, j, vl = ego->vl, nbuf = ego->nbuf, bufdist = ego->bufdist;
      INT n = ego->n;
      INT ivs = ego->ivs, ovs = ego->ovs, os = ego->cs;
-     R *bufs = (R *)MALLOC(sizeof(R) * nbuf * bufdist, BUFFERS);
+     R *bufs = (R *)X(scratch_malloc)(sizeof(R) * nbuf * bufdist);
      plan_rdft2 *cldrest;
 
      for (i = nbuf; i <= vl; i += nbuf) {
@@ -95,7 +95,7 @@ static void apply_r2hc(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
 	       hc2c(n, bufs + j*bufdist, cr, ci, os);
      }
 
-     X(ifree)(bufs);
+     X(scratch_ifree)(bufs);
 
      /* Do the remaining transforms, if any: */
      cldrest = (plan_rdft2 *) ego->cldrest;
@@ -109,7 +109,7 @@ static void apply_hc2r(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
      INT i, j, vl = ego->vl, nbuf = ego->nbuf, bufdist = ego->bufdist;
      INT n = ego->n;
      INT ivs = ego->ivs, ovs = ego->ovs, is = ego->cs;
-     R *bufs = (R *)MALLOC(sizeof(R) * nbuf * bufdist, BUFFERS);
+     R *bufs = (R *)X(scratch_malloc)(sizeof(R) * nbuf * bufdist);
      plan_rdft2 *cldrest;
 
      for (i = nbuf; i <= vl; i += nbuf) {
@@ -122,7 +122,7 @@ static void apply_hc2r(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
 	  r0 += ovs * nbuf; r1 += ovs * nbuf;
      }
 
-     X(ifree)(bufs);
+     X(scratch_ifree)(bufs);
 
      /* Do the remaining transforms, if any: */
      cldrest = (plan_rdft2 *) ego->cldrest;
@@ -301,6 +301,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      X(rdft2_strides)(p->kind, &p->sz->dims[0], &rs, &pln->cs);
      pln->nbuf = nbuf;
      pln->bufdist = bufdist;
+     pln->super.super.scratch = SCRATCH_SIZE(sizeof(R) * nbuf * bufdist);
 
      X(ops_madd)(vl / nbuf, &cld->ops, &cldrest->ops,
 		 &pln->super.super.ops);
@@ -449,7 +449,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 16, "hb2_16", twinstr, &GENUS, { 104, 42, 92, 0 } };
+static const hc2hc_desc desc = { 16, "hb2_16", twinstr, &GENUS, { 104, 42, 92, 0, 0 } };
 
 void X(codelet_hb2_16) (planner *p) {
      X(khc2hc_register) (p, hb2_16, &desc);
@@ -850,7 +850,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 16, "hb2_16", twinstr, &GENUS, { 156, 68, 40, 0 } };
+static const hc2hc_desc desc = { 16, "hb2_16", twinstr, &GENUS, { 156, 68, 40, 0, 0 } };
 
 void X(codelet_hb2_16) (planner *p) {
      X(khc2hc_register) (p, hb2_16, &desc);
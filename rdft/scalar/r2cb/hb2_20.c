@@ -576,7 +576,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 20, "hb2_20", twinstr, &GENUS, { 136, 58, 140, 0 } };
+static const hc2hc_desc desc = { 20, "hb2_20", twinstr, &GENUS, { 136, 58, 140, 0, 0 } };
 
 void X(codelet_hb2_20) (planner *p) {
      X(khc2hc_register) (p, hb2_20, &desc);
@@ -1079,7 +1079,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 20, "hb2_20", twinstr, &GENUS, { 204, 92, 72, 0 } };
+static const hc2hc_desc desc = { 20, "hb2_20", twinstr, &GENUS, { 204, 92, 72, 0, 0 } };
 
 void X(codelet_hb2_20) (planner *p) {
      X(khc2hc_register) (p, hb2_20, &desc);
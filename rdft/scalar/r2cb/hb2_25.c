@@ -877,7 +877,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 25, "hb2_25", twinstr, &GENUS, { 84, 78, 356, 0 } };
+static const hc2hc_desc desc = { 25, "hb2_25", twinstr, &GENUS, { 84, 78, 356, 0, 0 } };
 
 void X(codelet_hb2_25) (planner *p) {
      X(khc2hc_register) (p, hb2_25, &desc);
@@ -1634,7 +1634,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 25, "hb2_25", twinstr, &GENUS, { 280, 180, 160, 0 } };
+static const hc2hc_desc desc = { 25, "hb2_25", twinstr, &GENUS, { 280, 180, 160, 0, 0 } };
 
 void X(codelet_hb2_25) (planner *p) {
      X(khc2hc_register) (p, hb2_25, &desc);
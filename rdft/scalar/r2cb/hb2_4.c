@@ -106,7 +106,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 4, "hb2_4", twinstr, &GENUS, { 16, 8, 8, 0 } };
+static const hc2hc_desc desc = { 4, "hb2_4", twinstr, &GENUS, { 16, 8, 8, 0, 0 } };
 
 void X(codelet_hb2_4) (planner *p) {
      X(khc2hc_register) (p, hb2_4, &desc);
@@ -186,7 +186,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 4, "hb2_4", twinstr, &GENUS, { 16, 8, 8, 0 } };
+static const hc2hc_desc desc = { 4, "hb2_4", twinstr, &GENUS, { 16, 8, 8, 0, 0 } };
 
 void X(codelet_hb2_4) (planner *p) {
      X(khc2hc_register) (p, hb2_4, &desc);
@@ -149,7 +149,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 5, "hb2_5", twinstr, &GENUS, { 14, 10, 30, 0 } };
+static const hc2hc_desc desc = { 5, "hb2_5", twinstr, &GENUS, { 14, 10, 30, 0, 0 } };
 
 void X(codelet_hb2_5) (planner *p) {
      X(khc2hc_register) (p, hb2_5, &desc);
@@ -271,7 +271,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 5, "hb2_5", twinstr, &GENUS, { 30, 18, 14, 0 } };
+static const hc2hc_desc desc = { 5, "hb2_5", twinstr, &GENUS, { 30, 18, 14, 0, 0 } };
 
 void X(codelet_hb2_5) (planner *p) {
      X(khc2hc_register) (p, hb2_5, &desc);
@@ -211,7 +211,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 8, "hb2_8", twinstr, &GENUS, { 44, 20, 30, 0 } };
+static const hc2hc_desc desc = { 8, "hb2_8", twinstr, &GENUS, { 44, 20, 30, 0, 0 } };
 
 void X(codelet_hb2_8) (planner *p) {
      X(khc2hc_register) (p, hb2_8, &desc);
@@ -379,7 +379,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 8, "hb2_8", twinstr, &GENUS, { 56, 26, 18, 0 } };
+static const hc2hc_desc desc = { 8, "hb2_8", twinstr, &GENUS, { 56, 26, 18, 0, 0 } };
 
 void X(codelet_hb2_8) (planner *p) {
      X(khc2hc_register) (p, hb2_8, &desc);
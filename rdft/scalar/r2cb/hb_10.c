@@ -269,7 +269,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 10, "hb_10", twinstr, &GENUS, { 48, 18, 54, 0 } };
+static const hc2hc_desc desc = { 10, "hb_10", twinstr, &GENUS, { 48, 18, 54, 0, 0 } };
 
 void X(codelet_hb_10) (planner *p) {
      X(khc2hc_register) (p, hb_10, &desc);
@@ -505,7 +505,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 10, "hb_10", twinstr, &GENUS, { 72, 30, 30, 0 } };
+static const hc2hc_desc desc = { 10, "hb_10", twinstr, &GENUS, { 72, 30, 30, 0, 0 } };
 
 void X(codelet_hb_10) (planner *p) {
      X(khc2hc_register) (p, hb_10, &desc);
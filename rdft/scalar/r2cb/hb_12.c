@@ -319,7 +319,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 12, "hb_12", twinstr, &GENUS, { 72, 22, 46, 0 } };
+static const hc2hc_desc desc = { 12, "hb_12", twinstr, &GENUS, { 72, 22, 46, 0, 0 } };
 
 void X(codelet_hb_12) (planner *p) {
      X(khc2hc_register) (p, hb_12, &desc);
@@ -589,7 +589,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 12, "hb_12", twinstr, &GENUS, { 88, 30, 30, 0 } };
+static const hc2hc_desc desc = { 12, "hb_12", twinstr, &GENUS, { 88, 30, 30, 0, 0 } };
 
 void X(codelet_hb_12) (planner *p) {
      X(khc2hc_register) (p, hb_12, &desc);
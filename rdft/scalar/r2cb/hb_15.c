@@ -427,7 +427,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 15, "hb_15", twinstr, &GENUS, { 72, 28, 112, 0 } };
+static const hc2hc_desc desc = { 15, "hb_15", twinstr, &GENUS, { 72, 28, 112, 0, 0 } };
 
 void X(codelet_hb_15) (planner *p) {
      X(khc2hc_register) (p, hb_15, &desc);
@@ -802,7 +802,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 15, "hb_15", twinstr, &GENUS, { 128, 56, 56, 0 } };
+static const hc2hc_desc desc = { 15, "hb_15", twinstr, &GENUS, { 128, 56, 56, 0, 0 } };
 
 void X(codelet_hb_15) (planner *p) {
      X(khc2hc_register) (p, hb_15, &desc);
@@ -442,7 +442,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 16, "hb_16", twinstr, &GENUS, { 104, 30, 70, 0 } };
+static const hc2hc_desc desc = { 16, "hb_16", twinstr, &GENUS, { 104, 30, 70, 0, 0 } };
 
 void X(codelet_hb_16) (planner *p) {
      X(khc2hc_register) (p, hb_16, &desc);
@@ -825,7 +825,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 16, "hb_16", twinstr, &GENUS, { 136, 46, 38, 0 } };
+static const hc2hc_desc desc = { 16, "hb_16", twinstr, &GENUS, { 136, 46, 38, 0, 0 } };
 
 void X(codelet_hb_16) (planner *p) {
      X(khc2hc_register) (p, hb_16, &desc);
@@ -66,7 +66,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 2, "hb_2", twinstr, &GENUS, { 4, 2, 2, 0 } };
+static const hc2hc_desc desc = { 2, "hb_2", twinstr, &GENUS, { 4, 2, 2, 0, 0 } };
 
 void X(codelet_hb_2) (planner *p) {
      X(khc2hc_register) (p, hb_2, &desc);
@@ -109,7 +109,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 2, "hb_2", twinstr, &GENUS, { 4, 2, 2, 0 } };
+static const hc2hc_desc desc = { 2, "hb_2", twinstr, &GENUS, { 4, 2, 2, 0, 0 } };
 
 void X(codelet_hb_2) (planner *p) {
      X(khc2hc_register) (p, hb_2, &desc);
@@ -563,7 +563,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 20, "hb_20", twinstr, &GENUS, { 136, 38, 110, 0 } };
+static const hc2hc_desc desc = { 20, "hb_20", twinstr, &GENUS, { 136, 38, 110, 0, 0 } };
 
 void X(codelet_hb_20) (planner *p) {
      X(khc2hc_register) (p, hb_20, &desc);
@@ -1056,7 +1056,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 20, "hb_20", twinstr, &GENUS, { 184, 62, 62, 0 } };
+static const hc2hc_desc desc = { 20, "hb_20", twinstr, &GENUS, { 184, 62, 62, 0, 0 } };
 
 void X(codelet_hb_20) (planner *p) {
      X(khc2hc_register) (p, hb_20, &desc);
@@ -840,7 +840,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 25, "hb_25", twinstr, &GENUS, { 84, 48, 316, 0 } };
+static const hc2hc_desc desc = { 25, "hb_25", twinstr, &GENUS, { 84, 48, 316, 0, 0 } };
 
 void X(codelet_hb_25) (planner *p) {
      X(khc2hc_register) (p, hb_25, &desc);
@@ -1601,7 +1601,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 25, "hb_25", twinstr, &GENUS, { 260, 140, 140, 0 } };
+static const hc2hc_desc desc = { 25, "hb_25", twinstr, &GENUS, { 260, 140, 140, 0, 0 } };
 
 void X(codelet_hb_25) (planner *p) {
      X(khc2hc_register) (p, hb_25, &desc);
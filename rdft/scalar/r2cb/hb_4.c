@@ -106,7 +106,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 4, "hb_4", twinstr, &GENUS, { 16, 6, 6, 0 } };
+static const hc2hc_desc desc = { 4, "hb_4", twinstr, &GENUS, { 16, 6, 6, 0, 0 } };
 
 void X(codelet_hb_4) (planner *p) {
      X(khc2hc_register) (p, hb_4, &desc);
@@ -188,7 +188,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 4, "hb_4", twinstr, &GENUS, { 16, 6, 6, 0 } };
+static const hc2hc_desc desc = { 4, "hb_4", twinstr, &GENUS, { 16, 6, 6, 0, 0 } };
 
 void X(codelet_hb_4) (planner *p) {
      X(khc2hc_register) (p, hb_4, &desc);
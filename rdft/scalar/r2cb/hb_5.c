@@ -149,7 +149,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 5, "hb_5", twinstr, &GENUS, { 14, 8, 26, 0 } };
+static const hc2hc_desc desc = { 5, "hb_5", twinstr, &GENUS, { 14, 8, 26, 0, 0 } };
 
 void X(codelet_hb_5) (planner *p) {
      X(khc2hc_register) (p, hb_5, &desc);
@@ -266,7 +266,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 5, "hb_5", twinstr, &GENUS, { 26, 14, 14, 0 } };
+static const hc2hc_desc desc = { 5, "hb_5", twinstr, &GENUS, { 26, 14, 14, 0, 0 } };
 
 void X(codelet_hb_5) (planner *p) {
      X(khc2hc_register) (p, hb_5, &desc);
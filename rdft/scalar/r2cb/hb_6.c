@@ -153,7 +153,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 6, "hb_6", twinstr, &GENUS, { 24, 10, 22, 0 } };
+static const hc2hc_desc desc = { 6, "hb_6", twinstr, &GENUS, { 24, 10, 22, 0, 0 } };
 
 void X(codelet_hb_6) (planner *p) {
      X(khc2hc_register) (p, hb_6, &desc);
@@ -284,7 +284,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 6, "hb_6", twinstr, &GENUS, { 32, 14, 14, 0 } };
+static const hc2hc_desc desc = { 6, "hb_6", twinstr, &GENUS, { 32, 14, 14, 0, 0 } };
 
 void X(codelet_hb_6) (planner *p) {
      X(khc2hc_register) (p, hb_6, &desc);
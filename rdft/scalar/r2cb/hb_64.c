@@ -2074,7 +2074,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 64, "hb_64", twinstr, &GENUS, { 520, 126, 518, 0 } };
+static const hc2hc_desc desc = { 64, "hb_64", twinstr, &GENUS, { 520, 126, 518, 0, 0 } };
 
 void X(codelet_hb_64) (planner *p) {
      X(khc2hc_register) (p, hb_64, &desc);
@@ -4017,7 +4017,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 64, "hb_64", twinstr, &GENUS, { 808, 270, 230, 0 } };
+static const hc2hc_desc desc = { 64, "hb_64", twinstr, &GENUS, { 808, 270, 230, 0, 0 } };
 
 void X(codelet_hb_64) (planner *p) {
      X(khc2hc_register) (p, hb_64, &desc);
@@ -204,7 +204,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 7, "hb_7", twinstr, &GENUS, { 18, 12, 54, 0 } };
+static const hc2hc_desc desc = { 7, "hb_7", twinstr, &GENUS, { 18, 12, 54, 0, 0 } };
 
 void X(codelet_hb_7) (planner *p) {
      X(khc2hc_register) (p, hb_7, &desc);
@@ -348,7 +348,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 7, "hb_7", twinstr, &GENUS, { 36, 24, 36, 0 } };
+static const hc2hc_desc desc = { 7, "hb_7", twinstr, &GENUS, { 36, 24, 36, 0, 0 } };
 
 void X(codelet_hb_7) (planner *p) {
      X(khc2hc_register) (p, hb_7, &desc);
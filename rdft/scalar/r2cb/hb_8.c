@@ -197,7 +197,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 8, "hb_8", twinstr, &GENUS, { 44, 14, 22, 0 } };
+static const hc2hc_desc desc = { 8, "hb_8", twinstr, &GENUS, { 44, 14, 22, 0, 0 } };
 
 void X(codelet_hb_8) (planner *p) {
      X(khc2hc_register) (p, hb_8, &desc);
@@ -365,7 +365,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 8, "hb_8", twinstr, &GENUS, { 52, 18, 14, 0 } };
+static const hc2hc_desc desc = { 8, "hb_8", twinstr, &GENUS, { 52, 18, 14, 0, 0 } };
 
 void X(codelet_hb_8) (planner *p) {
      X(khc2hc_register) (p, hb_8, &desc);
@@ -270,7 +270,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 9, "hb_9", twinstr, &GENUS, { 24, 16, 72, 0 } };
+static const hc2hc_desc desc = { 9, "hb_9", twinstr, &GENUS, { 24, 16, 72, 0, 0 } };
 
 void X(codelet_hb_9) (planner *p) {
      X(khc2hc_register) (p, hb_9, &desc);
@@ -489,7 +489,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 9, "hb_9", twinstr, &GENUS, { 60, 36, 36, 0 } };
+static const hc2hc_desc desc = { 9, "hb_9", twinstr, &GENUS, { 60, 36, 36, 0, 0 } };
 
 void X(codelet_hb_9) (planner *p) {
      X(khc2hc_register) (p, hb_9, &desc);
@@ -563,7 +563,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cb_20", twinstr, &GENUS, { 136, 38, 110, 0 } };
+static const hc2c_desc desc = { 20, "hc2cb_20", twinstr, &GENUS, { 136, 38, 110, 0, 0 } };
 
 void X(codelet_hc2cb_20) (planner *p) {
      X(khc2c_register) (p, hc2cb_20, &desc, HC2C_VIA_RDFT);
@@ -1056,7 +1056,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cb_20", twinstr, &GENUS, { 184, 62, 62, 0 } };
+static const hc2c_desc desc = { 20, "hc2cb_20", twinstr, &GENUS, { 184, 62, 62, 0, 0 } };
 
 void X(codelet_hc2cb_20) (planner *p) {
      X(khc2c_register) (p, hc2cb_20, &desc, HC2C_VIA_RDFT);
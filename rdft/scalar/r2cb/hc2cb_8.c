@@ -197,7 +197,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 8, "hc2cb_8", twinstr, &GENUS, { 44, 14, 22, 0 } };
+static const hc2c_desc desc = { 8, "hc2cb_8", twinstr, &GENUS, { 44, 14, 22, 0, 0 } };
 
 void X(codelet_hc2cb_8) (planner *p) {
      X(khc2c_register) (p, hc2cb_8, &desc, HC2C_VIA_RDFT);
@@ -365,7 +365,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 8, "hc2cb_8", twinstr, &GENUS, { 52, 18, 14, 0 } };
+static const hc2c_desc desc = { 8, "hc2cb_8", twinstr, &GENUS, { 52, 18, 14, 0, 0 } };
 
 void X(codelet_hc2cb_8) (planner *p) {
      X(khc2c_register) (p, hc2cb_8, &desc, HC2C_VIA_RDFT);
@@ -589,7 +589,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cbdft2_20", twinstr, &GENUS, { 176, 38, 110, 0 } };
+static const hc2c_desc desc = { 20, "hc2cbdft2_20", twinstr, &GENUS, { 176, 38, 110, 0, 0 } };
 
 void X(codelet_hc2cbdft2_20) (planner *p) {
      X(khc2c_register) (p, hc2cbdft2_20, &desc, HC2C_VIA_DFT);
@@ -1141,7 +1141,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cbdft2_20", twinstr, &GENUS, { 224, 62, 62, 0 } };
+static const hc2c_desc desc = { 20, "hc2cbdft2_20", twinstr, &GENUS, { 224, 62, 62, 0, 0 } };
 
 void X(codelet_hc2cbdft2_20) (planner *p) {
      X(khc2c_register) (p, hc2cbdft2_20, &desc, HC2C_VIA_DFT);
@@ -1001,7 +1001,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 32, "hc2cbdft2_32", twinstr, &GENUS, { 300, 62, 198, 0 } };
+static const hc2c_desc desc = { 32, "hc2cbdft2_32", twinstr, &GENUS, { 300, 62, 198, 0, 0 } };
 
 void X(codelet_hc2cbdft2_32) (planner *p) {
      X(khc2c_register) (p, hc2cbdft2_32, &desc, HC2C_VIA_DFT);
@@ -1942,7 +1942,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 32, "hc2cbdft2_32", twinstr, &GENUS, { 404, 114, 94, 0 } };
+static const hc2c_desc desc = { 32, "hc2cbdft2_32", twinstr, &GENUS, { 404, 114, 94, 0, 0 } };
 
 void X(codelet_hc2cbdft2_32) (planner *p) {
      X(khc2c_register) (p, hc2cbdft2_32, &desc, HC2C_VIA_DFT);
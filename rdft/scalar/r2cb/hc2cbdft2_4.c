@@ -117,7 +117,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 4, "hc2cbdft2_4", twinstr, &GENUS, { 24, 6, 6, 0 } };
+static const hc2c_desc desc = { 4, "hc2cbdft2_4", twinstr, &GENUS, { 24, 6, 6, 0, 0 } };
 
 void X(codelet_hc2cbdft2_4) (planner *p) {
      X(khc2c_register) (p, hc2cbdft2_4, &desc, HC2C_VIA_DFT);
@@ -210,7 +210,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 4, "hc2cbdft2_4", twinstr, &GENUS, { 24, 6, 6, 0 } };
+static const hc2c_desc desc = { 4, "hc2cbdft2_4", twinstr, &GENUS, { 24, 6, 6, 0, 0 } };
 
 void X(codelet_hc2cbdft2_4) (planner *p) {
      X(khc2c_register) (p, hc2cbdft2_4, &desc, HC2C_VIA_DFT);
@@ -283,7 +283,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 10, "hc2cbdft_10", twinstr, &GENUS, { 68, 18, 54, 0 } };
+static const hc2c_desc desc = { 10, "hc2cbdft_10", twinstr, &GENUS, { 68, 18, 54, 0, 0 } };
 
 void X(codelet_hc2cbdft_10) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_10, &desc, HC2C_VIA_DFT);
@@ -537,7 +537,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 10, "hc2cbdft_10", twinstr, &GENUS, { 92, 30, 30, 0 } };
+static const hc2c_desc desc = { 10, "hc2cbdft_10", twinstr, &GENUS, { 92, 30, 30, 0, 0 } };
 
 void X(codelet_hc2cbdft_10) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_10, &desc, HC2C_VIA_DFT);
@@ -329,7 +329,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 12, "hc2cbdft_12", twinstr, &GENUS, { 96, 22, 46, 0 } };
+static const hc2c_desc desc = { 12, "hc2cbdft_12", twinstr, &GENUS, { 96, 22, 46, 0, 0 } };
 
 void X(codelet_hc2cbdft_12) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_12, &desc, HC2C_VIA_DFT);
@@ -635,7 +635,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 12, "hc2cbdft_12", twinstr, &GENUS, { 112, 30, 30, 0 } };
+static const hc2c_desc desc = { 12, "hc2cbdft_12", twinstr, &GENUS, { 112, 30, 30, 0, 0 } };
 
 void X(codelet_hc2cbdft_12) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_12, &desc, HC2C_VIA_DFT);
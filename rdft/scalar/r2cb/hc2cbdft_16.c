@@ -458,7 +458,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 16, "hc2cbdft_16", twinstr, &GENUS, { 136, 30, 70, 0 } };
+static const hc2c_desc desc = { 16, "hc2cbdft_16", twinstr, &GENUS, { 136, 30, 70, 0, 0 } };
 
 void X(codelet_hc2cbdft_16) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_16, &desc, HC2C_VIA_DFT);
@@ -884,7 +884,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 16, "hc2cbdft_16", twinstr, &GENUS, { 168, 46, 38, 0 } };
+static const hc2c_desc desc = { 16, "hc2cbdft_16", twinstr, &GENUS, { 168, 46, 38, 0, 0 } };
 
 void X(codelet_hc2cbdft_16) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_16, &desc, HC2C_VIA_DFT);
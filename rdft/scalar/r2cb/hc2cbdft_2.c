@@ -70,7 +70,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 2, "hc2cbdft_2", twinstr, &GENUS, { 8, 2, 2, 0 } };
+static const hc2c_desc desc = { 2, "hc2cbdft_2", twinstr, &GENUS, { 8, 2, 2, 0, 0 } };
 
 void X(codelet_hc2cbdft_2) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_2, &desc, HC2C_VIA_DFT);
@@ -123,7 +123,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 2, "hc2cbdft_2", twinstr, &GENUS, { 8, 2, 2, 0 } };
+static const hc2c_desc desc = { 2, "hc2cbdft_2", twinstr, &GENUS, { 8, 2, 2, 0, 0 } };
 
 void X(codelet_hc2cbdft_2) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_2, &desc, HC2C_VIA_DFT);
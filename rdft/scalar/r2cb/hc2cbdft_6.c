@@ -168,7 +168,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 6, "hc2cbdft_6", twinstr, &GENUS, { 36, 10, 22, 0 } };
+static const hc2c_desc desc = { 6, "hc2cbdft_6", twinstr, &GENUS, { 36, 10, 22, 0, 0 } };
 
 void X(codelet_hc2cbdft_6) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_6, &desc, HC2C_VIA_DFT);
@@ -318,7 +318,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 6, "hc2cbdft_6", twinstr, &GENUS, { 44, 14, 14, 0 } };
+static const hc2c_desc desc = { 6, "hc2cbdft_6", twinstr, &GENUS, { 44, 14, 14, 0, 0 } };
 
 void X(codelet_hc2cbdft_6) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_6, &desc, HC2C_VIA_DFT);
@@ -217,7 +217,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 8, "hc2cbdft_8", twinstr, &GENUS, { 60, 14, 22, 0 } };
+static const hc2c_desc desc = { 8, "hc2cbdft_8", twinstr, &GENUS, { 60, 14, 22, 0, 0 } };
 
 void X(codelet_hc2cbdft_8) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_8, &desc, HC2C_VIA_DFT);
@@ -416,7 +416,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 8, "hc2cbdft_8", twinstr, &GENUS, { 68, 18, 14, 0 } };
+static const hc2c_desc desc = { 8, "hc2cbdft_8", twinstr, &GENUS, { 68, 18, 14, 0, 0 } };
 
 void X(codelet_hc2cbdft_8) (planner *p) {
      X(khc2c_register) (p, hc2cbdft_8, &desc, HC2C_VIA_DFT);
@@ -103,7 +103,7 @@ static void r2cbIII_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 10, "r2cbIII_10", { 14, 10, 18, 0 }, &GENUS };
+static const kr2c_desc desc = { 10, "r2cbIII_10", { 14, 10, 18, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_10) (planner *p) { X(kr2c_register) (p, r2cbIII_10, &desc);
 }
@@ -188,7 +188,7 @@ static void r2cbIII_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 10, "r2cbIII_10", { 26, 10, 6, 0 }, &GENUS };
+static const kr2c_desc desc = { 10, "r2cbIII_10", { 26, 10, 6, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_10) (planner *p) { X(kr2c_register) (p, r2cbIII_10, &desc);
 }
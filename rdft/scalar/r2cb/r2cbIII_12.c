@@ -120,7 +120,7 @@ static void r2cbIII_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 12, "r2cbIII_12", { 30, 8, 12, 0 }, &GENUS };
+static const kr2c_desc desc = { 12, "r2cbIII_12", { 30, 8, 12, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_12) (planner *p) { X(kr2c_register) (p, r2cbIII_12, &desc);
 }
@@ -222,7 +222,7 @@ static void r2cbIII_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 12, "r2cbIII_12", { 38, 16, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 12, "r2cbIII_12", { 38, 16, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_12) (planner *p) { X(kr2c_register) (p, r2cbIII_12, &desc);
 }
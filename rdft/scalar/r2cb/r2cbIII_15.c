@@ -154,7 +154,7 @@ static void r2cbIII_15(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 15, "r2cbIII_15", { 21, 0, 43, 0 }, &GENUS };
+static const kr2c_desc desc = { 15, "r2cbIII_15", { 21, 0, 43, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_15) (planner *p) { X(kr2c_register) (p, r2cbIII_15, &desc);
 }
@@ -295,7 +295,7 @@ static void r2cbIII_15(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 15, "r2cbIII_15", { 49, 11, 15, 0 }, &GENUS };
+static const kr2c_desc desc = { 15, "r2cbIII_15", { 49, 11, 15, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_15) (planner *p) { X(kr2c_register) (p, r2cbIII_15, &desc);
 }
@@ -163,7 +163,7 @@ static void r2cbIII_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 16, "r2cbIII_16", { 46, 16, 20, 0 }, &GENUS };
+static const kr2c_desc desc = { 16, "r2cbIII_16", { 46, 16, 20, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_16) (planner *p) { X(kr2c_register) (p, r2cbIII_16, &desc);
 }
@@ -308,7 +308,7 @@ static void r2cbIII_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 16, "r2cbIII_16", { 54, 20, 12, 0 }, &GENUS };
+static const kr2c_desc desc = { 16, "r2cbIII_16", { 54, 20, 12, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_16) (planner *p) { X(kr2c_register) (p, r2cbIII_16, &desc);
 }
@@ -49,7 +49,7 @@ static void r2cbIII_2(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 2, "r2cbIII_2", { 0, 2, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 2, "r2cbIII_2", { 0, 2, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_2) (planner *p) { X(kr2c_register) (p, r2cbIII_2, &desc);
 }
@@ -80,7 +80,7 @@ static void r2cbIII_2(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 2, "r2cbIII_2", { 0, 2, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 2, "r2cbIII_2", { 0, 2, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_2) (planner *p) { X(kr2c_register) (p, r2cbIII_2, &desc);
 }
@@ -210,7 +210,7 @@ static void r2cbIII_20(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 20, "r2cbIII_20", { 58, 20, 36, 0 }, &GENUS };
+static const kr2c_desc desc = { 20, "r2cbIII_20", { 58, 20, 36, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_20) (planner *p) { X(kr2c_register) (p, r2cbIII_20, &desc);
 }
@@ -402,7 +402,7 @@ static void r2cbIII_20(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 20, "r2cbIII_20", { 82, 32, 12, 0 }, &GENUS };
+static const kr2c_desc desc = { 20, "r2cbIII_20", { 82, 32, 12, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_20) (planner *p) { X(kr2c_register) (p, r2cbIII_20, &desc);
 }
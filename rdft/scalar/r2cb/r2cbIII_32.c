@@ -360,7 +360,7 @@ static void r2cbIII_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 32, "r2cbIII_32", { 106, 32, 68, 0 }, &GENUS };
+static const kr2c_desc desc = { 32, "r2cbIII_32", { 106, 32, 68, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_32) (planner *p) { X(kr2c_register) (p, r2cbIII_32, &desc);
 }
@@ -703,7 +703,7 @@ static void r2cbIII_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 32, "r2cbIII_32", { 138, 48, 36, 0 }, &GENUS };
+static const kr2c_desc desc = { 32, "r2cbIII_32", { 138, 48, 36, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_32) (planner *p) { X(kr2c_register) (p, r2cbIII_32, &desc);
 }
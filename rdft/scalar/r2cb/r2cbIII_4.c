@@ -56,7 +56,7 @@ static void r2cbIII_4(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 4, "r2cbIII_4", { 6, 4, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 4, "r2cbIII_4", { 6, 4, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_4) (planner *p) { X(kr2c_register) (p, r2cbIII_4, &desc);
 }
@@ -94,7 +94,7 @@ static void r2cbIII_4(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 4, "r2cbIII_4", { 6, 4, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 4, "r2cbIII_4", { 6, 4, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_4) (planner *p) { X(kr2c_register) (p, r2cbIII_4, &desc);
 }
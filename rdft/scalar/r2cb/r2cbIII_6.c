@@ -67,7 +67,7 @@ static void r2cbIII_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 6, "r2cbIII_6", { 6, 2, 6, 0 }, &GENUS };
+static const kr2c_desc desc = { 6, "r2cbIII_6", { 6, 2, 6, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_6) (planner *p) { X(kr2c_register) (p, r2cbIII_6, &desc);
 }
@@ -116,7 +116,7 @@ static void r2cbIII_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 6, "r2cbIII_6", { 10, 4, 2, 0 }, &GENUS };
+static const kr2c_desc desc = { 6, "r2cbIII_6", { 10, 4, 2, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_6) (planner *p) { X(kr2c_register) (p, r2cbIII_6, &desc);
 }
@@ -796,7 +796,7 @@ static void r2cbIII_64(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 64, "r2cbIII_64", { 238, 64, 196, 0 }, &GENUS };
+static const kr2c_desc desc = { 64, "r2cbIII_64", { 238, 64, 196, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_64) (planner *p) { X(kr2c_register) (p, r2cbIII_64, &desc);
 }
@@ -1577,7 +1577,7 @@ static void r2cbIII_64(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 64, "r2cbIII_64", { 342, 116, 92, 0 }, &GENUS };
+static const kr2c_desc desc = { 64, "r2cbIII_64", { 342, 116, 92, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_64) (planner *p) { X(kr2c_register) (p, r2cbIII_64, &desc);
 }
@@ -87,7 +87,7 @@ static void r2cbIII_7(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 7, "r2cbIII_7", { 2, 0, 22, 0 }, &GENUS };
+static const kr2c_desc desc = { 7, "r2cbIII_7", { 2, 0, 22, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_7) (planner *p) { X(kr2c_register) (p, r2cbIII_7, &desc);
 }
@@ -140,7 +140,7 @@ static void r2cbIII_7(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 7, "r2cbIII_7", { 9, 4, 15, 0 }, &GENUS };
+static const kr2c_desc desc = { 7, "r2cbIII_7", { 9, 4, 15, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_7) (planner *p) { X(kr2c_register) (p, r2cbIII_7, &desc);
 }
@@ -87,7 +87,7 @@ static void r2cbIII_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 8, "r2cbIII_8", { 18, 8, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 8, "r2cbIII_8", { 18, 8, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_8) (planner *p) { X(kr2c_register) (p, r2cbIII_8, &desc);
 }
@@ -156,7 +156,7 @@ static void r2cbIII_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 8, "r2cbIII_8", { 18, 8, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 8, "r2cbIII_8", { 18, 8, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_8) (planner *p) { X(kr2c_register) (p, r2cbIII_8, &desc);
 }
@@ -109,7 +109,7 @@ static void r2cbIII_9(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 9, "r2cbIII_9", { 8, 0, 24, 0 }, &GENUS };
+static const kr2c_desc desc = { 9, "r2cbIII_9", { 8, 0, 24, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_9) (planner *p) { X(kr2c_register) (p, r2cbIII_9, &desc);
 }
@@ -201,7 +201,7 @@ static void r2cbIII_9(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 9, "r2cbIII_9", { 22, 8, 10, 0 }, &GENUS };
+static const kr2c_desc desc = { 9, "r2cbIII_9", { 22, 8, 10, 0, 0 }, &GENUS };
 
 void X(codelet_r2cbIII_9) (planner *p) { X(kr2c_register) (p, r2cbIII_9, &desc);
 }
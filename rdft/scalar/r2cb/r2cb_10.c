@@ -108,7 +108,7 @@ static void r2cb_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 10, "r2cb_10", { 14, 0, 20, 0 }, &GENUS };
+static const kr2c_desc desc = { 10, "r2cb_10", { 14, 0, 20, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_10) (planner *p) { X(kr2c_register) (p, r2cb_10, &desc);
 }
@@ -198,7 +198,7 @@ static void r2cb_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 10, "r2cb_10", { 26, 6, 8, 0 }, &GENUS };
+static const kr2c_desc desc = { 10, "r2cb_10", { 26, 6, 8, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_10) (planner *p) { X(kr2c_register) (p, r2cb_10, &desc);
 }
@@ -148,7 +148,7 @@ static void r2cb_11(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 11, "r2cb_11", { 4, 0, 56, 0 }, &GENUS };
+static const kr2c_desc desc = { 11, "r2cb_11", { 4, 0, 56, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_11) (planner *p) { X(kr2c_register) (p, r2cb_11, &desc);
 }
@@ -221,7 +221,7 @@ static void r2cb_11(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 11, "r2cb_11", { 19, 10, 41, 0 }, &GENUS };
+static const kr2c_desc desc = { 11, "r2cb_11", { 19, 10, 41, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_11) (planner *p) { X(kr2c_register) (p, r2cb_11, &desc);
 }
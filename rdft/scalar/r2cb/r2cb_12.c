@@ -114,7 +114,7 @@ static void r2cb_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 12, "r2cb_12", { 22, 0, 16, 0 }, &GENUS };
+static const kr2c_desc desc = { 12, "r2cb_12", { 22, 0, 16, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_12) (planner *p) { X(kr2c_register) (p, r2cb_12, &desc);
 }
@@ -212,7 +212,7 @@ static void r2cb_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 12, "r2cb_12", { 34, 6, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 12, "r2cb_12", { 34, 6, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_12) (planner *p) { X(kr2c_register) (p, r2cb_12, &desc);
 }
@@ -1624,7 +1624,7 @@ static void r2cb_128(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 128, "r2cb_128", { 416, 0, 540, 0 }, &GENUS };
+static const kr2c_desc desc = { 128, "r2cb_128", { 416, 0, 540, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_128) (planner *p) { X(kr2c_register) (p, r2cb_128, &desc);
 }
@@ -3238,7 +3238,7 @@ static void r2cb_128(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 128, "r2cb_128", { 812, 198, 144, 0 }, &GENUS };
+static const kr2c_desc desc = { 128, "r2cb_128", { 812, 198, 144, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_128) (planner *p) { X(kr2c_register) (p, r2cb_128, &desc);
 }
@@ -193,7 +193,7 @@ static void r2cb_13(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 13, "r2cb_13", { 18, 0, 58, 0 }, &GENUS };
+static const kr2c_desc desc = { 13, "r2cb_13", { 18, 0, 58, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_13) (planner *p) { X(kr2c_register) (p, r2cb_13, &desc);
 }
@@ -361,7 +361,7 @@ static void r2cb_13(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 13, "r2cb_13", { 56, 15, 20, 0 }, &GENUS };
+static const kr2c_desc desc = { 13, "r2cb_13", { 56, 15, 20, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_13) (planner *p) { X(kr2c_register) (p, r2cb_13, &desc);
 }
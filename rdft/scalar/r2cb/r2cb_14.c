@@ -144,7 +144,7 @@ static void r2cb_14(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 14, "r2cb_14", { 18, 0, 44, 0 }, &GENUS };
+static const kr2c_desc desc = { 14, "r2cb_14", { 18, 0, 44, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_14) (planner *p) { X(kr2c_register) (p, r2cb_14, &desc);
 }
@@ -250,7 +250,7 @@ static void r2cb_14(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 14, "r2cb_14", { 36, 12, 26, 0 }, &GENUS };
+static const kr2c_desc desc = { 14, "r2cb_14", { 36, 12, 26, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_14) (planner *p) { X(kr2c_register) (p, r2cb_14, &desc);
 }
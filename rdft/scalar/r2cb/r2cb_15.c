@@ -152,7 +152,7 @@ static void r2cb_15(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 15, "r2cb_15", { 21, 0, 43, 0 }, &GENUS };
+static const kr2c_desc desc = { 15, "r2cb_15", { 21, 0, 43, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_15) (planner *p) { X(kr2c_register) (p, r2cb_15, &desc);
 }
@@ -285,7 +285,7 @@ static void r2cb_15(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 15, "r2cb_15", { 47, 14, 17, 0 }, &GENUS };
+static const kr2c_desc desc = { 15, "r2cb_15", { 47, 14, 17, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_15) (planner *p) { X(kr2c_register) (p, r2cb_15, &desc);
 }
@@ -150,7 +150,7 @@ static void r2cb_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 16, "r2cb_16", { 26, 0, 32, 0 }, &GENUS };
+static const kr2c_desc desc = { 16, "r2cb_16", { 26, 0, 32, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_16) (planner *p) { X(kr2c_register) (p, r2cb_16, &desc);
 }
@@ -287,7 +287,7 @@ static void r2cb_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 16, "r2cb_16", { 54, 14, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 16, "r2cb_16", { 54, 14, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_16) (planner *p) { X(kr2c_register) (p, r2cb_16, &desc);
 }
@@ -187,7 +187,7 @@ static void r2cb_20(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 20, "r2cb_20", { 42, 0, 44, 0 }, &GENUS };
+static const kr2c_desc desc = { 20, "r2cb_20", { 42, 0, 44, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_20) (planner *p) { X(kr2c_register) (p, r2cb_20, &desc);
 }
@@ -361,7 +361,7 @@ static void r2cb_20(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 20, "r2cb_20", { 70, 14, 16, 0 }, &GENUS };
+static const kr2c_desc desc = { 20, "r2cb_20", { 70, 14, 16, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_20) (planner *p) { X(kr2c_register) (p, r2cb_20, &desc);
 }
@@ -326,7 +326,7 @@ static void r2cb_25(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 25, "r2cb_25", { 32, 0, 120, 0 }, &GENUS };
+static const kr2c_desc desc = { 25, "r2cb_25", { 32, 0, 120, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_25) (planner *p) { X(kr2c_register) (p, r2cb_25, &desc);
 }
@@ -611,7 +611,7 @@ static void r2cb_25(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 25, "r2cb_25", { 100, 46, 52, 0 }, &GENUS };
+static const kr2c_desc desc = { 25, "r2cb_25", { 100, 46, 52, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_25) (planner *p) { X(kr2c_register) (p, r2cb_25, &desc);
 }
@@ -53,7 +53,7 @@ static void r2cb_3(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 3, "r2cb_3", { 1, 0, 3, 0 }, &GENUS };
+static const kr2c_desc desc = { 3, "r2cb_3", { 1, 0, 3, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_3) (planner *p) { X(kr2c_register) (p, r2cb_3, &desc);
 }
@@ -89,7 +89,7 @@ static void r2cb_3(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 3, "r2cb_3", { 3, 1, 1, 0 }, &GENUS };
+static const kr2c_desc desc = { 3, "r2cb_3", { 3, 1, 1, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_3) (planner *p) { X(kr2c_register) (p, r2cb_3, &desc);
 }
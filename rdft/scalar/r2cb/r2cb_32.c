@@ -321,7 +321,7 @@ static void r2cb_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 32, "r2cb_32", { 72, 0, 84, 0 }, &GENUS };
+static const kr2c_desc desc = { 32, "r2cb_32", { 72, 0, 84, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_32) (planner *p) { X(kr2c_register) (p, r2cb_32, &desc);
 }
@@ -629,7 +629,7 @@ static void r2cb_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 32, "r2cb_32", { 140, 34, 16, 0 }, &GENUS };
+static const kr2c_desc desc = { 32, "r2cb_32", { 140, 34, 16, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_32) (planner *p) { X(kr2c_register) (p, r2cb_32, &desc);
 }
@@ -69,7 +69,7 @@ static void r2cb_5(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 5, "r2cb_5", { 2, 0, 10, 0 }, &GENUS };
+static const kr2c_desc desc = { 5, "r2cb_5", { 2, 0, 10, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_5) (planner *p) { X(kr2c_register) (p, r2cb_5, &desc);
 }
@@ -120,7 +120,7 @@ static void r2cb_5(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 5, "r2cb_5", { 8, 3, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 5, "r2cb_5", { 8, 3, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_5) (planner *p) { X(kr2c_register) (p, r2cb_5, &desc);
 }
@@ -69,7 +69,7 @@ static void r2cb_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 6, "r2cb_6", { 8, 0, 6, 0 }, &GENUS };
+static const kr2c_desc desc = { 6, "r2cb_6", { 8, 0, 6, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_6) (planner *p) { X(kr2c_register) (p, r2cb_6, &desc);
 }
@@ -120,7 +120,7 @@ static void r2cb_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 6, "r2cb_6", { 12, 2, 2, 0 }, &GENUS };
+static const kr2c_desc desc = { 6, "r2cb_6", { 12, 2, 2, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_6) (planner *p) { X(kr2c_register) (p, r2cb_6, &desc);
 }
@@ -707,7 +707,7 @@ static void r2cb_64(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 64, "r2cb_64", { 178, 0, 216, 0 }, &GENUS };
+static const kr2c_desc desc = { 64, "r2cb_64", { 178, 0, 216, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_64) (planner *p) { X(kr2c_register) (p, r2cb_64, &desc);
 }
@@ -1402,7 +1402,7 @@ static void r2cb_64(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 64, "r2cb_64", { 342, 82, 52, 0 }, &GENUS };
+static const kr2c_desc desc = { 64, "r2cb_64", { 342, 82, 52, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_64) (planner *p) { X(kr2c_register) (p, r2cb_64, &desc);
 }
@@ -87,7 +87,7 @@ static void r2cb_7(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 7, "r2cb_7", { 2, 0, 22, 0 }, &GENUS };
+static const kr2c_desc desc = { 7, "r2cb_7", { 2, 0, 22, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_7) (planner *p) { X(kr2c_register) (p, r2cb_7, &desc);
 }
@@ -140,7 +140,7 @@ static void r2cb_7(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 7, "r2cb_7", { 11, 6, 13, 0 }, &GENUS };
+static const kr2c_desc desc = { 7, "r2cb_7", { 11, 6, 13, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_7) (planner *p) { X(kr2c_register) (p, r2cb_7, &desc);
 }
@@ -80,7 +80,7 @@ static void r2cb_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 8, "r2cb_8", { 8, 0, 12, 0 }, &GENUS };
+static const kr2c_desc desc = { 8, "r2cb_8", { 8, 0, 12, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_8) (planner *p) { X(kr2c_register) (p, r2cb_8, &desc);
 }
@@ -147,7 +147,7 @@ static void r2cb_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 8, "r2cb_8", { 20, 6, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 8, "r2cb_8", { 20, 6, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cb_8) (planner *p) { X(kr2c_register) (p, r2cb_8, &desc);
 }
@@ -436,7 +436,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 16, "hc2cf2_16", twinstr, &GENUS, { 104, 42, 92, 0 } };
+static const hc2c_desc desc = { 16, "hc2cf2_16", twinstr, &GENUS, { 104, 42, 92, 0, 0 } };
 
 void X(codelet_hc2cf2_16) (planner *p) {
      X(khc2c_register) (p, hc2cf2_16, &desc, HC2C_VIA_RDFT);
@@ -828,7 +828,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 16, "hc2cf2_16", twinstr, &GENUS, { 156, 68, 40, 0 } };
+static const hc2c_desc desc = { 16, "hc2cf2_16", twinstr, &GENUS, { 156, 68, 40, 0, 0 } };
 
 void X(codelet_hc2cf2_16) (planner *p) {
      X(khc2c_register) (p, hc2cf2_16, &desc, HC2C_VIA_RDFT);
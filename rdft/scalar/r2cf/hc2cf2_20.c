@@ -595,7 +595,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cf2_20", twinstr, &GENUS, { 136, 58, 140, 0 } };
+static const hc2c_desc desc = { 20, "hc2cf2_20", twinstr, &GENUS, { 136, 58, 140, 0, 0 } };
 
 void X(codelet_hc2cf2_20) (planner *p) {
      X(khc2c_register) (p, hc2cf2_20, &desc, HC2C_VIA_RDFT);
@@ -1089,7 +1089,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cf2_20", twinstr, &GENUS, { 204, 92, 72, 0 } };
+static const hc2c_desc desc = { 20, "hc2cf2_20", twinstr, &GENUS, { 204, 92, 72, 0, 0 } };
 
 void X(codelet_hc2cf2_20) (planner *p) {
      X(khc2c_register) (p, hc2cf2_20, &desc, HC2C_VIA_RDFT);
@@ -1005,7 +1005,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 32, "hc2cf2_32", twinstr, &GENUS, { 236, 98, 252, 0 } };
+static const hc2c_desc desc = { 32, "hc2cf2_32", twinstr, &GENUS, { 236, 98, 252, 0, 0 } };
 
 void X(codelet_hc2cf2_32) (planner *p) {
      X(khc2c_register) (p, hc2cf2_32, &desc, HC2C_VIA_RDFT);
@@ -1885,7 +1885,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 32, "hc2cf2_32", twinstr, &GENUS, { 376, 168, 112, 0 } };
+static const hc2c_desc desc = { 32, "hc2cf2_32", twinstr, &GENUS, { 376, 168, 112, 0, 0 } };
 
 void X(codelet_hc2cf2_32) (planner *p) {
      X(khc2c_register) (p, hc2cf2_32, &desc, HC2C_VIA_RDFT);
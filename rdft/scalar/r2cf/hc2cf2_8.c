@@ -208,7 +208,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 8, "hc2cf2_8", twinstr, &GENUS, { 44, 20, 30, 0 } };
+static const hc2c_desc desc = { 8, "hc2cf2_8", twinstr, &GENUS, { 44, 20, 30, 0, 0 } };
 
 void X(codelet_hc2cf2_8) (planner *p) {
      X(khc2c_register) (p, hc2cf2_8, &desc, HC2C_VIA_RDFT);
@@ -382,7 +382,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 8, "hc2cf2_8", twinstr, &GENUS, { 56, 26, 18, 0 } };
+static const hc2c_desc desc = { 8, "hc2cf2_8", twinstr, &GENUS, { 56, 26, 18, 0, 0 } };
 
 void X(codelet_hc2cf2_8) (planner *p) {
      X(khc2c_register) (p, hc2cf2_8, &desc, HC2C_VIA_RDFT);
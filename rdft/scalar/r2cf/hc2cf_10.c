@@ -257,7 +257,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 10, "hc2cf_10", twinstr, &GENUS, { 48, 18, 54, 0 } };
+static const hc2c_desc desc = { 10, "hc2cf_10", twinstr, &GENUS, { 48, 18, 54, 0, 0 } };
 
 void X(codelet_hc2cf_10) (planner *p) {
      X(khc2c_register) (p, hc2cf_10, &desc, HC2C_VIA_RDFT);
@@ -481,7 +481,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 10, "hc2cf_10", twinstr, &GENUS, { 72, 30, 30, 0 } };
+static const hc2c_desc desc = { 10, "hc2cf_10", twinstr, &GENUS, { 72, 30, 30, 0, 0 } };
 
 void X(codelet_hc2cf_10) (planner *p) {
      X(khc2c_register) (p, hc2cf_10, &desc, HC2C_VIA_RDFT);
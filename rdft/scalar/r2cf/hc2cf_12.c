@@ -302,7 +302,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 12, "hc2cf_12", twinstr, &GENUS, { 72, 22, 46, 0 } };
+static const hc2c_desc desc = { 12, "hc2cf_12", twinstr, &GENUS, { 72, 22, 46, 0, 0 } };
 
 void X(codelet_hc2cf_12) (planner *p) {
      X(khc2c_register) (p, hc2cf_12, &desc, HC2C_VIA_RDFT);
@@ -573,7 +573,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 12, "hc2cf_12", twinstr, &GENUS, { 88, 30, 30, 0 } };
+static const hc2c_desc desc = { 12, "hc2cf_12", twinstr, &GENUS, { 88, 30, 30, 0, 0 } };
 
 void X(codelet_hc2cf_12) (planner *p) {
      X(khc2c_register) (p, hc2cf_12, &desc, HC2C_VIA_RDFT);
@@ -411,7 +411,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 16, "hc2cf_16", twinstr, &GENUS, { 104, 30, 70, 0 } };
+static const hc2c_desc desc = { 16, "hc2cf_16", twinstr, &GENUS, { 104, 30, 70, 0, 0 } };
 
 void X(codelet_hc2cf_16) (planner *p) {
      X(khc2c_register) (p, hc2cf_16, &desc, HC2C_VIA_RDFT);
@@ -788,7 +788,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 16, "hc2cf_16", twinstr, &GENUS, { 136, 46, 38, 0 } };
+static const hc2c_desc desc = { 16, "hc2cf_16", twinstr, &GENUS, { 136, 46, 38, 0, 0 } };
 
 void X(codelet_hc2cf_16) (planner *p) {
      X(khc2c_register) (p, hc2cf_16, &desc, HC2C_VIA_RDFT);
@@ -63,7 +63,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 2, "hc2cf_2", twinstr, &GENUS, { 4, 2, 2, 0 } };
+static const hc2c_desc desc = { 2, "hc2cf_2", twinstr, &GENUS, { 4, 2, 2, 0, 0 } };
 
 void X(codelet_hc2cf_2) (planner *p) {
      X(khc2c_register) (p, hc2cf_2, &desc, HC2C_VIA_RDFT);
@@ -109,7 +109,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 2, "hc2cf_2", twinstr, &GENUS, { 4, 2, 2, 0 } };
+static const hc2c_desc desc = { 2, "hc2cf_2", twinstr, &GENUS, { 4, 2, 2, 0, 0 } };
 
 void X(codelet_hc2cf_2) (planner *p) {
      X(khc2c_register) (p, hc2cf_2, &desc, HC2C_VIA_RDFT);
@@ -558,7 +558,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cf_20", twinstr, &GENUS, { 136, 38, 110, 0 } };
+static const hc2c_desc desc = { 20, "hc2cf_20", twinstr, &GENUS, { 136, 38, 110, 0, 0 } };
 
 void X(codelet_hc2cf_20) (planner *p) {
      X(khc2c_register) (p, hc2cf_20, &desc, HC2C_VIA_RDFT);
@@ -1042,7 +1042,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cf_20", twinstr, &GENUS, { 184, 62, 62, 0 } };
+static const hc2c_desc desc = { 20, "hc2cf_20", twinstr, &GENUS, { 184, 62, 62, 0, 0 } };
 
 void X(codelet_hc2cf_20) (planner *p) {
      X(khc2c_register) (p, hc2cf_20, &desc, HC2C_VIA_RDFT);
@@ -938,7 +938,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 32, "hc2cf_32", twinstr, &GENUS, { 236, 62, 198, 0 } };
+static const hc2c_desc desc = { 32, "hc2cf_32", twinstr, &GENUS, { 236, 62, 198, 0, 0 } };
 
 void X(codelet_hc2cf_32) (planner *p) {
      X(khc2c_register) (p, hc2cf_32, &desc, HC2C_VIA_RDFT);
@@ -1801,7 +1801,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 32, "hc2cf_32", twinstr, &GENUS, { 340, 114, 94, 0 } };
+static const hc2c_desc desc = { 32, "hc2cf_32", twinstr, &GENUS, { 340, 114, 94, 0, 0 } };
 
 void X(codelet_hc2cf_32) (planner *p) {
      X(khc2c_register) (p, hc2cf_32, &desc, HC2C_VIA_RDFT);
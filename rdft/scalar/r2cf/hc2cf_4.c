@@ -106,7 +106,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 4, "hc2cf_4", twinstr, &GENUS, { 16, 6, 6, 0 } };
+static const hc2c_desc desc = { 4, "hc2cf_4", twinstr, &GENUS, { 16, 6, 6, 0, 0 } };
 
 void X(codelet_hc2cf_4) (planner *p) {
      X(khc2c_register) (p, hc2cf_4, &desc, HC2C_VIA_RDFT);
@@ -188,7 +188,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 4, "hc2cf_4", twinstr, &GENUS, { 16, 6, 6, 0 } };
+static const hc2c_desc desc = { 4, "hc2cf_4", twinstr, &GENUS, { 16, 6, 6, 0, 0 } };
 
 void X(codelet_hc2cf_4) (planner *p) {
      X(khc2c_register) (p, hc2cf_4, &desc, HC2C_VIA_RDFT);
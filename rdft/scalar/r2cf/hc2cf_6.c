@@ -156,7 +156,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 6, "hc2cf_6", twinstr, &GENUS, { 24, 10, 22, 0 } };
+static const hc2c_desc desc = { 6, "hc2cf_6", twinstr, &GENUS, { 24, 10, 22, 0, 0 } };
 
 void X(codelet_hc2cf_6) (planner *p) {
      X(khc2c_register) (p, hc2cf_6, &desc, HC2C_VIA_RDFT);
@@ -287,7 +287,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 6, "hc2cf_6", twinstr, &GENUS, { 32, 14, 14, 0 } };
+static const hc2c_desc desc = { 6, "hc2cf_6", twinstr, &GENUS, { 32, 14, 14, 0, 0 } };
 
 void X(codelet_hc2cf_6) (planner *p) {
      X(khc2c_register) (p, hc2cf_6, &desc, HC2C_VIA_RDFT);
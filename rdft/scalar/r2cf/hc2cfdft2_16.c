@@ -482,7 +482,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 16, "hc2cfdft2_16", twinstr, &GENUS, { 136, 74, 92, 0 } };
+static const hc2c_desc desc = { 16, "hc2cfdft2_16", twinstr, &GENUS, { 136, 74, 92, 0, 0 } };
 
 void X(codelet_hc2cfdft2_16) (planner *p) {
      X(khc2c_register) (p, hc2cfdft2_16, &desc, HC2C_VIA_DFT);
@@ -929,7 +929,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 16, "hc2cfdft2_16", twinstr, &GENUS, { 188, 84, 40, 0 } };
+static const hc2c_desc desc = { 16, "hc2cfdft2_16", twinstr, &GENUS, { 188, 84, 40, 0, 0 } };
 
 void X(codelet_hc2cfdft2_16) (planner *p) {
      X(khc2c_register) (p, hc2cfdft2_16, &desc, HC2C_VIA_DFT);
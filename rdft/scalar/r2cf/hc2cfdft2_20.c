@@ -625,7 +625,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cfdft2_20", twinstr, &GENUS, { 176, 98, 140, 0 } };
+static const hc2c_desc desc = { 20, "hc2cfdft2_20", twinstr, &GENUS, { 176, 98, 140, 0, 0 } };
 
 void X(codelet_hc2cfdft2_20) (planner *p) {
      X(khc2c_register) (p, hc2cfdft2_20, &desc, HC2C_VIA_DFT);
@@ -1195,7 +1195,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cfdft2_20", twinstr, &GENUS, { 244, 108, 72, 0 } };
+static const hc2c_desc desc = { 20, "hc2cfdft2_20", twinstr, &GENUS, { 244, 108, 72, 0, 0 } };
 
 void X(codelet_hc2cfdft2_20) (planner *p) {
      X(khc2c_register) (p, hc2cfdft2_20, &desc, HC2C_VIA_DFT);
@@ -1071,7 +1071,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 32, "hc2cfdft2_32", twinstr, &GENUS, { 300, 162, 252, 0 } };
+static const hc2c_desc desc = { 32, "hc2cfdft2_32", twinstr, &GENUS, { 300, 162, 252, 0, 0 } };
 
 void X(codelet_hc2cfdft2_32) (planner *p) {
      X(khc2c_register) (p, hc2cfdft2_32, &desc, HC2C_VIA_DFT);
@@ -2049,7 +2049,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 32, "hc2cfdft2_32", twinstr, &GENUS, { 440, 188, 112, 0 } };
+static const hc2c_desc desc = { 32, "hc2cfdft2_32", twinstr, &GENUS, { 440, 188, 112, 0, 0 } };
 
 void X(codelet_hc2cfdft2_32) (planner *p) {
      X(khc2c_register) (p, hc2cfdft2_32, &desc, HC2C_VIA_DFT);
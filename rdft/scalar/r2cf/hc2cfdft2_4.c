@@ -118,7 +118,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 4, "hc2cfdft2_4", twinstr, &GENUS, { 24, 16, 8, 0 } };
+static const hc2c_desc desc = { 4, "hc2cfdft2_4", twinstr, &GENUS, { 24, 16, 8, 0, 0 } };
 
 void X(codelet_hc2cfdft2_4) (planner *p) {
      X(khc2c_register) (p, hc2cfdft2_4, &desc, HC2C_VIA_DFT);
@@ -213,7 +213,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 4, "hc2cfdft2_4", twinstr, &GENUS, { 24, 16, 8, 0 } };
+static const hc2c_desc desc = { 4, "hc2cfdft2_4", twinstr, &GENUS, { 24, 16, 8, 0, 0 } };
 
 void X(codelet_hc2cfdft2_4) (planner *p) {
      X(khc2c_register) (p, hc2cfdft2_4, &desc, HC2C_VIA_DFT);
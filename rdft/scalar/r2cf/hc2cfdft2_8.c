@@ -243,7 +243,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 8, "hc2cfdft2_8", twinstr, &GENUS, { 60, 36, 30, 0 } };
+static const hc2c_desc desc = { 8, "hc2cfdft2_8", twinstr, &GENUS, { 60, 36, 30, 0, 0 } };
 
 void X(codelet_hc2cfdft2_8) (planner *p) {
      X(khc2c_register) (p, hc2cfdft2_8, &desc, HC2C_VIA_DFT);
@@ -434,7 +434,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 8, "hc2cfdft2_8", twinstr, &GENUS, { 72, 38, 18, 0 } };
+static const hc2c_desc desc = { 8, "hc2cfdft2_8", twinstr, &GENUS, { 72, 38, 18, 0, 0 } };
 
 void X(codelet_hc2cfdft2_8) (planner *p) {
      X(khc2c_register) (p, hc2cfdft2_8, &desc, HC2C_VIA_DFT);
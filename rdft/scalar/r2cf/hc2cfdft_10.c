@@ -289,7 +289,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 10, "hc2cfdft_10", twinstr, &GENUS, { 68, 38, 54, 0 } };
+static const hc2c_desc desc = { 10, "hc2cfdft_10", twinstr, &GENUS, { 68, 38, 54, 0, 0 } };
 
 void X(codelet_hc2cfdft_10) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_10, &desc, HC2C_VIA_DFT);
@@ -538,7 +538,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 10, "hc2cfdft_10", twinstr, &GENUS, { 92, 38, 30, 0 } };
+static const hc2c_desc desc = { 10, "hc2cfdft_10", twinstr, &GENUS, { 92, 38, 30, 0, 0 } };
 
 void X(codelet_hc2cfdft_10) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_10, &desc, HC2C_VIA_DFT);
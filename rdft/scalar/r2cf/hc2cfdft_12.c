@@ -335,7 +335,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 12, "hc2cfdft_12", twinstr, &GENUS, { 96, 46, 46, 0 } };
+static const hc2c_desc desc = { 12, "hc2cfdft_12", twinstr, &GENUS, { 96, 46, 46, 0, 0 } };
 
 void X(codelet_hc2cfdft_12) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_12, &desc, HC2C_VIA_DFT);
@@ -638,7 +638,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 12, "hc2cfdft_12", twinstr, &GENUS, { 112, 46, 30, 0 } };
+static const hc2c_desc desc = { 12, "hc2cfdft_12", twinstr, &GENUS, { 112, 46, 30, 0, 0 } };
 
 void X(codelet_hc2cfdft_12) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_12, &desc, HC2C_VIA_DFT);
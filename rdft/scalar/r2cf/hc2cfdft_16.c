@@ -469,7 +469,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 16, "hc2cfdft_16", twinstr, &GENUS, { 136, 62, 70, 0 } };
+static const hc2c_desc desc = { 16, "hc2cfdft_16", twinstr, &GENUS, { 136, 62, 70, 0, 0 } };
 
 void X(codelet_hc2cfdft_16) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_16, &desc, HC2C_VIA_DFT);
@@ -901,7 +901,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 16, "hc2cfdft_16", twinstr, &GENUS, { 168, 62, 38, 0 } };
+static const hc2c_desc desc = { 16, "hc2cfdft_16", twinstr, &GENUS, { 168, 62, 38, 0, 0 } };
 
 void X(codelet_hc2cfdft_16) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_16, &desc, HC2C_VIA_DFT);
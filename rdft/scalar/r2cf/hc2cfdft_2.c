@@ -71,7 +71,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 2, "hc2cfdft_2", twinstr, &GENUS, { 8, 6, 2, 0 } };
+static const hc2c_desc desc = { 2, "hc2cfdft_2", twinstr, &GENUS, { 8, 6, 2, 0, 0 } };
 
 void X(codelet_hc2cfdft_2) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_2, &desc, HC2C_VIA_DFT);
@@ -125,7 +125,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 2, "hc2cfdft_2", twinstr, &GENUS, { 8, 6, 2, 0 } };
+static const hc2c_desc desc = { 2, "hc2cfdft_2", twinstr, &GENUS, { 8, 6, 2, 0, 0 } };
 
 void X(codelet_hc2cfdft_2) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_2, &desc, HC2C_VIA_DFT);
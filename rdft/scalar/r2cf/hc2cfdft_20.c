@@ -593,7 +593,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cfdft_20", twinstr, &GENUS, { 176, 78, 110, 0 } };
+static const hc2c_desc desc = { 20, "hc2cfdft_20", twinstr, &GENUS, { 176, 78, 110, 0, 0 } };
 
 void X(codelet_hc2cfdft_20) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_20, &desc, HC2C_VIA_DFT);
@@ -1147,7 +1147,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 20, "hc2cfdft_20", twinstr, &GENUS, { 224, 78, 62, 0 } };
+static const hc2c_desc desc = { 20, "hc2cfdft_20", twinstr, &GENUS, { 224, 78, 62, 0, 0 } };
 
 void X(codelet_hc2cfdft_20) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_20, &desc, HC2C_VIA_DFT);
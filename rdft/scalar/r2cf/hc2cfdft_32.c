@@ -1020,7 +1020,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 32, "hc2cfdft_32", twinstr, &GENUS, { 300, 126, 198, 0 } };
+static const hc2c_desc desc = { 32, "hc2cfdft_32", twinstr, &GENUS, { 300, 126, 198, 0, 0 } };
 
 void X(codelet_hc2cfdft_32) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_32, &desc, HC2C_VIA_DFT);
@@ -1975,7 +1975,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 32, "hc2cfdft_32", twinstr, &GENUS, { 404, 134, 94, 0 } };
+static const hc2c_desc desc = { 32, "hc2cfdft_32", twinstr, &GENUS, { 404, 134, 94, 0, 0 } };
 
 void X(codelet_hc2cfdft_32) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_32, &desc, HC2C_VIA_DFT);
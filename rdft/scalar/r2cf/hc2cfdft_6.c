@@ -183,7 +183,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 6, "hc2cfdft_6", twinstr, &GENUS, { 36, 22, 22, 0 } };
+static const hc2c_desc desc = { 6, "hc2cfdft_6", twinstr, &GENUS, { 36, 22, 22, 0, 0 } };
 
 void X(codelet_hc2cfdft_6) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_6, &desc, HC2C_VIA_DFT);
@@ -331,7 +331,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 6, "hc2cfdft_6", twinstr, &GENUS, { 44, 22, 14, 0 } };
+static const hc2c_desc desc = { 6, "hc2cfdft_6", twinstr, &GENUS, { 44, 22, 14, 0, 0 } };
 
 void X(codelet_hc2cfdft_6) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_6, &desc, HC2C_VIA_DFT);
@@ -241,7 +241,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 8, "hc2cfdft_8", twinstr, &GENUS, { 60, 30, 22, 0 } };
+static const hc2c_desc desc = { 8, "hc2cfdft_8", twinstr, &GENUS, { 60, 30, 22, 0, 0 } };
 
 void X(codelet_hc2cfdft_8) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_8, &desc, HC2C_VIA_DFT);
@@ -429,7 +429,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2c_desc desc = { 8, "hc2cfdft_8", twinstr, &GENUS, { 68, 30, 14, 0 } };
+static const hc2c_desc desc = { 8, "hc2cfdft_8", twinstr, &GENUS, { 68, 30, 14, 0, 0 } };
 
 void X(codelet_hc2cfdft_8) (planner *p) {
      X(khc2c_register) (p, hc2cfdft_8, &desc, HC2C_VIA_DFT);
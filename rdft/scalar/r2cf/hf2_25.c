@@ -870,7 +870,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 25, "hf2_25", twinstr, &GENUS, { 84, 78, 356, 0 } };
+static const hc2hc_desc desc = { 25, "hf2_25", twinstr, &GENUS, { 84, 78, 356, 0, 0 } };
 
 void X(codelet_hf2_25) (planner *p) {
      X(khc2hc_register) (p, hf2_25, &desc);
@@ -1612,7 +1612,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 25, "hf2_25", twinstr, &GENUS, { 280, 180, 160, 0 } };
+static const hc2hc_desc desc = { 25, "hf2_25", twinstr, &GENUS, { 280, 180, 160, 0, 0 } };
 
 void X(codelet_hf2_25) (planner *p) {
      X(khc2hc_register) (p, hf2_25, &desc);
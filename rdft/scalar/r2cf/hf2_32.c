@@ -1005,7 +1005,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 32, "hf2_32", twinstr, &GENUS, { 236, 98, 252, 0 } };
+static const hc2hc_desc desc = { 32, "hf2_32", twinstr, &GENUS, { 236, 98, 252, 0, 0 } };
 
 void X(codelet_hf2_32) (planner *p) {
      X(khc2hc_register) (p, hf2_32, &desc);
@@ -1885,7 +1885,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 32, "hf2_32", twinstr, &GENUS, { 376, 168, 112, 0 } };
+static const hc2hc_desc desc = { 32, "hf2_32", twinstr, &GENUS, { 376, 168, 112, 0, 0 } };
 
 void X(codelet_hf2_32) (planner *p) {
      X(khc2hc_register) (p, hf2_32, &desc);
@@ -112,7 +112,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 4, "hf2_4", twinstr, &GENUS, { 16, 8, 8, 0 } };
+static const hc2hc_desc desc = { 4, "hf2_4", twinstr, &GENUS, { 16, 8, 8, 0, 0 } };
 
 void X(codelet_hf2_4) (planner *p) {
      X(khc2hc_register) (p, hf2_4, &desc);
@@ -192,7 +192,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 4, "hf2_4", twinstr, &GENUS, { 16, 8, 8, 0 } };
+static const hc2hc_desc desc = { 4, "hf2_4", twinstr, &GENUS, { 16, 8, 8, 0, 0 } };
 
 void X(codelet_hf2_4) (planner *p) {
      X(khc2hc_register) (p, hf2_4, &desc);
@@ -137,7 +137,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 5, "hf2_5", twinstr, &GENUS, { 14, 10, 30, 0 } };
+static const hc2hc_desc desc = { 5, "hf2_5", twinstr, &GENUS, { 14, 10, 30, 0, 0 } };
 
 void X(codelet_hf2_5) (planner *p) {
      X(khc2hc_register) (p, hf2_5, &desc);
@@ -256,7 +256,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 5, "hf2_5", twinstr, &GENUS, { 30, 18, 14, 0 } };
+static const hc2hc_desc desc = { 5, "hf2_5", twinstr, &GENUS, { 30, 18, 14, 0, 0 } };
 
 void X(codelet_hf2_5) (planner *p) {
      X(khc2hc_register) (p, hf2_5, &desc);
@@ -257,7 +257,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 10, "hf_10", twinstr, &GENUS, { 48, 18, 54, 0 } };
+static const hc2hc_desc desc = { 10, "hf_10", twinstr, &GENUS, { 48, 18, 54, 0, 0 } };
 
 void X(codelet_hf_10) (planner *p) {
      X(khc2hc_register) (p, hf_10, &desc);
@@ -481,7 +481,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 10, "hf_10", twinstr, &GENUS, { 72, 30, 30, 0 } };
+static const hc2hc_desc desc = { 10, "hf_10", twinstr, &GENUS, { 72, 30, 30, 0, 0 } };
 
 void X(codelet_hf_10) (planner *p) {
      X(khc2hc_register) (p, hf_10, &desc);
@@ -302,7 +302,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 12, "hf_12", twinstr, &GENUS, { 72, 22, 46, 0 } };
+static const hc2hc_desc desc = { 12, "hf_12", twinstr, &GENUS, { 72, 22, 46, 0, 0 } };
 
 void X(codelet_hf_12) (planner *p) {
      X(khc2hc_register) (p, hf_12, &desc);
@@ -573,7 +573,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 12, "hf_12", twinstr, &GENUS, { 88, 30, 30, 0 } };
+static const hc2hc_desc desc = { 12, "hf_12", twinstr, &GENUS, { 88, 30, 30, 0, 0 } };
 
 void X(codelet_hf_12) (planner *p) {
      X(khc2hc_register) (p, hf_12, &desc);
@@ -432,7 +432,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 15, "hf_15", twinstr, &GENUS, { 72, 28, 112, 0 } };
+static const hc2hc_desc desc = { 15, "hf_15", twinstr, &GENUS, { 72, 28, 112, 0, 0 } };
 
 void X(codelet_hf_15) (planner *p) {
      X(khc2hc_register) (p, hf_15, &desc);
@@ -808,7 +808,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 15, "hf_15", twinstr, &GENUS, { 128, 56, 56, 0 } };
+static const hc2hc_desc desc = { 15, "hf_15", twinstr, &GENUS, { 128, 56, 56, 0, 0 } };
 
 void X(codelet_hf_15) (planner *p) {
      X(khc2hc_register) (p, hf_15, &desc);
@@ -411,7 +411,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 16, "hf_16", twinstr, &GENUS, { 104, 30, 70, 0 } };
+static const hc2hc_desc desc = { 16, "hf_16", twinstr, &GENUS, { 104, 30, 70, 0, 0 } };
 
 void X(codelet_hf_16) (planner *p) {
      X(khc2hc_register) (p, hf_16, &desc);
@@ -788,7 +788,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 16, "hf_16", twinstr, &GENUS, { 136, 46, 38, 0 } };
+static const hc2hc_desc desc = { 16, "hf_16", twinstr, &GENUS, { 136, 46, 38, 0, 0 } };
 
 void X(codelet_hf_16) (planner *p) {
      X(khc2hc_register) (p, hf_16, &desc);
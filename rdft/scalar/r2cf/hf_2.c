@@ -63,7 +63,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 2, "hf_2", twinstr, &GENUS, { 4, 2, 2, 0 } };
+static const hc2hc_desc desc = { 2, "hf_2", twinstr, &GENUS, { 4, 2, 2, 0, 0 } };
 
 void X(codelet_hf_2) (planner *p) {
      X(khc2hc_register) (p, hf_2, &desc);
@@ -109,7 +109,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 2, "hf_2", twinstr, &GENUS, { 4, 2, 2, 0 } };
+static const hc2hc_desc desc = { 2, "hf_2", twinstr, &GENUS, { 4, 2, 2, 0, 0 } };
 
 void X(codelet_hf_2) (planner *p) {
      X(khc2hc_register) (p, hf_2, &desc);
@@ -558,7 +558,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 20, "hf_20", twinstr, &GENUS, { 136, 38, 110, 0 } };
+static const hc2hc_desc desc = { 20, "hf_20", twinstr, &GENUS, { 136, 38, 110, 0, 0 } };
 
 void X(codelet_hf_20) (planner *p) {
      X(khc2hc_register) (p, hf_20, &desc);
@@ -1042,7 +1042,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 20, "hf_20", twinstr, &GENUS, { 184, 62, 62, 0 } };
+static const hc2hc_desc desc = { 20, "hf_20", twinstr, &GENUS, { 184, 62, 62, 0, 0 } };
 
 void X(codelet_hf_20) (planner *p) {
      X(khc2hc_register) (p, hf_20, &desc);
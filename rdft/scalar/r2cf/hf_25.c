@@ -818,7 +818,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 25, "hf_25", twinstr, &GENUS, { 84, 48, 316, 0 } };
+static const hc2hc_desc desc = { 25, "hf_25", twinstr, &GENUS, { 84, 48, 316, 0, 0 } };
 
 void X(codelet_hf_25) (planner *p) {
      X(khc2hc_register) (p, hf_25, &desc);
@@ -1564,7 +1564,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 25, "hf_25", twinstr, &GENUS, { 260, 140, 140, 0 } };
+static const hc2hc_desc desc = { 25, "hf_25", twinstr, &GENUS, { 260, 140, 140, 0, 0 } };
 
 void X(codelet_hf_25) (planner *p) {
      X(khc2hc_register) (p, hf_25, &desc);
@@ -90,7 +90,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 3, "hf_3", twinstr, &GENUS, { 6, 4, 10, 0 } };
+static const hc2hc_desc desc = { 3, "hf_3", twinstr, &GENUS, { 6, 4, 10, 0, 0 } };
 
 void X(codelet_hf_3) (planner *p) {
      X(khc2hc_register) (p, hf_3, &desc);
@@ -158,7 +158,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 3, "hf_3", twinstr, &GENUS, { 10, 6, 6, 0 } };
+static const hc2hc_desc desc = { 3, "hf_3", twinstr, &GENUS, { 10, 6, 6, 0, 0 } };
 
 void X(codelet_hf_3) (planner *p) {
      X(khc2hc_register) (p, hf_3, &desc);
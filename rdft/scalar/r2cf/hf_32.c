@@ -938,7 +938,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 32, "hf_32", twinstr, &GENUS, { 236, 62, 198, 0 } };
+static const hc2hc_desc desc = { 32, "hf_32", twinstr, &GENUS, { 236, 62, 198, 0, 0 } };
 
 void X(codelet_hf_32) (planner *p) {
      X(khc2hc_register) (p, hf_32, &desc);
@@ -1801,7 +1801,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 32, "hf_32", twinstr, &GENUS, { 340, 114, 94, 0 } };
+static const hc2hc_desc desc = { 32, "hf_32", twinstr, &GENUS, { 340, 114, 94, 0, 0 } };
 
 void X(codelet_hf_32) (planner *p) {
      X(khc2hc_register) (p, hf_32, &desc);
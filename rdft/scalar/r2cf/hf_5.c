@@ -131,7 +131,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 5, "hf_5", twinstr, &GENUS, { 14, 8, 26, 0 } };
+static const hc2hc_desc desc = { 5, "hf_5", twinstr, &GENUS, { 14, 8, 26, 0, 0 } };
 
 void X(codelet_hf_5) (planner *p) {
      X(khc2hc_register) (p, hf_5, &desc);
@@ -245,7 +245,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 5, "hf_5", twinstr, &GENUS, { 26, 14, 14, 0 } };
+static const hc2hc_desc desc = { 5, "hf_5", twinstr, &GENUS, { 26, 14, 14, 0, 0 } };
 
 void X(codelet_hf_5) (planner *p) {
      X(khc2hc_register) (p, hf_5, &desc);
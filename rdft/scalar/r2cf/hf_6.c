@@ -156,7 +156,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 6, "hf_6", twinstr, &GENUS, { 24, 10, 22, 0 } };
+static const hc2hc_desc desc = { 6, "hf_6", twinstr, &GENUS, { 24, 10, 22, 0, 0 } };
 
 void X(codelet_hf_6) (planner *p) {
      X(khc2hc_register) (p, hf_6, &desc);
@@ -287,7 +287,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 6, "hf_6", twinstr, &GENUS, { 32, 14, 14, 0 } };
+static const hc2hc_desc desc = { 6, "hf_6", twinstr, &GENUS, { 32, 14, 14, 0, 0 } };
 
 void X(codelet_hf_6) (planner *p) {
      X(khc2hc_register) (p, hf_6, &desc);
@@ -2125,7 +2125,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 64, "hf_64", twinstr, &GENUS, { 520, 126, 518, 0 } };
+static const hc2hc_desc desc = { 64, "hf_64", twinstr, &GENUS, { 520, 126, 518, 0, 0 } };
 
 void X(codelet_hf_64) (planner *p) {
      X(khc2hc_register) (p, hf_64, &desc);
@@ -4097,7 +4097,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 64, "hf_64", twinstr, &GENUS, { 808, 270, 230, 0 } };
+static const hc2hc_desc desc = { 64, "hf_64", twinstr, &GENUS, { 808, 270, 230, 0, 0 } };
 
 void X(codelet_hf_64) (planner *p) {
      X(khc2hc_register) (p, hf_64, &desc);
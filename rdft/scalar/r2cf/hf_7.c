@@ -197,7 +197,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 7, "hf_7", twinstr, &GENUS, { 18, 12, 54, 0 } };
+static const hc2hc_desc desc = { 7, "hf_7", twinstr, &GENUS, { 18, 12, 54, 0, 0 } };
 
 void X(codelet_hf_7) (planner *p) {
      X(khc2hc_register) (p, hf_7, &desc);
@@ -346,7 +346,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 7, "hf_7", twinstr, &GENUS, { 36, 24, 36, 0 } };
+static const hc2hc_desc desc = { 7, "hf_7", twinstr, &GENUS, { 36, 24, 36, 0, 0 } };
 
 void X(codelet_hf_7) (planner *p) {
      X(khc2hc_register) (p, hf_7, &desc);
@@ -252,7 +252,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 9, "hf_9", twinstr, &GENUS, { 24, 16, 72, 0 } };
+static const hc2hc_desc desc = { 9, "hf_9", twinstr, &GENUS, { 24, 16, 72, 0, 0 } };
 
 void X(codelet_hf_9) (planner *p) {
      X(khc2hc_register) (p, hf_9, &desc);
@@ -479,7 +479,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, 1, 0 }
 };
 
-static const hc2hc_desc desc = { 9, "hf_9", twinstr, &GENUS, { 60, 36, 36, 0 } };
+static const hc2hc_desc desc = { 9, "hf_9", twinstr, &GENUS, { 60, 36, 36, 0, 0 } };
 
 void X(codelet_hf_9) (planner *p) {
      X(khc2hc_register) (p, hf_9, &desc);
@@ -102,7 +102,7 @@ static void r2cfII_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 10, "r2cfII_10", { 14, 0, 18, 0 }, &GENUS };
+static const kr2c_desc desc = { 10, "r2cfII_10", { 14, 0, 18, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_10) (planner *p) { X(kr2c_register) (p, r2cfII_10, &desc);
 }
@@ -186,7 +186,7 @@ static void r2cfII_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 10, "r2cfII_10", { 26, 6, 6, 0 }, &GENUS };
+static const kr2c_desc desc = { 10, "r2cfII_10", { 26, 6, 6, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_10) (planner *p) { X(kr2c_register) (p, r2cfII_10, &desc);
 }
@@ -117,7 +117,7 @@ static void r2cfII_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 12, "r2cfII_12", { 21, 0, 24, 0 }, &GENUS };
+static const kr2c_desc desc = { 12, "r2cfII_12", { 21, 0, 24, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_12) (planner *p) { X(kr2c_register) (p, r2cfII_12, &desc);
 }
@@ -217,7 +217,7 @@ static void r2cfII_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 12, "r2cfII_12", { 39, 8, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 12, "r2cfII_12", { 39, 8, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_12) (planner *p) { X(kr2c_register) (p, r2cfII_12, &desc);
 }
@@ -162,7 +162,7 @@ static void r2cfII_15(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 15, "r2cfII_15", { 38, 7, 34, 0 }, &GENUS };
+static const kr2c_desc desc = { 15, "r2cfII_15", { 38, 7, 34, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_15) (planner *p) { X(kr2c_register) (p, r2cfII_15, &desc);
 }
@@ -289,7 +289,7 @@ static void r2cfII_15(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 15, "r2cfII_15", { 54, 15, 18, 0 }, &GENUS };
+static const kr2c_desc desc = { 15, "r2cfII_15", { 54, 15, 18, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_15) (planner *p) { X(kr2c_register) (p, r2cfII_15, &desc);
 }
@@ -161,7 +161,7 @@ static void r2cfII_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 16, "r2cfII_16", { 18, 0, 48, 0 }, &GENUS };
+static const kr2c_desc desc = { 16, "r2cfII_16", { 18, 0, 48, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_16) (planner *p) { X(kr2c_register) (p, r2cfII_16, &desc);
 }
@@ -304,7 +304,7 @@ static void r2cfII_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 16, "r2cfII_16", { 54, 18, 12, 0 }, &GENUS };
+static const kr2c_desc desc = { 16, "r2cfII_16", { 54, 18, 12, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_16) (planner *p) { X(kr2c_register) (p, r2cfII_16, &desc);
 }
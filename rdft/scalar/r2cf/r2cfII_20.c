@@ -209,7 +209,7 @@ static void r2cfII_20(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 20, "r2cfII_20", { 39, 0, 63, 0 }, &GENUS };
+static const kr2c_desc desc = { 20, "r2cfII_20", { 39, 0, 63, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_20) (planner *p) { X(kr2c_register) (p, r2cfII_20, &desc);
 }
@@ -386,7 +386,7 @@ static void r2cfII_20(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 20, "r2cfII_20", { 86, 18, 16, 0 }, &GENUS };
+static const kr2c_desc desc = { 20, "r2cfII_20", { 86, 18, 16, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_20) (planner *p) { X(kr2c_register) (p, r2cfII_20, &desc);
 }
@@ -425,7 +425,7 @@ static void r2cfII_25(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 25, "r2cfII_25", { 47, 12, 165, 0 }, &GENUS };
+static const kr2c_desc desc = { 25, "r2cfII_25", { 47, 12, 165, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_25) (planner *p) { X(kr2c_register) (p, r2cfII_25, &desc);
 }
@@ -768,7 +768,7 @@ static void r2cfII_25(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 25, "r2cfII_25", { 126, 61, 87, 0 }, &GENUS };
+static const kr2c_desc desc = { 25, "r2cfII_25", { 126, 61, 87, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_25) (planner *p) { X(kr2c_register) (p, r2cfII_25, &desc);
 }
@@ -53,7 +53,7 @@ static void r2cfII_3(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 3, "r2cfII_3", { 3, 1, 1, 0 }, &GENUS };
+static const kr2c_desc desc = { 3, "r2cfII_3", { 3, 1, 1, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_3) (planner *p) { X(kr2c_register) (p, r2cfII_3, &desc);
 }
@@ -88,7 +88,7 @@ static void r2cfII_3(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 3, "r2cfII_3", { 3, 1, 1, 0 }, &GENUS };
+static const kr2c_desc desc = { 3, "r2cfII_3", { 3, 1, 1, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_3) (planner *p) { X(kr2c_register) (p, r2cfII_3, &desc);
 }
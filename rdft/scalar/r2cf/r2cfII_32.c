@@ -348,7 +348,7 @@ static void r2cfII_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 32, "r2cfII_32", { 46, 0, 128, 0 }, &GENUS };
+static const kr2c_desc desc = { 32, "r2cfII_32", { 46, 0, 128, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_32) (planner *p) { X(kr2c_register) (p, r2cfII_32, &desc);
 }
@@ -678,7 +678,7 @@ static void r2cfII_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 32, "r2cfII_32", { 138, 46, 36, 0 }, &GENUS };
+static const kr2c_desc desc = { 32, "r2cfII_32", { 138, 46, 36, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_32) (planner *p) { X(kr2c_register) (p, r2cfII_32, &desc);
 }
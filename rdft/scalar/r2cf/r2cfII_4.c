@@ -55,7 +55,7 @@ static void r2cfII_4(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 4, "r2cfII_4", { 2, 0, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 4, "r2cfII_4", { 2, 0, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_4) (planner *p) { X(kr2c_register) (p, r2cfII_4, &desc);
 }
@@ -92,7 +92,7 @@ static void r2cfII_4(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 4, "r2cfII_4", { 6, 2, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 4, "r2cfII_4", { 6, 2, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_4) (planner *p) { X(kr2c_register) (p, r2cfII_4, &desc);
 }
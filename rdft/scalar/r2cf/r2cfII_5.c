@@ -68,7 +68,7 @@ static void r2cfII_5(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 5, "r2cfII_5", { 7, 2, 5, 0 }, &GENUS };
+static const kr2c_desc desc = { 5, "r2cfII_5", { 7, 2, 5, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_5) (planner *p) { X(kr2c_register) (p, r2cfII_5, &desc);
 }
@@ -118,7 +118,7 @@ static void r2cfII_5(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 5, "r2cfII_5", { 9, 3, 3, 0 }, &GENUS };
+static const kr2c_desc desc = { 5, "r2cfII_5", { 9, 3, 3, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_5) (planner *p) { X(kr2c_register) (p, r2cfII_5, &desc);
 }
@@ -64,7 +64,7 @@ static void r2cfII_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 6, "r2cfII_6", { 7, 0, 6, 0 }, &GENUS };
+static const kr2c_desc desc = { 6, "r2cfII_6", { 7, 0, 6, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_6) (planner *p) { X(kr2c_register) (p, r2cfII_6, &desc);
 }
@@ -109,7 +109,7 @@ static void r2cfII_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 6, "r2cfII_6", { 11, 2, 2, 0 }, &GENUS };
+static const kr2c_desc desc = { 6, "r2cfII_6", { 11, 2, 2, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_6) (planner *p) { X(kr2c_register) (p, r2cfII_6, &desc);
 }
@@ -779,7 +779,7 @@ static void r2cfII_64(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 64, "r2cfII_64", { 114, 0, 320, 0 }, &GENUS };
+static const kr2c_desc desc = { 64, "r2cfII_64", { 114, 0, 320, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_64) (planner *p) { X(kr2c_register) (p, r2cfII_64, &desc);
 }
@@ -1540,7 +1540,7 @@ static void r2cfII_64(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride
      }
 }
 
-static const kr2c_desc desc = { 64, "r2cfII_64", { 342, 114, 92, 0 }, &GENUS };
+static const kr2c_desc desc = { 64, "r2cfII_64", { 342, 114, 92, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_64) (planner *p) { X(kr2c_register) (p, r2cfII_64, &desc);
 }
@@ -85,7 +85,7 @@ static void r2cfII_7(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 7, "r2cfII_7", { 9, 3, 15, 0 }, &GENUS };
+static const kr2c_desc desc = { 7, "r2cfII_7", { 9, 3, 15, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_7) (planner *p) { X(kr2c_register) (p, r2cfII_7, &desc);
 }
@@ -140,7 +140,7 @@ static void r2cfII_7(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 7, "r2cfII_7", { 12, 6, 12, 0 }, &GENUS };
+static const kr2c_desc desc = { 7, "r2cfII_7", { 12, 6, 12, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_7) (planner *p) { X(kr2c_register) (p, r2cfII_7, &desc);
 }
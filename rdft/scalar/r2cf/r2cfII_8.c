@@ -86,7 +86,7 @@ static void r2cfII_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 8, "r2cfII_8", { 6, 0, 16, 0 }, &GENUS };
+static const kr2c_desc desc = { 8, "r2cfII_8", { 6, 0, 16, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_8) (planner *p) { X(kr2c_register) (p, r2cfII_8, &desc);
 }
@@ -154,7 +154,7 @@ static void r2cfII_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 8, "r2cfII_8", { 18, 6, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 8, "r2cfII_8", { 18, 6, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_8) (planner *p) { X(kr2c_register) (p, r2cfII_8, &desc);
 }
@@ -125,7 +125,7 @@ static void r2cfII_9(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 9, "r2cfII_9", { 12, 4, 30, 0 }, &GENUS };
+static const kr2c_desc desc = { 9, "r2cfII_9", { 12, 4, 30, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_9) (planner *p) { X(kr2c_register) (p, r2cfII_9, &desc);
 }
@@ -215,7 +215,7 @@ static void r2cfII_9(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 9, "r2cfII_9", { 25, 13, 17, 0 }, &GENUS };
+static const kr2c_desc desc = { 9, "r2cfII_9", { 25, 13, 17, 0, 0 }, &GENUS };
 
 void X(codelet_r2cfII_9) (planner *p) { X(kr2c_register) (p, r2cfII_9, &desc);
 }
@@ -105,7 +105,7 @@ static void r2cf_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 10, "r2cf_10", { 24, 4, 10, 0 }, &GENUS };
+static const kr2c_desc desc = { 10, "r2cf_10", { 24, 4, 10, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_10) (planner *p) { X(kr2c_register) (p, r2cf_10, &desc);
 }
@@ -192,7 +192,7 @@ static void r2cf_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 10, "r2cf_10", { 28, 6, 6, 0 }, &GENUS };
+static const kr2c_desc desc = { 10, "r2cf_10", { 28, 6, 6, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_10) (planner *p) { X(kr2c_register) (p, r2cf_10, &desc);
 }
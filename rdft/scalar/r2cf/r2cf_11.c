@@ -146,7 +146,7 @@ static void r2cf_11(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 11, "r2cf_11", { 15, 5, 45, 0 }, &GENUS };
+static const kr2c_desc desc = { 11, "r2cf_11", { 15, 5, 45, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_11) (planner *p) { X(kr2c_register) (p, r2cf_11, &desc);
 }
@@ -220,7 +220,7 @@ static void r2cf_11(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 11, "r2cf_11", { 20, 10, 40, 0 }, &GENUS };
+static const kr2c_desc desc = { 11, "r2cf_11", { 20, 10, 40, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_11) (planner *p) { X(kr2c_register) (p, r2cf_11, &desc);
 }
@@ -114,7 +114,7 @@ static void r2cf_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 12, "r2cf_12", { 30, 2, 8, 0 }, &GENUS };
+static const kr2c_desc desc = { 12, "r2cf_12", { 30, 2, 8, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_12) (planner *p) { X(kr2c_register) (p, r2cf_12, &desc);
 }
@@ -210,7 +210,7 @@ static void r2cf_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 12, "r2cf_12", { 34, 4, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 12, "r2cf_12", { 34, 4, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_12) (planner *p) { X(kr2c_register) (p, r2cf_12, &desc);
 }
@@ -1627,7 +1627,7 @@ static void r2cf_128(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 128, "r2cf_128", { 440, 0, 516, 0 }, &GENUS };
+static const kr2c_desc desc = { 128, "r2cf_128", { 440, 0, 516, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_128) (planner *p) { X(kr2c_register) (p, r2cf_128, &desc);
 }
@@ -3236,7 +3236,7 @@ static void r2cf_128(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride c
      }
 }
 
-static const kr2c_desc desc = { 128, "r2cf_128", { 812, 186, 144, 0 }, &GENUS };
+static const kr2c_desc desc = { 128, "r2cf_128", { 812, 186, 144, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_128) (planner *p) { X(kr2c_register) (p, r2cf_128, &desc);
 }
@@ -187,7 +187,7 @@ static void r2cf_13(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 13, "r2cf_13", { 31, 6, 45, 0 }, &GENUS };
+static const kr2c_desc desc = { 13, "r2cf_13", { 31, 6, 45, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_13) (planner *p) { X(kr2c_register) (p, r2cf_13, &desc);
 }
@@ -353,7 +353,7 @@ static void r2cf_13(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 13, "r2cf_13", { 57, 15, 19, 0 }, &GENUS };
+static const kr2c_desc desc = { 13, "r2cf_13", { 57, 15, 19, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_13) (planner *p) { X(kr2c_register) (p, r2cf_13, &desc);
 }
@@ -153,7 +153,7 @@ static void r2cf_14(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 14, "r2cf_14", { 32, 6, 30, 0 }, &GENUS };
+static const kr2c_desc desc = { 14, "r2cf_14", { 32, 6, 30, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_14) (planner *p) { X(kr2c_register) (p, r2cf_14, &desc);
 }
@@ -255,7 +255,7 @@ static void r2cf_14(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 14, "r2cf_14", { 38, 12, 24, 0 }, &GENUS };
+static const kr2c_desc desc = { 14, "r2cf_14", { 38, 12, 24, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_14) (planner *p) { X(kr2c_register) (p, r2cf_14, &desc);
 }
@@ -156,7 +156,7 @@ static void r2cf_15(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 15, "r2cf_15", { 36, 7, 28, 0 }, &GENUS };
+static const kr2c_desc desc = { 15, "r2cf_15", { 36, 7, 28, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_15) (planner *p) { X(kr2c_register) (p, r2cf_15, &desc);
 }
@@ -296,7 +296,7 @@ static void r2cf_15(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 15, "r2cf_15", { 50, 11, 14, 0 }, &GENUS };
+static const kr2c_desc desc = { 15, "r2cf_15", { 50, 11, 14, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_15) (planner *p) { X(kr2c_register) (p, r2cf_15, &desc);
 }
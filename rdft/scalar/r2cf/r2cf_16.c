@@ -149,7 +149,7 @@ static void r2cf_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 16, "r2cf_16", { 38, 0, 20, 0 }, &GENUS };
+static const kr2c_desc desc = { 16, "r2cf_16", { 38, 0, 20, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_16) (planner *p) { X(kr2c_register) (p, r2cf_16, &desc);
 }
@@ -280,7 +280,7 @@ static void r2cf_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 16, "r2cf_16", { 54, 8, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 16, "r2cf_16", { 54, 8, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_16) (planner *p) { X(kr2c_register) (p, r2cf_16, &desc);
 }
@@ -48,7 +48,7 @@ static void r2cf_2(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 2, "r2cf_2", { 2, 0, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 2, "r2cf_2", { 2, 0, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_2) (planner *p) { X(kr2c_register) (p, r2cf_2, &desc);
 }
@@ -78,7 +78,7 @@ static void r2cf_2(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 2, "r2cf_2", { 2, 0, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 2, "r2cf_2", { 2, 0, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_2) (planner *p) { X(kr2c_register) (p, r2cf_2, &desc);
 }
@@ -186,7 +186,7 @@ static void r2cf_20(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 20, "r2cf_20", { 58, 4, 28, 0 }, &GENUS };
+static const kr2c_desc desc = { 20, "r2cf_20", { 58, 4, 28, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_20) (planner *p) { X(kr2c_register) (p, r2cf_20, &desc);
 }
@@ -354,7 +354,7 @@ static void r2cf_20(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 20, "r2cf_20", { 74, 12, 12, 0 }, &GENUS };
+static const kr2c_desc desc = { 20, "r2cf_20", { 74, 12, 12, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_20) (planner *p) { X(kr2c_register) (p, r2cf_20, &desc);
 }
@@ -418,7 +418,7 @@ static void r2cf_25(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 25, "r2cf_25", { 44, 12, 156, 0 }, &GENUS };
+static const kr2c_desc desc = { 25, "r2cf_25", { 44, 12, 156, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_25) (planner *p) { X(kr2c_register) (p, r2cf_25, &desc);
 }
@@ -728,7 +728,7 @@ static void r2cf_25(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 25, "r2cf_25", { 117, 57, 83, 0 }, &GENUS };
+static const kr2c_desc desc = { 25, "r2cf_25", { 117, 57, 83, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_25) (planner *p) { X(kr2c_register) (p, r2cf_25, &desc);
 }
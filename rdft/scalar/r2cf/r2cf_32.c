@@ -310,7 +310,7 @@ static void r2cf_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 32, "r2cf_32", { 88, 0, 68, 0 }, &GENUS };
+static const kr2c_desc desc = { 32, "r2cf_32", { 88, 0, 68, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_32) (planner *p) { X(kr2c_register) (p, r2cf_32, &desc);
 }
@@ -602,7 +602,7 @@ static void r2cf_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 32, "r2cf_32", { 140, 26, 16, 0 }, &GENUS };
+static const kr2c_desc desc = { 32, "r2cf_32", { 140, 26, 16, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_32) (planner *p) { X(kr2c_register) (p, r2cf_32, &desc);
 }
@@ -54,7 +54,7 @@ static void r2cf_4(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 4, "r2cf_4", { 6, 0, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 4, "r2cf_4", { 6, 0, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_4) (planner *p) { X(kr2c_register) (p, r2cf_4, &desc);
 }
@@ -90,7 +90,7 @@ static void r2cf_4(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 4, "r2cf_4", { 6, 0, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 4, "r2cf_4", { 6, 0, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_4) (planner *p) { X(kr2c_register) (p, r2cf_4, &desc);
 }
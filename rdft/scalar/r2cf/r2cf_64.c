@@ -709,7 +709,7 @@ static void r2cf_64(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 64, "r2cf_64", { 198, 0, 196, 0 }, &GENUS };
+static const kr2c_desc desc = { 64, "r2cf_64", { 198, 0, 196, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_64) (planner *p) { X(kr2c_register) (p, r2cf_64, &desc);
 }
@@ -1400,7 +1400,7 @@ static void r2cf_64(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride cs
      }
 }
 
-static const kr2c_desc desc = { 64, "r2cf_64", { 342, 72, 52, 0 }, &GENUS };
+static const kr2c_desc desc = { 64, "r2cf_64", { 342, 72, 52, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_64) (planner *p) { X(kr2c_register) (p, r2cf_64, &desc);
 }
@@ -82,7 +82,7 @@ static void r2cf_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 8, "r2cf_8", { 16, 0, 4, 0 }, &GENUS };
+static const kr2c_desc desc = { 8, "r2cf_8", { 16, 0, 4, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_8) (planner *p) { X(kr2c_register) (p, r2cf_8, &desc);
 }
@@ -146,7 +146,7 @@ static void r2cf_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 8, "r2cf_8", { 20, 2, 0, 0 }, &GENUS };
+static const kr2c_desc desc = { 8, "r2cf_8", { 20, 2, 0, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_8) (planner *p) { X(kr2c_register) (p, r2cf_8, &desc);
 }
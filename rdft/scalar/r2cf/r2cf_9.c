@@ -122,7 +122,7 @@ static void r2cf_9(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 9, "r2cf_9", { 12, 4, 26, 0 }, &GENUS };
+static const kr2c_desc desc = { 9, "r2cf_9", { 12, 4, 26, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_9) (planner *p) { X(kr2c_register) (p, r2cf_9, &desc);
 }
@@ -209,7 +209,7 @@ static void r2cf_9(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi
      }
 }
 
-static const kr2c_desc desc = { 9, "r2cf_9", { 21, 9, 17, 0 }, &GENUS };
+static const kr2c_desc desc = { 9, "r2cf_9", { 21, 9, 17, 0, 0 }, &GENUS };
 
 void X(codelet_r2cf_9) (planner *p) { X(kr2c_register) (p, r2cf_9, &desc);
 }
@@ -98,7 +98,7 @@ static void e01_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ov
      }
 }
 
-static const kr2r_desc desc = { 8, "e01_8", { 2, 0, 24, 0 }, &GENUS, REDFT01 };
+static const kr2r_desc desc = { 8, "e01_8", { 2, 0, 24, 0, 0 }, &GENUS, REDFT01 };
 
 void X(codelet_e01_8) (planner *p) { X(kr2r_register) (p, e01_8, &desc);
 }
@@ -179,7 +179,7 @@ static void e01_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ov
      }
 }
 
-static const kr2r_desc desc = { 8, "e01_8", { 20, 9, 6, 0 }, &GENUS, REDFT01 };
+static const kr2r_desc desc = { 8, "e01_8", { 20, 9, 6, 0, 0 }, &GENUS, REDFT01 };
 
 void X(codelet_e01_8) (planner *p) { X(kr2r_register) (p, e01_8, &desc);
 }
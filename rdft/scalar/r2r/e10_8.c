@@ -99,7 +99,7 @@ static void e10_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ov
      }
 }
 
-static const kr2r_desc desc = { 8, "e10_8", { 16, 8, 10, 0 }, &GENUS, REDFT10 };
+static const kr2r_desc desc = { 8, "e10_8", { 16, 8, 10, 0, 0 }, &GENUS, REDFT10 };
 
 void X(codelet_e10_8) (planner *p) { X(kr2r_register) (p, e10_8, &desc);
 }
@@ -180,7 +180,7 @@ static void e10_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ov
      }
 }
 
-static const kr2r_desc desc = { 8, "e10_8", { 20, 10, 6, 0 }, &GENUS, REDFT10 };
+static const kr2r_desc desc = { 8, "e10_8", { 20, 10, 6, 0, 0 }, &GENUS, REDFT10 };
 
 void X(codelet_e10_8) (planner *p) { X(kr2r_register) (p, e10_8, &desc);
 }
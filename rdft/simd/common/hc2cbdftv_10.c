@@ -150,7 +150,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 10, XSIMD_STRING("hc2cbdftv_10"), twinstr, &GENUS, { 33, 22, 28, 0 } };
+static const hc2c_desc desc = { 10, XSIMD_STRING("hc2cbdftv_10"), twinstr, &GENUS, { 33, 22, 28, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_10) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_10, &desc, HC2C_VIA_DFT);
@@ -287,7 +287,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 10, XSIMD_STRING("hc2cbdftv_10"), twinstr, &GENUS, { 55, 24, 6, 0 } };
+static const hc2c_desc desc = { 10, XSIMD_STRING("hc2cbdftv_10"), twinstr, &GENUS, { 55, 24, 6, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_10) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_10, &desc, HC2C_VIA_DFT);
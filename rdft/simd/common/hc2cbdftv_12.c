@@ -169,7 +169,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 12, XSIMD_STRING("hc2cbdftv_12"), twinstr, &GENUS, { 45, 25, 26, 0 } };
+static const hc2c_desc desc = { 12, XSIMD_STRING("hc2cbdftv_12"), twinstr, &GENUS, { 45, 25, 26, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_12) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_12, &desc, HC2C_VIA_DFT);
@@ -319,7 +319,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 12, XSIMD_STRING("hc2cbdftv_12"), twinstr, &GENUS, { 67, 26, 4, 0 } };
+static const hc2c_desc desc = { 12, XSIMD_STRING("hc2cbdftv_12"), twinstr, &GENUS, { 67, 26, 4, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_12) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_12, &desc, HC2C_VIA_DFT);
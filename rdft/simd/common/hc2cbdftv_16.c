@@ -214,7 +214,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 16, XSIMD_STRING("hc2cbdftv_16"), twinstr, &GENUS, { 53, 30, 50, 0 } };
+static const hc2c_desc desc = { 16, XSIMD_STRING("hc2cbdftv_16"), twinstr, &GENUS, { 53, 30, 50, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_16) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_16, &desc, HC2C_VIA_DFT);
@@ -420,7 +420,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 16, XSIMD_STRING("hc2cbdftv_16"), twinstr, &GENUS, { 99, 38, 4, 0 } };
+static const hc2c_desc desc = { 16, XSIMD_STRING("hc2cbdftv_16"), twinstr, &GENUS, { 99, 38, 4, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_16) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_16, &desc, HC2C_VIA_DFT);
@@ -59,7 +59,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 2, XSIMD_STRING("hc2cbdftv_2"), twinstr, &GENUS, { 3, 2, 2, 0 } };
+static const hc2c_desc desc = { 2, XSIMD_STRING("hc2cbdftv_2"), twinstr, &GENUS, { 3, 2, 2, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_2) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_2, &desc, HC2C_VIA_DFT);
@@ -101,7 +101,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 2, XSIMD_STRING("hc2cbdftv_2"), twinstr, &GENUS, { 5, 2, 0, 0 } };
+static const hc2c_desc desc = { 2, XSIMD_STRING("hc2cbdftv_2"), twinstr, &GENUS, { 5, 2, 0, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_2) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_2, &desc, HC2C_VIA_DFT);
@@ -272,7 +272,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 20, XSIMD_STRING("hc2cbdftv_20"), twinstr, &GENUS, { 77, 42, 66, 0 } };
+static const hc2c_desc desc = { 20, XSIMD_STRING("hc2cbdftv_20"), twinstr, &GENUS, { 77, 42, 66, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_20) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_20, &desc, HC2C_VIA_DFT);
@@ -537,7 +537,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 20, XSIMD_STRING("hc2cbdftv_20"), twinstr, &GENUS, { 131, 50, 12, 0 } };
+static const hc2c_desc desc = { 20, XSIMD_STRING("hc2cbdftv_20"), twinstr, &GENUS, { 131, 50, 12, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_20) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_20, &desc, HC2C_VIA_DFT);
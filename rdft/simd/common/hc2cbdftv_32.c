@@ -431,7 +431,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 32, XSIMD_STRING("hc2cbdftv_32"), twinstr, &GENUS, { 119, 62, 130, 0 } };
+static const hc2c_desc desc = { 32, XSIMD_STRING("hc2cbdftv_32"), twinstr, &GENUS, { 119, 62, 130, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_32) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_32, &desc, HC2C_VIA_DFT);
@@ -864,7 +864,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 32, XSIMD_STRING("hc2cbdftv_32"), twinstr, &GENUS, { 233, 88, 16, 0 } };
+static const hc2c_desc desc = { 32, XSIMD_STRING("hc2cbdftv_32"), twinstr, &GENUS, { 233, 88, 16, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_32) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_32, &desc, HC2C_VIA_DFT);
@@ -76,7 +76,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 4, XSIMD_STRING("hc2cbdftv_4"), twinstr, &GENUS, { 9, 6, 6, 0 } };
+static const hc2c_desc desc = { 4, XSIMD_STRING("hc2cbdftv_4"), twinstr, &GENUS, { 9, 6, 6, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_4) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_4, &desc, HC2C_VIA_DFT);
@@ -136,7 +136,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 4, XSIMD_STRING("hc2cbdftv_4"), twinstr, &GENUS, { 15, 6, 0, 0 } };
+static const hc2c_desc desc = { 4, XSIMD_STRING("hc2cbdftv_4"), twinstr, &GENUS, { 15, 6, 0, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_4) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_4, &desc, HC2C_VIA_DFT);
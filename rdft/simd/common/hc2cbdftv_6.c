@@ -99,7 +99,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 6, XSIMD_STRING("hc2cbdftv_6"), twinstr, &GENUS, { 17, 12, 12, 0 } };
+static const hc2c_desc desc = { 6, XSIMD_STRING("hc2cbdftv_6"), twinstr, &GENUS, { 17, 12, 12, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_6) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_6, &desc, HC2C_VIA_DFT);
@@ -183,7 +183,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 6, XSIMD_STRING("hc2cbdftv_6"), twinstr, &GENUS, { 27, 12, 2, 0 } };
+static const hc2c_desc desc = { 6, XSIMD_STRING("hc2cbdftv_6"), twinstr, &GENUS, { 27, 12, 2, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_6) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_6, &desc, HC2C_VIA_DFT);
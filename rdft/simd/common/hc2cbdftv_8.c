@@ -117,7 +117,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 8, XSIMD_STRING("hc2cbdftv_8"), twinstr, &GENUS, { 23, 14, 18, 0 } };
+static const hc2c_desc desc = { 8, XSIMD_STRING("hc2cbdftv_8"), twinstr, &GENUS, { 23, 14, 18, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_8) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_8, &desc, HC2C_VIA_DFT);
@@ -220,7 +220,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 8, XSIMD_STRING("hc2cbdftv_8"), twinstr, &GENUS, { 41, 16, 0, 0 } };
+static const hc2c_desc desc = { 8, XSIMD_STRING("hc2cbdftv_8"), twinstr, &GENUS, { 41, 16, 0, 0, 0 } };
 
 void XSIMD(codelet_hc2cbdftv_8) (planner *p) {
      X(khc2c_register) (p, hc2cbdftv_8, &desc, HC2C_VIA_DFT);
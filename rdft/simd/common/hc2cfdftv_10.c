@@ -151,7 +151,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 10, XSIMD_STRING("hc2cfdftv_10"), twinstr, &GENUS, { 33, 32, 28, 0 } };
+static const hc2c_desc desc = { 10, XSIMD_STRING("hc2cfdftv_10"), twinstr, &GENUS, { 33, 32, 28, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_10) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_10, &desc, HC2C_VIA_DFT);
@@ -289,7 +289,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 10, XSIMD_STRING("hc2cfdftv_10"), twinstr, &GENUS, { 55, 32, 6, 0 } };
+static const hc2c_desc desc = { 10, XSIMD_STRING("hc2cfdftv_10"), twinstr, &GENUS, { 55, 32, 6, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_10) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_10, &desc, HC2C_VIA_DFT);
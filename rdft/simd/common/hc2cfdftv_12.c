@@ -164,7 +164,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 12, XSIMD_STRING("hc2cfdftv_12"), twinstr, &GENUS, { 41, 36, 30, 0 } };
+static const hc2c_desc desc = { 12, XSIMD_STRING("hc2cfdftv_12"), twinstr, &GENUS, { 41, 36, 30, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_12) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_12, &desc, HC2C_VIA_DFT);
@@ -322,7 +322,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 12, XSIMD_STRING("hc2cfdftv_12"), twinstr, &GENUS, { 67, 37, 4, 0 } };
+static const hc2c_desc desc = { 12, XSIMD_STRING("hc2cfdftv_12"), twinstr, &GENUS, { 67, 37, 4, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_12) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_12, &desc, HC2C_VIA_DFT);
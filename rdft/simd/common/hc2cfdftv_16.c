@@ -216,7 +216,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 16, XSIMD_STRING("hc2cfdftv_16"), twinstr, &GENUS, { 53, 46, 50, 0 } };
+static const hc2c_desc desc = { 16, XSIMD_STRING("hc2cfdftv_16"), twinstr, &GENUS, { 53, 46, 50, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_16) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_16, &desc, HC2C_VIA_DFT);
@@ -424,7 +424,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 16, XSIMD_STRING("hc2cfdftv_16"), twinstr, &GENUS, { 99, 52, 4, 0 } };
+static const hc2c_desc desc = { 16, XSIMD_STRING("hc2cfdftv_16"), twinstr, &GENUS, { 99, 52, 4, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_16) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_16, &desc, HC2C_VIA_DFT);
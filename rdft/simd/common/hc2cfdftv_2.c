@@ -60,7 +60,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 2, XSIMD_STRING("hc2cfdftv_2"), twinstr, &GENUS, { 3, 4, 2, 0 } };
+static const hc2c_desc desc = { 2, XSIMD_STRING("hc2cfdftv_2"), twinstr, &GENUS, { 3, 4, 2, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_2) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_2, &desc, HC2C_VIA_DFT);
@@ -103,7 +103,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 2, XSIMD_STRING("hc2cfdftv_2"), twinstr, &GENUS, { 5, 4, 0, 0 } };
+static const hc2c_desc desc = { 2, XSIMD_STRING("hc2cfdftv_2"), twinstr, &GENUS, { 5, 4, 0, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_2) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_2, &desc, HC2C_VIA_DFT);
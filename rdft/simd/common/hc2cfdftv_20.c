@@ -273,7 +273,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 20, XSIMD_STRING("hc2cfdftv_20"), twinstr, &GENUS, { 77, 62, 66, 0 } };
+static const hc2c_desc desc = { 20, XSIMD_STRING("hc2cfdftv_20"), twinstr, &GENUS, { 77, 62, 66, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_20) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_20, &desc, HC2C_VIA_DFT);
@@ -543,7 +543,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 20, XSIMD_STRING("hc2cfdftv_20"), twinstr, &GENUS, { 131, 65, 12, 0 } };
+static const hc2c_desc desc = { 20, XSIMD_STRING("hc2cfdftv_20"), twinstr, &GENUS, { 131, 65, 12, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_20) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_20, &desc, HC2C_VIA_DFT);
@@ -432,7 +432,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 32, XSIMD_STRING("hc2cfdftv_32"), twinstr, &GENUS, { 119, 94, 130, 0 } };
+static const hc2c_desc desc = { 32, XSIMD_STRING("hc2cfdftv_32"), twinstr, &GENUS, { 119, 94, 130, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_32) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_32, &desc, HC2C_VIA_DFT);
@@ -870,7 +870,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 32, XSIMD_STRING("hc2cfdftv_32"), twinstr, &GENUS, { 233, 117, 16, 0 } };
+static const hc2c_desc desc = { 32, XSIMD_STRING("hc2cfdftv_32"), twinstr, &GENUS, { 233, 117, 16, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_32) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_32, &desc, HC2C_VIA_DFT);
@@ -77,7 +77,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 4, XSIMD_STRING("hc2cfdftv_4"), twinstr, &GENUS, { 9, 10, 6, 0 } };
+static const hc2c_desc desc = { 4, XSIMD_STRING("hc2cfdftv_4"), twinstr, &GENUS, { 9, 10, 6, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_4) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_4, &desc, HC2C_VIA_DFT);
@@ -138,7 +138,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 4, XSIMD_STRING("hc2cfdftv_4"), twinstr, &GENUS, { 15, 10, 0, 0 } };
+static const hc2c_desc desc = { 4, XSIMD_STRING("hc2cfdftv_4"), twinstr, &GENUS, { 15, 10, 0, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_4) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_4, &desc, HC2C_VIA_DFT);
@@ -118,7 +118,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 8, XSIMD_STRING("hc2cfdftv_8"), twinstr, &GENUS, { 23, 22, 18, 0 } };
+static const hc2c_desc desc = { 8, XSIMD_STRING("hc2cfdftv_8"), twinstr, &GENUS, { 23, 22, 18, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_8) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_8, &desc, HC2C_VIA_DFT);
@@ -223,7 +223,7 @@ static const tw_instr twinstr[] = {
      { TW_NEXT, VL, 0 }
 };
 
-static const hc2c_desc desc = { 8, XSIMD_STRING("hc2cfdftv_8"), twinstr, &GENUS, { 41, 23, 0, 0 } };
+static const hc2c_desc desc = { 8, XSIMD_STRING("hc2cfdftv_8"), twinstr, &GENUS, { 41, 23, 0, 0, 0 } };
 
 void XSIMD(codelet_hc2cfdftv_8) (planner *p) {
      X(khc2c_register) (p, hc2cfdftv_8, &desc, HC2C_VIA_DFT);
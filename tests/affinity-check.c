@@ -0,0 +1,129 @@
+/*
+ * Worker affinity check.
+ *
+ * usage: affinity-check [nthreads]
+ *
+ * Binds the workers of the threads library to the cpus that the
+ * process may run on, with fftw_threads_set_affinity.  Checks that
+ *   - the worker that runs block i of a loop (X(spawn_loop)) runs on
+ *     the i-th of these cpus, modulo their number, at every loop,
+ *   - fftw_threads_node_cpus lists the cpus of node 0, where the
+ *     system tells.
+ * Then executes a 2d and a 3d transform on NTHREADS threads (default
+ * 4) with free and with bound workers, and prints the mean time and
+ * its coefficient of variation for information.
+ */
+
+#ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+#endif
+#include <math.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/api.h"
+#include "threads/threads.h"
+#include "tests/check.h"
+
+#define MAXTHR 64
+#define NLOOPS 100
+#define NREP 40
+
+static int block_cpu[MAXTHR];
+
+static void *where(spawn_data *d)
+{
+     block_cpu[d->thr_num] = sched_getcpu();
+     return 0;
+}
+
+/* mean seconds per execute of P, and its coefficient of variation */
+static void time_plan(fftw_plan p, double *mean, double *cv)
+{
+     double t[NREP], s = 0, s2 = 0;
+     int r;
+
+     fftw_execute(p); /* wake the workers, and move them */
+     for (r = 0; r < NREP; ++r) {
+	  double t0 = check_now();
+	  fftw_execute(p);
+	  t[r] = check_now() - t0;
+	  s += t[r];
+     }
+     *mean = s / NREP;
+     for (r = 0; r < NREP; ++r)
+	  s2 += (t[r] - *mean) * (t[r] - *mean);
+     *cv = sqrt(s2 / NREP) / *mean;
+}
+
+int main(int argc, char *argv[])
+{
+     static const int dims[2][3] = { { 512, 512, 1 }, { 64, 64, 64 } };
+     int cpus[MAXTHR], ncpus = 0, node_cpus[MAXTHR];
+     int nthreads = 4, cpu, i, k, l;
+     cpu_set_t allowed;
+
+     if (argc > 1)
+	  nthreads = atoi(argv[1]);
+     if (nthreads < 2 || nthreads > MAXTHR)
+	  nthreads = 4;
+
+     if (!fftw_init_threads()) {
+	  printf("threads not available\n");
+	  return 0;
+     }
+     if (sched_getaffinity(0, sizeof(allowed), &allowed)) {
+	  printf("no affinity\n");
+	  return 0;
+     }
+     for (cpu = 0; cpu < CPU_SETSIZE && ncpus < MAXTHR; ++cpu)
+	  if (CPU_ISSET(cpu, &allowed))
+	       cpus[ncpus++] = cpu;
+
+     k = fftw_threads_node_cpus(0, node_cpus, MAXTHR);
+     for (i = 0; i < k && i < MAXTHR; ++i)
+	  if (node_cpus[i] < 0 || node_cpus[i] >= CPU_SETSIZE)
+	       check_fail("bad cpu of node 0 (%d)", node_cpus[i]);
+     printf("node 0 has %d cpus\n", k);
+
+     fftw_threads_set_affinity(cpus, ncpus);
+     for (l = 0; l < NLOOPS; ++l) {
+	  fftw_spawn_loop(nthreads, nthreads, where, 0);
+	  for (i = 0; i < nthreads - 1; ++i)
+	       if (block_cpu[i] != cpus[i % ncpus]) {
+		    check_fail("block on the wrong cpu (%d)", i);
+		    l = NLOOPS;
+		    break;
+	       }
+     }
+
+     printf("us per execute on %d threads (coefficient of variation): "
+	    "free workers, bound workers\n", nthreads);
+     fftw_plan_with_nthreads(nthreads);
+     for (k = 0; k < 2; ++k) {
+	  int rank = dims[k][2] > 1 ? 3 : 2;
+	  int n = dims[k][0] * dims[k][1] * dims[k][2];
+	  fftw_complex *a = fftw_alloc_complex(n);
+	  fftw_plan p = fftw_plan_dft(rank, dims[k], a, a, FFTW_FORWARD,
+				      FFTW_ESTIMATE);
+	  double mfree, cvfree, mbound, cvbound;
+
+	  memset(a, 0, sizeof(fftw_complex) * n);
+	  fftw_threads_set_affinity(0, 0);
+	  time_plan(p, &mfree, &cvfree);
+	  fftw_threads_set_affinity(cpus, ncpus);
+	  time_plan(p, &mbound, &cvbound);
+	  printf("%dx%d%s%s: %.4g (%.2g), %.4g (%.2g)\n",
+		 dims[k][0], dims[k][1], rank == 3 ? "x" : "",
+		 rank == 3 ? "64" : "", mfree * 1e6, cvfree,
+		 mbound * 1e6, cvbound);
+	  fftw_destroy_plan(p);
+	  fftw_free(a);
+     }
+
+     fftw_cleanup_threads();
+
+     return check_exit();
+}
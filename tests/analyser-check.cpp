@@ -0,0 +1,98 @@
+// Ʈ м ˻ (PortAudio  analyserPush  )
+//
+// : analyser-check
+//
+// 48 kHz ׷ ( 1 kHz -6 dBFS,  3 kHz -20 dBFS)  ݹ ũ
+//  ְ
+// -  ֱ  ִ /ũ/ ´
+// - м  CPU ð   1% ̸ (ٸ μ
+//   ھ  ᵵ  ʵ ð谡 ƴ  CPU ð)
+// Ȯ (4096  FFT, 75% ħ)
+
+#include "libbench2/analyser.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+constexpr double RATE = 48000.0;
+constexpr int BLOCK = 256;
+constexpr double SECONDS = 10.0;
+constexpr double CPU_BUDGET = 0.01;
+
+struct Tone {
+    double freq;
+    double amp;
+};
+
+static const Tone tones[ANALYSER_CHANNELS] = {
+    { 1000.0, 0.5 },    // -6 dBFS
+    { 3000.0, 0.1 },    // -20 dBFS
+};
+
+static bool near(const char* what, double got, double want, double tol) {
+    bool ok = fabs(got - want) <= tol;
+    printf("%-20s %9.2f (expected %9.2f +- %.2f)  %s\n", what, got, want, tol, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main() {
+    AnalyserConfig cfg = defaultAnalyserConfig();
+    if (!analyserStart(cfg, RATE)) {
+        fprintf(stderr, "analyserStart failed\n");
+        return 1;
+    }
+
+    std::vector<float> block(BLOCK * ANALYSER_CHANNELS);
+    long total = (long)(SECONDS * RATE);
+    for (long pos = 0; pos < total; pos += BLOCK) {
+        for (int i = 0; i < BLOCK; ++i)
+            for (int c = 0; c < ANALYSER_CHANNELS; ++c)
+                block[i * ANALYSER_CHANNELS + c] =
+                    (float)(tones[c].amp * sin(2.0 * M_PI * tones[c].freq * (pos + i) / RATE));
+        analyserPush(block.data(), BLOCK);
+
+        //  ݹ   м 尡  ŭ ռ 
+        while (analyserStats().framesAnalysed * cfg.hop + 4 * cfg.batch * cfg.hop
+               < (unsigned long)pos)
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    while (analyserStats().framesAnalysed * cfg.hop + cfg.batch * cfg.hop <= (unsigned long)total)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    const SpectrumFrame& f = analyserLatest();
+    AnalyserStats s = analyserStats();
+    analyserStop();
+
+    bool ok = f.seq > 0 && s.samplesDropped == 0;
+    printf("frames %lu, dropped %lu, last seq %lu at %.3f s\n",
+        s.framesAnalysed, s.samplesDropped, f.seq, f.time);
+
+    int bins = cfg.fftSize / 2 + 1;
+    for (int c = 0; c < ANALYSER_CHANNELS; ++c) {
+        int peak = 0;
+        for (int k = 1; k < bins; ++k)
+            if (f.magDb[c][k] > f.magDb[c][peak]) peak = k;
+
+        double wantBin = tones[c].freq * cfg.fftSize / RATE;
+        double wantDb = 20.0 * log10(tones[c].amp);
+        printf("channel %d\n", c);
+        ok = near("  peak bin", peak, wantBin, 1.0) && ok;
+        ok = near("  peak dB", f.magDb[c][peak], wantDb, 1.5) && ok;
+        ok = near("  rms dB", f.rmsDb[c], wantDb - 3.0103, 0.1) && ok;
+        ok = near("  sample peak dB", f.peakDb[c], wantDb, 0.1) && ok;
+    }
+
+    double load = s.busySeconds / SECONDS;
+    printf("analysis cpu %.4f%% of one core (budget %.2f%%)  %s\n",
+        load * 100.0, CPU_BUDGET * 100.0, load < CPU_BUDGET ? "ok" : "FAIL");
+    ok = ok && load < CPU_BUDGET;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+/*
+ * Asynchronous execution check.
+ *
+ * usage: async-check [nthreads]
+ *
+ * Submits NREQ r2c transforms of separately allocated buffers,
+ * interleaved with as many complex DFTs of another plan, from plans
+ * for NTHREADS threads (default 1).  Checks that
+ *   - each computes exactly what fftw_execute_dft_r2c and
+ *     fftw_execute_dft do,
+ *   - the callback of each request has run, once, when
+ *     fftw_request_wait returns, and fftw_request_test tells it too,
+ *   - fftw_execute_async transforms the arrays of the plan.
+ * The time to transform the r2c buffers one call after another, and
+ * by submitting all of them and then waiting, is printed for
+ * information.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/fftw3.h"
+#include "tests/check.h"
+
+#define N 1024
+#define NC (N / 2 + 1)
+#define NREQ 200
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static int ncalls[2 * NREQ];
+
+static void done(void *arg)
+{
+     pthread_mutex_lock(&lock);
+     ++ncalls[(int) (size_t) arg];
+     pthread_mutex_unlock(&lock);
+}
+
+static int calls(int i)
+{
+     int n;
+     pthread_mutex_lock(&lock);
+     n = ncalls[i];
+     pthread_mutex_unlock(&lock);
+     return n;
+}
+
+static double *rin[NREQ];
+static fftw_complex *cin[NREQ], *rout[NREQ], *cout[NREQ], *ref[NREQ];
+
+int main(int argc, char *argv[])
+{
+     fftw_plan pr, pc;
+     fftw_request req[2 * NREQ];
+     double t1, ta;
+     int nthreads = 1, c, i, polls;
+
+     if (argc > 1)
+	  nthreads = atoi(argv[1]);
+
+     if (!fftw_init_threads()) {
+	  printf("threads not available\n");
+	  return 0;
+     }
+     fftw_plan_with_nthreads(nthreads);
+
+     for (c = 0; c < NREQ; ++c) {
+	  rin[c] = fftw_alloc_real(N);
+	  cin[c] = fftw_alloc_complex(N);
+	  rout[c] = fftw_alloc_complex(NC);
+	  cout[c] = fftw_alloc_complex(N);
+	  ref[c] = fftw_alloc_complex(N);
+	  for (i = 0; i < N; ++i) {
+	       rin[c][i] = (double) ((c * 31 + i * 7) % 23) - 11.0;
+	       cin[c][i][0] = (double) ((c * 5 + i * 3) % 17);
+	       cin[c][i][1] = (double) ((c + i) % 5);
+	  }
+     }
+     pr = fftw_plan_dft_r2c_1d(N, rin[0], rout[0], FFTW_ESTIMATE);
+     pc = fftw_plan_dft_1d(N, cin[0], cout[0], FFTW_FORWARD, FFTW_ESTIMATE);
+
+     /* interleaved, so that the queue holds both plans */
+     for (c = 0; c < NREQ; ++c) {
+	  req[2 * c] = fftw_execute_dft_r2c_async(pr, rin[c], rout[c], done,
+						  (void *) (size_t) (2 * c));
+	  req[2 * c + 1] = fftw_execute_dft_async(pc, cin[c], cout[c], done,
+						  (void *) (size_t) (2 * c + 1));
+     }
+     for (polls = 0; !fftw_request_test(req[2 * NREQ - 1]); ++polls)
+	  ;
+     if (calls(2 * NREQ - 1) != 1)
+	  check_fail("request done before its callback");
+     for (i = 0; i < 2 * NREQ; ++i) {
+	  fftw_request_wait(req[i]);
+	  if (calls(i) != 1)
+	       check_fail("callback not run once by the wait");
+     }
+
+     for (c = 0; c < NREQ; ++c) {
+	  fftw_execute_dft_r2c(pr, rin[c], ref[c]);
+	  if (memcmp(ref[c], rout[c], sizeof(fftw_complex) * NC))
+	       break;
+	  fftw_execute_dft(pc, cin[c], ref[c]);
+	  if (memcmp(ref[c], cout[c], sizeof(fftw_complex) * N))
+	       break;
+     }
+     if (c < NREQ)
+	  check_fail("async transform differs");
+
+     /* the plan's own arrays */
+     memset(cout[0], 0, sizeof(fftw_complex) * N);
+     req[0] = fftw_execute_async(pc, 0, 0);
+     fftw_request_wait(req[0]);
+     fftw_execute_dft(pc, cin[0], ref[0]);
+     if (memcmp(ref[0], cout[0], sizeof(fftw_complex) * N))
+	  check_fail("fftw_execute_async");
+
+     t1 = check_now();
+     for (c = 0; c < NREQ; ++c)
+	  fftw_execute_dft_r2c(pr, rin[c], rout[c]);
+     t1 = check_now() - t1;
+     ta = check_now();
+     for (c = 0; c < NREQ; ++c)
+	  req[c] = fftw_execute_dft_r2c_async(pr, rin[c], rout[c], 0, 0);
+     for (c = 0; c < NREQ; ++c)
+	  fftw_request_wait(req[c]);
+     ta = check_now() - ta;
+     printf("%d r2c of %d, %d-thread plan, polled %d times, us: "
+	    "one call each %.3g, submitted %.3g\n",
+	    NREQ, N, nthreads, polls, t1 * 1e6, ta * 1e6);
+
+     fftw_destroy_plan(pr);
+     fftw_destroy_plan(pc);
+     for (c = 0; c < NREQ; ++c) {
+	  fftw_free(rin[c]);
+	  fftw_free(cin[c]);
+	  fftw_free(rout[c]);
+	  fftw_free(cout[c]);
+	  fftw_free(ref[c]);
+     }
+     fftw_cleanup_threads();
+
+     return check_exit();
+}
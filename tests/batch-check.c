@@ -0,0 +1,157 @@
+/*
+ * Batched execution check.
+ *
+ * usage: batch-check [nthreads]
+ *
+ * Runs one plan of each kind (complex DFT, r2c, c2r and r2r) over
+ * NCHAN separately allocated buffers, as an audio pipeline does with
+ * its channels, and checks that fftw_execute_*_batch computes exactly
+ * what one new-array execute call per buffer does, on NTHREADS threads
+ * (default 4) if the threads library is used, and that a batch of none
+ * touches nothing.  The time per block of channels of the r2c calls,
+ * one by one and batched, is printed for information.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/fftw3.h"
+#include "tests/check.h"
+
+#define N 512
+#define NC (N / 2 + 1)
+#define NCHAN 200
+#define NREP 50
+
+static double *rin[NCHAN], *rout[NCHAN], *rref[NCHAN];
+static fftw_complex *cin[NCHAN], *cout[NCHAN], *cref[NCHAN];
+
+static void fill(void)
+{
+     int c, i;
+
+     for (c = 0; c < NCHAN; ++c)
+	  for (i = 0; i < N; ++i) {
+	       rin[c][i] = (double) ((c * 31 + i * 7) % 23) - 11.0;
+	       cin[c][i][0] = rin[c][i];
+	       cin[c][i][1] = (double) ((c + i) % 5);
+	  }
+}
+
+static void same(const char *what, size_t bytes, int complex_out)
+{
+     int c;
+
+     for (c = 0; c < NCHAN; ++c)
+	  if (complex_out ? memcmp(cout[c], cref[c], bytes)
+	      : memcmp(rout[c], rref[c], bytes))
+	       break;
+     if (c < NCHAN)
+	  check_fail("%s", what);
+}
+
+int main(int argc, char *argv[])
+{
+     fftw_plan p;
+     fftw_r2r_kind kind = FFTW_REDFT10;
+     double t1, tb;
+     int nthreads = 4, c, r;
+     double t0;
+
+     if (argc > 1)
+	  nthreads = atoi(argv[1]);
+#ifdef USE_THREADS
+     if (!fftw_init_threads()) {
+	  check_fail("fftw_init_threads");
+	  return 1;
+     }
+     fftw_plan_with_nthreads(nthreads);
+#else
+     nthreads = 1;
+#endif
+
+     /* scattered: each buffer on its own, with others in between */
+     for (c = 0; c < NCHAN; ++c) {
+	  rin[c] = fftw_alloc_real(N);
+	  rout[c] = fftw_alloc_real(N);
+	  rref[c] = fftw_alloc_real(N);
+	  cin[c] = fftw_alloc_complex(N);
+	  cout[c] = fftw_alloc_complex(N);
+	  cref[c] = fftw_alloc_complex(N);
+     }
+
+     /* complex DFT */
+     fill();
+     p = fftw_plan_dft_1d(N, cin[0], cout[0], FFTW_FORWARD, FFTW_ESTIMATE);
+     for (c = 0; c < NCHAN; ++c)
+	  fftw_execute_dft(p, cin[c], cref[c]);
+     fftw_execute_dft_batch(p, NCHAN, cin, cout);
+     same("dft batch", sizeof(fftw_complex) * N, 1);
+     fftw_destroy_plan(p);
+
+     /* r2c, which is also timed */
+     fill();
+     p = fftw_plan_dft_r2c_1d(N, rin[0], cout[0], FFTW_ESTIMATE);
+     for (c = 0; c < NCHAN; ++c)
+	  fftw_execute_dft_r2c(p, rin[c], cref[c]);
+     fftw_execute_dft_r2c_batch(p, NCHAN, rin, cout);
+     same("r2c batch", sizeof(fftw_complex) * NC, 1);
+     memset(cout[0], 0, sizeof(fftw_complex) * NC);
+     fftw_execute_dft_r2c_batch(p, 0, rin, cout);
+     for (c = 0; c < NC; ++c)
+	  if (cout[0][c][0] != 0 || cout[0][c][1] != 0)
+	       break;
+     if (c < NC)
+	  check_fail("empty batch");
+
+     t0 = check_now();
+     for (r = 0; r < NREP; ++r)
+	  for (c = 0; c < NCHAN; ++c)
+	       fftw_execute_dft_r2c(p, rin[c], cout[c]);
+     t1 = (check_now() - t0) / NREP;
+     t0 = check_now();
+     for (r = 0; r < NREP; ++r)
+	  fftw_execute_dft_r2c_batch(p, NCHAN, rin, cout);
+     tb = (check_now() - t0) / NREP;
+     fftw_destroy_plan(p);
+
+     /* c2r, which destroys its input: transform copies of it */
+     p = fftw_plan_dft_c2r_1d(N, cin[0], rout[0], FFTW_ESTIMATE);
+     for (c = 0; c < NCHAN; ++c) {
+	  memcpy(cout[c], cref[c], sizeof(fftw_complex) * NC);
+	  fftw_execute_dft_c2r(p, cout[c], rref[c]);
+	  memcpy(cout[c], cref[c], sizeof(fftw_complex) * NC);
+     }
+     fftw_execute_dft_c2r_batch(p, NCHAN, cout, rout);
+     same("c2r batch", sizeof(double) * N, 0);
+     fftw_destroy_plan(p);
+
+     /* r2r */
+     fill();
+     p = fftw_plan_r2r_1d(N, rin[0], rout[0], kind, FFTW_ESTIMATE);
+     for (c = 0; c < NCHAN; ++c)
+	  fftw_execute_r2r(p, rin[c], rref[c]);
+     fftw_execute_r2r_batch(p, NCHAN, rin, rout);
+     same("r2r batch", sizeof(double) * N, 0);
+     fftw_destroy_plan(p);
+
+     printf("%d r2c of %d on %d threads, ms per block: one call each "
+	    "%.3g, batched %.3g\n", NCHAN, N, nthreads, t1 * 1e3, tb * 1e3);
+
+     for (c = 0; c < NCHAN; ++c) {
+	  fftw_free(rin[c]);
+	  fftw_free(rout[c]);
+	  fftw_free(rref[c]);
+	  fftw_free(cin[c]);
+	  fftw_free(cout[c]);
+	  fftw_free(cref[c]);
+     }
+#ifdef USE_THREADS
+     fftw_cleanup_threads();
+#else
+     fftw_cleanup();
+#endif
+
+     return check_exit();
+}
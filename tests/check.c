@@ -0,0 +1,47 @@
+/* subroutines shared by the *-check programs: each checks one feature,
+   reports what is wrong through check_fail() and ends with
+   "return check_exit();". */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "check.h"
+
+int check_failures = 0;
+
+void check_fail(const char *fmt, ...)
+{
+     char msg[256];
+     va_list ap;
+
+     va_start(ap, fmt);
+     vsnprintf(msg, sizeof(msg), fmt, ap);
+     va_end(ap);
+
+     /* one stdio call, so that messages of several threads do not
+	interleave */
+     printf("FAIL: %s\n", msg);
+#ifdef __GNUC__
+     __sync_fetch_and_add(&check_failures, 1);
+#else
+     ++check_failures;
+#endif
+}
+
+double check_now(void)
+{
+#if defined(CLOCK_MONOTONIC)
+     struct timespec t;
+     clock_gettime(CLOCK_MONOTONIC, &t);
+     return (double) t.tv_sec + 1.0e-9 * (double) t.tv_nsec;
+#else
+     return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+int check_exit(void)
+{
+     printf("%s\n", check_failures ? "FAIL" : "ok");
+     return check_failures ? 1 : 0;
+}
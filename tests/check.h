@@ -0,0 +1,27 @@
+/* declarations of the subroutines shared by the *-check programs
+   (see check.c). */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+extern int check_failures;
+
+/* print "FAIL: " and the printf-style message, count a failure; safe
+   to call from any thread */
+void check_fail(const char *fmt, ...)
+#ifdef __GNUC__
+     __attribute__((format(printf, 1, 2)))
+#endif
+     ;
+
+/* wall-clock seconds since some fixed time */
+double check_now(void);
+
+/* print the verdict, return the exit status of main() */
+int check_exit(void);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif /* __cplusplus */
@@ -0,0 +1,229 @@
+/*
+ * Calibrated FFTW_ESTIMATE check.
+ *
+ * usage: cost-model-check [directory]
+ *
+ * Records the plans that FFTW_MEASURE times for a set of training
+ * sizes, fits a cost model to them in DIRECTORY (default: the current
+ * one), records those of a set of held-out sizes as well, and checks that
+ *   - the model predicts the own times of the held-out plans better
+ *     than the operation count does (median relative error),
+ *   - it imports, and FFTW_ESTIMATE plans of the held-out sizes compute
+ *     the right DFT while it is in use,
+ *   - a model file that is not one, or is cut short, is refused and
+ *     leaves the model in use alone,
+ *   - fftw_import_cost_model_from_filename(NULL) drops the model.
+ * The execution times of the FFTW_ESTIMATE plans, with and without the
+ * model, relative to FFTW_MEASURE plans are printed for information.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/api.h"
+#include "tests/check.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static const int train[] = { 12, 16, 20, 30, 32, 48, 64, 80, 100, 128, 144,
+			     200, 256, 320, 400, 512, 640, 1000, 1024, 2048 };
+static const int heldout[] = { 18, 24, 40, 60, 96, 120, 160, 240, 300,
+			       384, 480, 768, 800, 1200, 1536 };
+#define NTRAIN ((int)(sizeof(train) / sizeof(train[0])))
+#define NHELDOUT ((int)(sizeof(heldout) / sizeof(heldout[0])))
+
+static char dir[1024] = ".";
+
+static const char *path(const char *name)
+{
+     static char buf[1100];
+     sprintf(buf, "%s/%s", dir, name);
+     return buf;
+}
+
+/* plan n with FLAGS, check it against a naive DFT of random data and
+   return the time of one execution (0 on failure) */
+static double check_size(int n, unsigned flags)
+{
+     fftw_complex *in = fftw_alloc_complex(n), *out = fftw_alloc_complex(n);
+     fftw_plan p = fftw_plan_dft_1d(n, in, out, FFTW_FORWARD, flags);
+     double err = 0.0, mag = 0.0, t = 0.0;
+     unsigned seed = (unsigned)n;
+     int i, k, iter;
+
+     if (!p) {
+	  check_fail("no plan (n = %d)", n);
+	  goto done;
+     }
+
+     for (i = 0; i < n; ++i) {
+	  seed = seed * 1103515245u + 12345u;
+	  in[i][0] = (double)(seed >> 8) / (1 << 24) - 0.5;
+	  seed = seed * 1103515245u + 12345u;
+	  in[i][1] = (double)(seed >> 8) / (1 << 24) - 0.5;
+     }
+     fftw_execute(p);
+
+     for (k = 0; k < n; ++k) {
+	  double re = 0.0, im = 0.0;
+	  for (i = 0; i < n; ++i) {
+	       double a = -2.0 * M_PI * (double)((long)i * k % n) / n;
+	       re += in[i][0] * cos(a) - in[i][1] * sin(a);
+	       im += in[i][0] * sin(a) + in[i][1] * cos(a);
+	  }
+	  err += (out[k][0] - re) * (out[k][0] - re)
+	       + (out[k][1] - im) * (out[k][1] - im);
+	  mag += re * re + im * im;
+     }
+     if (sqrt(err / mag) > 1e-12) {
+	  check_fail("wrong result (n = %d)", n);
+	  goto destroy;
+     }
+
+     /* best of a few batches of about a million points each */
+     iter = 1 + 1000000 / n;
+     for (k = 0; k < 5; ++k) {
+	  double t0 = check_now();
+	  double t1;
+	  for (i = 0; i < iter; ++i)
+	       fftw_execute(p);
+	  t1 = (check_now() - t0) / iter;
+	  if (k == 0 || t1 < t)
+	       t = t1;
+     }
+
+ destroy:
+     fftw_destroy_plan(p);
+ done:
+     fftw_free(in);
+     fftw_free(out);
+     return t;
+}
+
+/* geometric mean over the held-out sizes of the time of FLAGS plans
+   relative to MEASURE ones */
+static double relative_time(unsigned flags, const double *tmeasure)
+{
+     double s = 0.0;
+     int j;
+
+     for (j = 0; j < NHELDOUT; ++j) {
+	  double t = check_size(heldout[j], flags);
+	  if (t > 0 && tmeasure[j] > 0)
+	       s += log(t / tmeasure[j]);
+     }
+     return exp(s / NHELDOUT);
+}
+
+static void write_file(const char *name, const char *contents)
+{
+     FILE *f = fopen(path(name), "w");
+     if (f) {
+	  fputs(contents, f);
+	  fclose(f);
+     }
+}
+
+/* copy the first two lines (preamble and weights) of a model */
+static void truncate_model(const char *from, const char *to)
+{
+     char buf[2048] = "";
+     size_t len = 0;
+     int lines = 0;
+     FILE *f = fopen(from, "r");
+
+     if (f) {
+	  while (lines < 2 && fgets(buf + len, (int)(sizeof(buf) - len), f)) {
+	       len = strlen(buf);
+	       ++lines;
+	  }
+	  fclose(f);
+     }
+     write_file(to, buf);
+}
+
+int main(int argc, char *argv[])
+{
+     double tmeasure[NHELDOUT], plain, fitted, model_err = 0, opcnt_err = 0;
+     char log_name[1100], heldout_name[1100], model_name[1100];
+     int j;
+
+     if (argc > 1)
+	  strncpy(dir, argv[1], sizeof(dir) - 1);
+     strcpy(log_name, path("cost-model-check.log"));
+     strcpy(heldout_name, path("cost-model-check.heldout"));
+     strcpy(model_name, path("cost-model-check.model"));
+     remove(log_name); /* the logs are appended to */
+     remove(heldout_name);
+
+     if (!fftw_record_measurements_to_filename(log_name)) {
+	  check_fail("cannot record measurements");
+	  return 1;
+     }
+     for (j = 0; j < NTRAIN; ++j)
+	  check_size(train[j], FFTW_MEASURE);
+     fftw_record_measurements_to_filename(0);
+
+     if (!fftw_fit_cost_model(log_name, model_name))
+	  check_fail("cannot fit a cost model");
+     if (fftw_fit_cost_model(path("no-such-log"), model_name))
+	  check_fail("fitted a model to a missing log");
+
+     /* the reference: MEASURE plans of the held-out sizes */
+     fftw_forget_wisdom();
+     if (!fftw_record_measurements_to_filename(heldout_name))
+	  check_fail("cannot record measurements");
+     for (j = 0; j < NHELDOUT; ++j)
+	  tmeasure[j] = check_size(heldout[j], FFTW_MEASURE);
+     fftw_record_measurements_to_filename(0);
+
+     if (!fftw_cost_model_error(model_name, heldout_name,
+				&model_err, &opcnt_err))
+	  check_fail("cannot check the model against the held-out sizes");
+     else if (!(model_err < opcnt_err))
+	  check_fail("held-out own times are off by %.1f%% with the model, "
+		     "%.1f%% by the operation count", 100.0 * model_err,
+		     100.0 * opcnt_err);
+
+     fftw_forget_wisdom();
+     plain = relative_time(FFTW_ESTIMATE, tmeasure);
+
+     if (!fftw_import_cost_model_from_filename(model_name))
+	  check_fail("the fitted model does not import");
+     fftw_forget_wisdom();
+     fitted = relative_time(FFTW_ESTIMATE, tmeasure);
+
+     /* bad models are refused and keep the good one */
+     write_file("cost-model-check.bad", "(fftw-3.3.10 fftw_wisdom\n)\n");
+     if (fftw_import_cost_model_from_filename(path("cost-model-check.bad")))
+	  check_fail("imported wisdom as a cost model");
+     truncate_model(model_name, "cost-model-check.bad");
+     if (fftw_import_cost_model_from_filename(path("cost-model-check.bad")))
+	  check_fail("imported a truncated cost model");
+     fftw_forget_wisdom();
+     for (j = 0; j < NHELDOUT; ++j)
+	  if (check_size(heldout[j], FFTW_ESTIMATE) <= 0)
+	       check_fail("ESTIMATE plan after a refused model (n = %d)",
+			  heldout[j]);
+
+     if (!fftw_import_cost_model_from_filename(0))
+	  check_fail("cannot drop the cost model");
+
+     printf("held-out own times off by %.1f%% with the cost model, "
+	    "%.1f%% by the operation count\n", 100.0 * model_err,
+	    100.0 * opcnt_err);
+     printf("ESTIMATE plans relative to MEASURE ones: %.3f plain, "
+	    "%.3f with the cost model\n", plain, fitted);
+
+     remove(log_name);
+     remove(heldout_name);
+     remove(model_name);
+     remove(path("cost-model-check.bad"));
+     fftw_cleanup();
+
+     return check_exit();
+}
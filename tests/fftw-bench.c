@@ -33,6 +33,7 @@ int paranoid = 0;
 int usewisdom = 0;
 int havewisdom = 0;
 int nthreads = 1;
+int measure_threads = 1;
 int amnesia = 0;
 
 extern void install_hook(void);  /* in hook.c */
@@ -103,9 +104,13 @@ void useropt(const char *arg)
           fprintf(stderr, "Serial FFTW; ignoring threads_callback option.\n");
 #endif
      else if (sscanf(arg, "nthreads=%d", &x) == 1) nthreads = x;
+     else if (sscanf(arg, "measure_threads=%d", &x) == 1) measure_threads = x;
 #ifdef FFTW_RANDOM_ESTIMATOR
      else if (sscanf(arg, "eseed=%d", &x) == 1) FFTW(random_estimate_seed) = x;
 #endif
+     else if (!strcmp(arg, "robust_timing")) FFTW(set_robust_timing)(1);
+     else if (!strcmp(arg, "robust_timing_pinned"))
+	  FFTW(set_robust_timing)(2);
      else if (sscanf(arg, "timelimit=%lg", &y) == 1) {
 	  FFTW(set_timelimit)(y);
      }
@@ -126,6 +131,7 @@ void rdwisdom(void)
 	  BENCH_ASSERT(FFTW(init_threads)());
 	  FFTW(plan_with_nthreads)(nthreads);
 	  BENCH_ASSERT(FFTW(planner_nthreads)() == nthreads);
+	  FFTW(plan_with_measure_threads)(measure_threads);
           FFTW(make_planner_thread_safe)();
 #ifdef _OPENMP
 	  omp_set_num_threads(nthreads);
@@ -215,12 +215,16 @@ static void hook(planner *plnr, plan *pln, const problem *p_, int optimalp)
 	       the_plan = (apiplan *) MALLOC(sizeof(apiplan), PLANS);
 	       the_plan->pln = pln;
 	       the_plan->prb = (problem *) p_;
+	       the_plan->pool = 0;
+	       the_plan->nthr = 1;
+	       the_plan->ws.base = 0;
+	       the_plan->ws_own = 0;
 
 	       X(plan_awake)(pln, AWAKE_SQRTN_TABLE);
 	       verify_problem(bp, rounds, tol);
 	       X(plan_awake)(pln, SLEEPY);
 
-	       X(ifree)(the_plan);
+	       X(arena_ifree)(the_plan);
 	       the_plan = the_plan_save;
 
 	       problem_destroy(bp);
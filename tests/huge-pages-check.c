@@ -0,0 +1,177 @@
+/*
+ * Huge page check.
+ *
+ * usage: huge-pages-check [nthreads]
+ *
+ * Transforms a large 1d DFT on arrays from fftw_malloc and from
+ * fftw_malloc_huge, with and without FFTW_HUGE_PAGES.  Checks that
+ *   - fftw_malloc_huge returns aligned, writable memory of any size,
+ *     freed by fftw_free,
+ *   - with threads, it comes zeroed (by the first-touch threads),
+ *   - every combination computes the right transform, and the same
+ *     one (the flag changes where tables live, not the algorithm).
+ * How much of the arrays and tables is on transparent huge pages, where
+ * the system tells (Linux), and the time per transform of each
+ * combination are printed for information.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/fftw3.h"
+#include "tests/check.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define N 1500000		/* its ESTIMATE plan has 4MB of twiddles */
+#define NREP 8
+
+/* kB of the process on transparent huge pages, or -1 if unknown */
+static long huge_kb(void)
+{
+     FILE *f = fopen("/proc/self/smaps_rollup", "r");
+     char line[256];
+     long kb = -1;
+
+     if (!f)
+	  return -1;
+     while (fgets(line, sizeof(line), f))
+	  if (!strncmp(line, "AnonHugePages:", 14))
+	       kb = atol(line + 14);
+     fclose(f);
+     return kb;
+}
+
+/* the DFT of a unit impulse at 1 is exp(-2 pi i k / N) */
+static double impulse_error(const fftw_complex *out)
+{
+     double err = 0.0;
+     int k;
+
+     for (k = 0; k < N; ++k) {
+	  double a = -2.0 * M_PI * (double)k / N;
+	  double dr = out[k][0] - cos(a), di = out[k][1] - sin(a);
+	  double e = dr * dr + di * di;
+	  if (e > err)
+	       err = e;
+     }
+     return sqrt(err);
+}
+
+/* plan, check and time one combination; leaves its output in OUT */
+static double run(fftw_complex *in, fftw_complex *out, unsigned flags,
+		  const char *what)
+{
+     long kb = huge_kb();
+     fftw_plan p = fftw_plan_dft_1d(N, in, out, FFTW_FORWARD,
+				    FFTW_ESTIMATE | flags);
+     double t;
+     double t0;
+     int r;
+
+     if (kb >= 0 && (flags & FFTW_HUGE_PAGES))
+	  printf("huge tables: %ld kB of the plan on huge pages\n",
+		 huge_kb() - kb);
+
+     if (!p) {
+	  check_fail("no plan");
+	  return 0;
+     }
+
+     memset(in, 0, sizeof(fftw_complex) * N);
+     in[1][0] = 1.0;
+     fftw_execute(p);
+     if (impulse_error(out) > 1e-12)
+	  check_fail("%s", what);
+
+     t0 = check_now();
+     for (r = 0; r < NREP; ++r)
+	  fftw_execute(p);
+     t = (check_now() - t0) / NREP;
+     fftw_destroy_plan(p);
+     return t;
+}
+
+int main(int argc, char *argv[])
+{
+     fftw_complex *in, *out, *hin, *hout, *ref;
+     double t_plain, t_arrays, t_all;
+     long kb0 = huge_kb(), kb1;
+     int nthreads = 2, i;
+     char *small;
+
+     if (argc > 1)
+	  nthreads = atoi(argv[1]);
+#ifdef USE_THREADS
+     if (!fftw_init_threads()) {
+	  check_fail("fftw_init_threads");
+	  return 1;
+     }
+     fftw_plan_with_nthreads(nthreads);
+#else
+     nthreads = 1;
+#endif
+
+     small = (char *) fftw_malloc_huge(1000);
+     if (!small)
+	  check_fail("no small block");
+     else {
+	  memset(small, 1, 1000);
+	  fftw_free(small);
+     }
+
+     in = fftw_alloc_complex(N);
+     out = fftw_alloc_complex(N);
+     ref = fftw_alloc_complex(N);
+     hin = (fftw_complex *) fftw_malloc_huge(sizeof(fftw_complex) * N);
+     hout = (fftw_complex *) fftw_malloc_huge(sizeof(fftw_complex) * N);
+     if (!in || !out || !ref || !hin || !hout) {
+	  check_fail("out of memory");
+	  return 1;
+     }
+     if (fftw_alignment_of(&hin[0][0]) != fftw_alignment_of(&in[0][0])
+	 || fftw_alignment_of(&hout[0][0]) != fftw_alignment_of(&out[0][0]))
+	  check_fail("huge block misaligned");
+#ifdef USE_THREADS
+     for (i = 0; i < N; ++i)
+	  if (hin[i][0] != 0 || hin[i][1] != 0)
+	       break;
+     if (i < N)
+	  check_fail("huge block not zeroed by first touch");
+#endif
+     kb1 = huge_kb();
+
+     t_plain = run(in, out, 0, "wrong result");
+     memcpy(ref, out, sizeof(fftw_complex) * N);
+     t_arrays = run(hin, hout, 0, "wrong result on huge arrays");
+     t_all = run(hin, hout, FFTW_HUGE_PAGES,
+		 "wrong result with FFTW_HUGE_PAGES");
+     for (i = 0; i < N; ++i)
+	  if (hout[i][0] != ref[i][0] || hout[i][1] != ref[i][1])
+	       break;
+     if (i < N)
+	  check_fail("FFTW_HUGE_PAGES changes the transform");
+
+     if (kb0 >= 0)
+	  printf("huge arrays: %ld kB of them on huge pages\n", kb1 - kb0);
+     printf("size %d, %d threads, s per transform: plain %.3g, "
+	    "huge arrays %.3g, and huge tables %.3g\n",
+	    N, nthreads, t_plain, t_arrays, t_all);
+
+     fftw_free(in);
+     fftw_free(out);
+     fftw_free(ref);
+     fftw_free(hin);
+     fftw_free(hout);
+#ifdef USE_THREADS
+     fftw_cleanup_threads();
+#else
+     fftw_cleanup();
+#endif
+
+     return check_exit();
+}
@@ -0,0 +1,177 @@
+/*
+ * Thread count selection check.
+ *
+ * usage: nthreads-check [nthreads]
+ *
+ * Plans transforms of several sizes with FFTW_ESTIMATE on NTHREADS
+ * threads (default 4).  Checks that
+ *   - fftw_plan_nthreads reports at least 1 and at most NTHREADS,
+ *     and 1 for a transform too small to share,
+ *   - every plan computes the same transform as a single-threaded one,
+ *   - the thread count of an FFTW_MEASURE plan survives wisdom,
+ *   - fftw_threads_calibrate leaves small transforms single-threaded.
+ * The count chosen for each size and the time per transform of the
+ * threaded and the single-threaded plan, before and after calibration,
+ * are printed for information.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/fftw3.h"
+#include "tests/check.h"
+
+#define NREP 200
+
+typedef struct {
+     const char *name;
+     int n, howmany;
+} shape;
+
+static const shape shapes[] = {
+     { "dft of 16", 16, 1 },
+     { "16 dfts of 64", 64, 16 },
+     { "256 dfts of 64", 64, 256 },
+     { "64 dfts of 1024", 1024, 64 },
+     { "dft of 262144", 262144, 1 },
+};
+#define NSHAPES ((int)(sizeof(shapes) / sizeof(shapes[0])))
+
+static fftw_plan plan(const shape *s, fftw_complex *in, fftw_complex *out,
+		      int nthreads, unsigned flags)
+{
+     int n = s->n;
+     fftw_plan_with_nthreads(nthreads);
+     return fftw_plan_many_dft(1, &n, s->howmany, in, 0, 1, n,
+			       out, 0, 1, n, FFTW_FORWARD, flags);
+}
+
+static double us_per_execute(fftw_plan p)
+{
+     double t0 = check_now();
+     int r;
+
+     for (r = 0; r < NREP; ++r)
+	  fftw_execute(p);
+     return (check_now() - t0) / NREP * 1e6;
+}
+
+/* plan S on NTHREADS and on one thread; check and time both */
+static void check_shape(const shape *s, int nthreads)
+{
+     size_t n = (size_t) s->n * s->howmany, i;
+     fftw_complex *in = fftw_alloc_complex(n);
+     fftw_complex *out = fftw_alloc_complex(n);
+     fftw_complex *ref = fftw_alloc_complex(n);
+     fftw_plan p = plan(s, in, out, nthreads, FFTW_ESTIMATE);
+     fftw_plan p1 = plan(s, in, ref, 1, FFTW_ESTIMATE);
+     double err = 0, mag = 0, t, t1;
+     int k;
+
+     if (!p || !p1) {
+	  check_fail("no plan");
+	  return;
+     }
+     k = fftw_plan_nthreads(p);
+     if (k < 1 || k > nthreads)
+	  check_fail("thread count out of range");
+     if (fftw_plan_nthreads(p1) != 1)
+	  check_fail("single-threaded plan on several threads");
+     if (s->n * s->howmany <= 16 && k != 1)
+	  check_fail("%s", s->name);
+
+     for (i = 0; i < n; ++i) {
+	  in[i][0] = sin((double) i * 0.37);
+	  in[i][1] = 0.1 * (double) (i % 7);
+     }
+     fftw_execute(p);
+     fftw_execute(p1);
+     for (i = 0; i < n; ++i) {
+	  double dr = out[i][0] - ref[i][0], di = out[i][1] - ref[i][1];
+	  err += dr * dr + di * di;
+	  mag += ref[i][0] * ref[i][0] + ref[i][1] * ref[i][1];
+     }
+     if (sqrt(err / mag) > 1e-14)
+	  check_fail("%s", s->name);
+
+     t = us_per_execute(p);
+     t1 = us_per_execute(p1);
+     printf("%s: %d threads, %.3g us, 1 thread %.3g us\n",
+	    s->name, k, t, t1);
+
+     fftw_destroy_plan(p);
+     fftw_destroy_plan(p1);
+     fftw_free(in);
+     fftw_free(out);
+     fftw_free(ref);
+}
+
+/* the count of a measured plan is the same when rebuilt from wisdom */
+static void check_wisdom(const shape *s, int nthreads)
+{
+     size_t n = (size_t) s->n * s->howmany;
+     fftw_complex *in = fftw_alloc_complex(n);
+     fftw_complex *out = fftw_alloc_complex(n);
+     fftw_plan p;
+     char *w;
+     int k;
+
+     fftw_set_timelimit(1.0);
+     p = plan(s, in, out, nthreads, FFTW_MEASURE);
+     if (!p) {
+	  check_fail("no measured plan");
+	  return;
+     }
+     k = fftw_plan_nthreads(p);
+     fftw_destroy_plan(p);
+     w = fftw_export_wisdom_to_string();
+     fftw_forget_wisdom();
+     if (!w || !fftw_import_wisdom_from_string(w))
+	  check_fail("wisdom");
+     free(w);
+     p = plan(s, in, out, nthreads, FFTW_MEASURE | FFTW_WISDOM_ONLY);
+     if (!p)
+	  check_fail("no plan from wisdom");
+     else {
+	  if (fftw_plan_nthreads(p) != k)
+	       check_fail("thread count not in wisdom");
+	  printf("%s, measured: %d threads\n", s->name, k);
+	  fftw_destroy_plan(p);
+     }
+     fftw_set_timelimit(FFTW_NO_TIMELIMIT);
+     fftw_forget_wisdom(); /* lest FFTW_ESTIMATE plans use it */
+     fftw_free(in);
+     fftw_free(out);
+}
+
+int main(int argc, char *argv[])
+{
+     int nthreads = 4, k;
+
+     if (argc > 1)
+	  nthreads = atoi(argv[1]);
+
+     if (!fftw_init_threads()) {
+	  printf("threads not available\n");
+	  return 0;
+     }
+
+     printf("FFTW_ESTIMATE plans for up to %d threads, default model\n",
+	    nthreads);
+     for (k = 0; k < NSHAPES; ++k)
+	  check_shape(&shapes[k], nthreads);
+
+     check_wisdom(&shapes[2], nthreads);
+
+     fftw_plan_with_nthreads(nthreads);
+     fftw_threads_calibrate();
+     printf("calibrated model\n");
+     for (k = 0; k < NSHAPES; ++k)
+	  check_shape(&shapes[k], nthreads);
+
+     fftw_cleanup_threads();
+
+     return check_exit();
+}
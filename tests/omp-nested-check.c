@@ -0,0 +1,156 @@
+/*
+ * OpenMP nesting check, for the OpenMP threads library.
+ *
+ * usage: omp-nested-check [nthreads]
+ *
+ * Calls X(spawn_loop) and X(spawn_chunks) directly.  Checks that every
+ * iteration runs exactly once and that
+ *   - outside any parallel region, a loop opens its own, unless
+ *     omp_get_max_active_levels() is 0, when it runs on the caller,
+ *   - inside a parallel region of several threads, it runs in the team
+ *     of that region (as tasks), never in a nested one.
+ * Then transforms a batch of small DFTs from an omp parallel for, with
+ * single-threaded plans and with plans for NTHREADS (default 4), checks
+ * both, and prints the time per batch of each for information.
+ */
+
+#include <math.h>
+#include <omp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/api.h"
+#include "threads/threads.h"
+#include "tests/check.h"
+
+#define MAXLOOP 64
+#define N 256
+#define BATCH 512
+#define NREP 20
+
+typedef struct {
+     int hits[MAXLOOP];
+     int level, nested;
+} count_data;
+
+static void *count(spawn_data *d)
+{
+     count_data *c = (count_data *) d->data;
+     int i;
+
+     if (omp_get_level() != c->level)
+	  c->nested = 1;
+     for (i = d->min; i < d->max; ++i) {
+#pragma omp atomic
+	  ++c->hits[i];
+     }
+     return 0;
+}
+
+/* loops of every length on NTHR threads, whose blocks must run at
+   parallel level LEVEL */
+static void check_loops(int nthr, int level, const char *what)
+{
+     count_data c;
+     int n, i, chunks;
+
+     for (chunks = 0; chunks < 2; ++chunks)
+	  for (n = 0; n < MAXLOOP; ++n) {
+	       memset(&c, 0, sizeof(c));
+	       c.level = level;
+	       if (chunks)
+		    fftw_spawn_chunks(n, nthr, count, &c);
+	       else
+		    fftw_spawn_loop(n, nthr, count, &c);
+	       for (i = 0; i < MAXLOOP; ++i)
+		    if (c.hits[i] != (i < n))
+			 break;
+	       if (i < MAXLOOP)
+		    check_fail("iteration missed or repeated");
+	       if (c.nested)
+		    check_fail("%s", what);
+	  }
+}
+
+/* BATCH transforms of size N by a parallel loop of the caller, on plans
+   of NTHREADS; returns seconds per batch */
+static double batch(int nthreads, fftw_complex *in, fftw_complex *out,
+		    const fftw_complex *ref)
+{
+     fftw_plan p;
+     double t0, t;
+     int r, b;
+
+     fftw_plan_with_nthreads(nthreads);
+     p = fftw_plan_dft_1d(N, in, out, FFTW_FORWARD, FFTW_ESTIMATE);
+     memset(out, 0, sizeof(fftw_complex) * N * BATCH);
+
+     t0 = omp_get_wtime();
+     for (r = 0; r < NREP; ++r) {
+#pragma omp parallel for schedule(dynamic, 1)
+	  for (b = 0; b < BATCH; ++b)
+	       fftw_execute_dft(p, in + (size_t) b * N, out + (size_t) b * N);
+     }
+     t = (omp_get_wtime() - t0) / NREP;
+
+     if (ref) {
+	  size_t i;
+	  for (i = 0; i < (size_t) N * BATCH; ++i)
+	       if (fabs(out[i][0] - ref[i][0]) > 1e-10
+		   || fabs(out[i][1] - ref[i][1]) > 1e-10)
+		    break;
+	  if (i < (size_t) N * BATCH)
+	       check_fail("wrong transform");
+     }
+     fftw_destroy_plan(p);
+     return t;
+}
+
+int main(int argc, char *argv[])
+{
+     fftw_complex *in, *out, *ref;
+     double t1, tn;
+     int nthreads = 4, levels;
+     size_t i;
+
+     if (argc > 1)
+	  nthreads = atoi(argv[1]);
+
+     if (!fftw_init_threads()) {
+	  printf("threads not available\n");
+	  return 0;
+     }
+
+     levels = omp_get_max_active_levels();
+     check_loops(nthreads, levels > 0 ? 1 : 0,
+		 "loop outside a region not in its own");
+     omp_set_max_active_levels(0);
+     check_loops(nthreads, 0, "loop run in a region beyond the levels");
+     omp_set_max_active_levels(levels > 1 ? levels : 2);
+#pragma omp parallel num_threads(4)
+     check_loops(nthreads, omp_get_num_threads() > 1 ? 1 : 2,
+		 "loop inside a region in a nested one");
+     omp_set_max_active_levels(levels);
+
+     in = fftw_alloc_complex((size_t) N * BATCH);
+     out = fftw_alloc_complex((size_t) N * BATCH);
+     ref = fftw_alloc_complex((size_t) N * BATCH);
+     for (i = 0; i < (size_t) N * BATCH; ++i) {
+	  in[i][0] = sin((double) i * 0.37);
+	  in[i][1] = 0.1 * (double) (i % 7);
+     }
+
+     t1 = batch(1, in, ref, 0);
+     tn = batch(nthreads, in, out, ref);
+     printf("%d dfts of %d from a parallel loop of %d threads, "
+	    "ms per batch: 1-thread plans %.3g, %d-thread plans %.3g\n",
+	    BATCH, N, omp_get_max_threads(), t1 * 1e3, nthreads, tn * 1e3);
+
+     fftw_free(in);
+     fftw_free(out);
+     fftw_free(ref);
+     fftw_cleanup_threads();
+
+     return check_exit();
+}
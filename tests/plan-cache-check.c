@@ -0,0 +1,251 @@
+/*
+ * Plan cache check.
+ *
+ * usage: plan-cache-check
+ *
+ * With fftw_set_plan_cache(), several "modules" create the same
+ * r2c and many-DFT plans, each on its own arrays.  Checks that
+ *   - every plan computes the right transform of its own arrays,
+ *   - duplicates share one cached plan (one miss, then hits),
+ *   - in-place, misaligned or differently flagged plans do not, nor
+ *     (with threads) plans made with and without work stealing,
+ *   - idle plans are evicted least recently used first once the
+ *     cache is over budget, and all of them when it is disabled.
+ * The time to create a duplicate, against the first plan, is printed
+ * for information.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/fftw3.h"
+#include "tests/check.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define NMOD 8
+#define N_R2C 360
+#define N_MANY 60
+#define HOWMANY 3
+
+static double rnd(unsigned *seed)
+{
+     *seed = *seed * 1103515245u + 12345u;
+     return (double)(*seed >> 8) / (1 << 24) - 0.5;
+}
+
+/* relative error of OUT against a naive DFT of the N complex IN */
+static double dft_error(const double *in, int istride, int cplx,
+			const fftw_complex *out, int nout, int n)
+{
+     double err = 0.0, mag = 0.0;
+     int i, k;
+
+     for (k = 0; k < nout; ++k) {
+	  double re = 0.0, im = 0.0;
+	  for (i = 0; i < n; ++i) {
+	       double a = -2.0 * M_PI * (double)((long)i * k % n) / n;
+	       double xr = in[i * istride], xi = cplx ? in[i * istride + 1] : 0;
+	       re += xr * cos(a) - xi * sin(a);
+	       im += xr * sin(a) + xi * cos(a);
+	  }
+	  err += (out[k][0] - re) * (out[k][0] - re)
+	       + (out[k][1] - im) * (out[k][1] - im);
+	  mag += re * re + im * im;
+     }
+     return sqrt(err / mag);
+}
+
+static void stats(int *nplans, double *hits, double *misses)
+{
+     fftw_plan_cache_stats(0, nplans, hits, misses);
+}
+
+/* a cached r2c plan of size N, created and destroyed; whether it hit */
+static int touch(int n)
+{
+     double *in = fftw_alloc_real(n);
+     fftw_complex *out = fftw_alloc_complex(n / 2 + 1);
+     double h0, h1;
+     fftw_plan p;
+
+     stats(0, &h0, 0);
+     p = fftw_plan_dft_r2c_1d(n, in, out, FFTW_ESTIMATE);
+     stats(0, &h1, 0);
+     fftw_destroy_plan(p);
+     fftw_free(in);
+     fftw_free(out);
+     return h1 > h0;
+}
+
+#ifdef USE_THREADS
+/* the planner's work-stealing setting changes the plan: it is part of
+   the key */
+static void check_stealing(void)
+{
+     int nplans;
+     double hits, misses, misses0;
+
+     fftw_set_plan_cache((size_t) 1 << 26);
+     stats(0, 0, &misses0);
+     fftw_plan_with_nthreads(2);
+     touch(4096);
+     fftw_plan_with_work_stealing(4);
+     if (touch(4096))
+	  check_fail("work-stealing plan taken from the cache");
+     if (!touch(4096))
+	  check_fail("work-stealing plan not cached");
+     fftw_plan_with_work_stealing(1);
+     if (!touch(4096))
+	  check_fail("plan without work stealing evicted");
+     stats(&nplans, &hits, &misses);
+     if (nplans != 2 || misses != misses0 + 2)
+	  check_fail("plans with and without work stealing are shared");
+     fftw_plan_with_nthreads(1);
+     fftw_set_plan_cache(0);
+}
+#endif
+
+int main(void)
+{
+     double *rin[NMOD];
+     fftw_complex *rout[NMOD], *min[NMOD], *mout[NMOD];
+     fftw_plan pr[NMOD], pm[NMOD], p;
+     int n = N_MANY, nplans, ndiff, i, j, m, ok;
+     double hits, misses, t_first = 0, t_dup = 0;
+     size_t bytes;
+     unsigned seed = 1;
+     double t0;
+
+#ifdef USE_THREADS
+     if (!fftw_init_threads()) {
+	  check_fail("fftw_init_threads");
+	  return 1;
+     }
+#endif
+     fftw_set_plan_cache((size_t) 1 << 26);
+
+     for (m = 0; m < NMOD; ++m) {
+	  rin[m] = fftw_alloc_real(N_R2C);
+	  rout[m] = fftw_alloc_complex(N_R2C / 2 + 1);
+	  min[m] = fftw_alloc_complex(N_MANY * HOWMANY);
+	  mout[m] = fftw_alloc_complex(N_MANY * HOWMANY);
+
+	  t0 = check_now();
+	  pr[m] = fftw_plan_dft_r2c_1d(N_R2C, rin[m], rout[m], FFTW_MEASURE);
+	  if (m == 0) t_first = check_now() - t0; else t_dup += check_now() - t0;
+	  pm[m] = fftw_plan_many_dft(1, &n, HOWMANY, min[m], 0, 1, N_MANY,
+				     mout[m], 0, 1, N_MANY, FFTW_FORWARD,
+				     FFTW_ESTIMATE);
+	  if (!pr[m] || !pm[m]) {
+	       check_fail("no plan");
+	       return 1;
+	  }
+     }
+
+     stats(&nplans, &hits, &misses);
+     printf("%d modules: %d cached plans, %g hits, %g misses\n",
+	    NMOD, nplans, hits, misses);
+     if (nplans != 2 || hits != 2 * (NMOD - 1) || misses != 2)
+	  check_fail("duplicate plans are not shared");
+     printf("FFTW_MEASURE r2c plan: first %.3g s, duplicates %.3g s each\n",
+	    t_first, t_dup / (NMOD - 1));
+
+     /* every module transforms its own data (MEASURE overwrote it) */
+     for (m = 0; m < NMOD; ++m) {
+	  for (i = 0; i < N_R2C; ++i)
+	       rin[m][i] = rnd(&seed);
+	  for (i = 0; i < N_MANY * HOWMANY; ++i) {
+	       min[m][i][0] = rnd(&seed);
+	       min[m][i][1] = rnd(&seed);
+	  }
+     }
+     for (m = 0; m < NMOD; ++m) {
+	  fftw_execute(pr[m]);
+	  fftw_execute(pm[m]);
+     }
+     for (m = 0; m < NMOD; ++m) {
+	  if (dft_error(rin[m], 1, 0, rout[m], N_R2C / 2 + 1, N_R2C) > 1e-12)
+	       check_fail("wrong r2c result");
+	  for (j = 0; j < HOWMANY; ++j)
+	       if (dft_error(&min[m][j * N_MANY][0], 2, 1,
+			     mout[m] + j * N_MANY, N_MANY, N_MANY) > 1e-12)
+		    check_fail("wrong many-DFT result");
+     }
+
+     /* these differ from the cached plans; the misaligned one only if
+        SIMD makes alignment matter */
+     p = fftw_plan_dft_r2c_1d(N_R2C, rin[0], (fftw_complex *) rin[0],
+			      FFTW_ESTIMATE);
+     fftw_destroy_plan(p);
+     p = fftw_plan_dft_r2c_1d(N_R2C, rin[0], rout[0], FFTW_ESTIMATE);
+     fftw_destroy_plan(p);
+     p = fftw_plan_dft_r2c_1d(N_R2C, rin[0] + 1, rout[0], FFTW_ESTIMATE);
+     fftw_destroy_plan(p);
+     ndiff = 4 + (fftw_alignment_of(rin[0]) != fftw_alignment_of(rin[0] + 1));
+     stats(&nplans, &hits, &misses);
+     if (nplans != ndiff || misses != ndiff)
+	  check_fail("plans of different problems or flags are shared");
+
+     for (m = 0; m < NMOD; ++m) {
+	  fftw_destroy_plan(pr[m]);
+	  fftw_destroy_plan(pm[m]);
+     }
+     stats(&nplans, 0, 0);
+     if (nplans != ndiff)
+	  check_fail("idle plans are evicted within budget");
+
+     /* least recently used first: A, B cached, A touched, then C */
+     fftw_set_plan_cache(0);
+     fftw_set_plan_cache((size_t) 1 << 26);
+     touch(1024);
+     touch(1000);
+     fftw_plan_cache_stats(&bytes, &nplans, 0, 0);
+     fftw_set_plan_cache(bytes);
+     if (!touch(1024))
+	  check_fail("plan evicted within budget");
+     touch(960);
+     ok = touch(1024);
+     if (!ok && touch(1000))
+	  check_fail("eviction is not least recently used first");
+     fftw_plan_cache_stats(&bytes, &nplans, 0, 0);
+     printf("budget of two plans: %d cached, %lu bytes\n", nplans,
+	    (unsigned long) bytes);
+
+     /* disabling empties the cache, and stops counting */
+     fftw_set_plan_cache(0);
+     stats(&nplans, &hits, &misses);
+     if (nplans != 0)
+	  check_fail("disabled cache keeps plans");
+     touch(1024);
+     stats(0, &hits, &misses);
+     {
+	  double h, mi;
+	  touch(1024);
+	  stats(0, &h, &mi);
+	  if (h != hits || mi != misses)
+	       check_fail("disabled cache is used");
+     }
+
+#ifdef USE_THREADS
+     check_stealing();
+#endif
+
+     for (m = 0; m < NMOD; ++m) {
+	  fftw_free(rin[m]);
+	  fftw_free(rout[m]);
+	  fftw_free(min[m]);
+	  fftw_free(mout[m]);
+     }
+#ifdef USE_THREADS
+     fftw_cleanup_threads();
+#else
+     fftw_cleanup();
+#endif
+
+     return check_exit();
+}
@@ -0,0 +1,243 @@
+/*
+ * Concurrent planning check.
+ *
+ * usage: planner-check [nthreads]
+ *
+ * After fftw_make_planner_concurrent(), NTHREADS threads (default 8)
+ * plan and execute transforms of overlapping sets of sizes with
+ * FFTW_MEASURE at the same time.  Checks that
+ *   - every plan computes the right DFT (against a naive one),
+ *   - wisdom found by any thread is wisdom for all (FFTW_WISDOM_ONLY),
+ *   - fftw_forget_wisdom() in one thread is seen by the others,
+ *   - exported wisdom covers all threads and imports back, as text
+ *     and in binary,
+ *   - where the system tells (Linux), memory does not grow while the
+ *     threads plan and forget their wisdom over and over (the shared
+ *     wisdom it replaces is reclaimed).
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/fftw3.h"
+#include "tests/check.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define MAXTHR 64
+
+static const int sizes[] = { 16, 17, 24, 60, 64, 97, 128, 243, 256, 360,
+			     512, 1000, 1024 };
+#define NSIZES ((int)(sizeof(sizes) / sizeof(sizes[0])))
+
+static int nthreads = 8;
+
+/* plan n with FLAGS and compare against a naive DFT of random data */
+static int check_size(int n, unsigned flags, unsigned seed)
+{
+     fftw_complex *in = fftw_alloc_complex(n), *out = fftw_alloc_complex(n);
+     fftw_plan p = fftw_plan_dft_1d(n, in, out, FFTW_FORWARD, flags);
+     double err = 0.0, mag = 0.0;
+     int i, k, ok = 1;
+
+     if (!p) {
+	  ok = 0;
+	  goto done;
+     }
+
+     for (i = 0; i < n; ++i) {
+	  seed = seed * 1103515245u + 12345u;
+	  in[i][0] = (double)(seed >> 8) / (1 << 24) - 0.5;
+	  seed = seed * 1103515245u + 12345u;
+	  in[i][1] = (double)(seed >> 8) / (1 << 24) - 0.5;
+     }
+     fftw_execute(p);
+
+     for (k = 0; k < n; ++k) {
+	  double re = 0.0, im = 0.0;
+	  for (i = 0; i < n; ++i) {
+	       double a = -2.0 * M_PI * (double)((long)i * k % n) / n;
+	       re += in[i][0] * cos(a) - in[i][1] * sin(a);
+	       im += in[i][0] * sin(a) + in[i][1] * cos(a);
+	  }
+	  err += (out[k][0] - re) * (out[k][0] - re)
+	       + (out[k][1] - im) * (out[k][1] - im);
+	  mag += re * re + im * im;
+     }
+     if (sqrt(err / mag) > 1e-12) {
+	  check_fail("wrong result (n = %d)", n);
+	  ok = 0;
+     }
+     fftw_destroy_plan(p);
+
+ done:
+     fftw_free(in);
+     fftw_free(out);
+     return ok;
+}
+
+static void *planner_thread(void *arg)
+{
+     int t = (int)(size_t)arg, j;
+
+     /* every thread plans every size, starting at a different one */
+     for (j = 0; j < NSIZES; ++j) {
+	  int n = sizes[(t + j) % NSIZES];
+	  if (!check_size(n, FFTW_MEASURE, (unsigned)(t * 7919 + n)))
+	       check_fail("FFTW_MEASURE plan (n = %d)", n);
+     }
+     return 0;
+}
+
+/* expect (or not) wisdom for all sizes */
+static void *wisdom_thread(void *arg)
+{
+     int expect = (int)(size_t)arg, j;
+
+     for (j = 0; j < NSIZES; ++j) {
+	  int n = sizes[j];
+	  if (check_size(n, FFTW_MEASURE | FFTW_WISDOM_ONLY, (unsigned)n) != expect)
+	       check_fail("%s (n = %d)", expect ? "wisdom missing in another thread"
+			  : "wisdom survived fftw_forget_wisdom", n);
+     }
+     return 0;
+}
+
+static void *forget_thread(void *arg)
+{
+     (void)arg;
+     fftw_forget_wisdom();
+     return 0;
+}
+
+/* resident memory of the process in kB, or -1 if unknown */
+static long resident_kb(void)
+{
+     FILE *f = fopen("/proc/self/status", "r");
+     char line[256];
+     long kb = -1;
+
+     if (!f)
+	  return -1;
+     while (fgets(line, sizeof(line), f))
+	  if (!strncmp(line, "VmRSS:", 6))
+	       kb = atol(line + 6);
+     fclose(f);
+     return kb;
+}
+
+#define CHURN_SIZES 64
+#define CHURN_ROUNDS 400
+
+/* resident memory once all threads have planned for a while, and at
+   the end */
+static long churn_kb[2];
+static int churn_started;
+
+/* plan CHURN_SIZES small sizes with FFTW_ESTIMATE, over and over; thread
+   0 forgets all wisdom after each round, and takes churn_kb */
+static void *churn_thread(void *arg)
+{
+     int t = (int)(size_t)arg, r, n;
+     fftw_complex *in = fftw_alloc_complex(CHURN_SIZES + 1);
+     fftw_complex *out = fftw_alloc_complex(CHURN_SIZES + 1);
+
+     /* all together */
+     __sync_fetch_and_add(&churn_started, 1);
+     while (__sync_fetch_and_add(&churn_started, 0) < nthreads)
+	  sched_yield();
+
+     for (r = 0; r < CHURN_ROUNDS; ++r) {
+	  for (n = 2; n < CHURN_SIZES + 2; ++n) {
+	       fftw_plan p = fftw_plan_dft_1d(n, in, out, FFTW_FORWARD,
+					      FFTW_ESTIMATE);
+	       if (p)
+		    fftw_destroy_plan(p);
+	  }
+	  if (t == 0) {
+	       fftw_forget_wisdom();
+	       if (r == CHURN_ROUNDS / 4)
+		    churn_kb[0] = resident_kb();
+	  }
+     }
+     if (t == 0)
+	  churn_kb[1] = resident_kb();
+     fftw_free(in);
+     fftw_free(out);
+     return 0;
+}
+
+static void run(void *(*f)(void *), int n, size_t arg0, size_t step)
+{
+     pthread_t tid[MAXTHR];
+     int i;
+
+     for (i = 0; i < n; ++i)
+	  pthread_create(&tid[i], 0, f, (void *)(arg0 + i * step));
+     for (i = 0; i < n; ++i)
+	  pthread_join(tid[i], 0);
+}
+
+int main(int argc, char *argv[])
+{
+     char *wis;
+
+     if (argc > 1)
+	  nthreads = atoi(argv[1]);
+     if (nthreads < 1 || nthreads > MAXTHR)
+	  nthreads = 8;
+
+     if (!fftw_init_threads() || !fftw_make_planner_concurrent()) {
+	  printf("concurrent planning not available\n");
+	  return 0;
+     }
+
+     run(planner_thread, nthreads, 0, 1);
+     printf("%d threads planned %d sizes each\n", nthreads, NSIZES);
+
+     /* the main thread has not planned yet: all of it is shared */
+     wisdom_thread((void *)1);
+     run(wisdom_thread, 2, 1, 0);
+
+     wis = fftw_export_wisdom_to_string();
+
+     /* forgetting in another thread reaches this thread's planner too */
+     run(forget_thread, 1, 0, 0);
+     wisdom_thread((void *)0);
+     run(wisdom_thread, 1, 0, 0);
+
+     if (!wis || !fftw_import_wisdom_from_string(wis))
+	  check_fail("wisdom does not import back");
+     run(wisdom_thread, 2, 1, 0);
+     free(wis);
+
+     /* binary wisdom imported by one thread serves all */
+     if (!fftw_export_wisdom_to_binary_filename("planner-check.bin"))
+	  check_fail("binary wisdom does not export");
+     run(forget_thread, 1, 0, 0);
+     if (!fftw_import_wisdom_from_binary_filename("planner-check.bin"))
+	  check_fail("binary wisdom does not import back");
+     run(wisdom_thread, 2, 1, 0);
+     remove("planner-check.bin");
+
+     /* replaced and forgotten shared wisdom does not pile up */
+     run(churn_thread, nthreads, 0, 1);
+     if (churn_kb[0] >= 0) {
+	  long kb = churn_kb[1] - churn_kb[0];
+	  printf("%d threads planned and forgot %d sizes %d times: "
+		 "%ld kB more memory in the last %d\n", nthreads, CHURN_SIZES,
+		 CHURN_ROUNDS, kb, CHURN_ROUNDS - CHURN_ROUNDS / 4 - 1);
+	  if (kb > 1024 + 256 * nthreads) /* allocator noise */
+	       check_fail("memory grows with forgotten wisdom");
+     }
+
+     fftw_cleanup_threads();
+
+     return check_exit();
+}
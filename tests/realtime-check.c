@@ -0,0 +1,437 @@
+/*
+ * Realtime execution check.
+ *
+ * usage: realtime-check
+ *
+ * Plans problems that reach every solver that needs buffers while it
+ * executes (buffered loops, Rader, Bluestein, generic, the DCT/DST
+ * solvers, in-place transposes, buffered codelets) with FFTW_REALTIME.
+ * A planner hook executes every candidate plan of each problem with a
+ * workspace of the size the plan declares, checks that the result is
+ * exactly that of the execution with heap buffers, and, with malloc,
+ * free and the lock and wait functions of the C library interposed,
+ * that the execution calls none of them (while some do with heap
+ * buffers, lest the audit be vacuous).  Then checks that the plan
+ * itself is single-threaded and executes without allocating or
+ * locking, from its own workspace and from one given by
+ * fftw_plan_set_scratch, with the same result.  Also checks that a
+ * workspace current in one thread serves no buffer of another, before
+ * the threads library is initialized as after.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/api.h"
+#include "dft/dft.h"
+#include "tests/check.h"
+
+#if defined(__GLIBC__)
+#include <dlfcn.h>
+#include <semaphore.h>
+#define INTERPOSE 1
+#endif
+
+#define NMAX (1 << 16) /* doubles in each array */
+
+/* calls to the interposed functions by this thread while auditing */
+static __thread int auditing = 0;
+static __thread unsigned long ncalls = 0;
+
+#define AUDIT() do { if (auditing) ++ncalls; } while (0)
+
+#ifdef INTERPOSE
+extern void *__libc_malloc(size_t n);
+extern void __libc_free(void *p);
+extern void *__libc_calloc(size_t n, size_t m);
+extern void *__libc_realloc(void *p, size_t n);
+extern void *__libc_memalign(size_t align, size_t n);
+
+void *malloc(size_t n) { AUDIT(); return __libc_malloc(n); }
+void free(void *p) { if (p) AUDIT(); __libc_free(p); }
+void *calloc(size_t n, size_t m) { AUDIT(); return __libc_calloc(n, m); }
+void *realloc(void *p, size_t n) { AUDIT(); return __libc_realloc(p, n); }
+void *memalign(size_t a, size_t n) { AUDIT(); return __libc_memalign(a, n); }
+
+void *aligned_alloc(size_t a, size_t n)
+{
+     AUDIT();
+     return __libc_memalign(a, n);
+}
+
+int posix_memalign(void **p, size_t a, size_t n)
+{
+     void *q;
+     AUDIT();
+     if (a % sizeof(void *) || (a & (a - 1)))
+	  return 22; /* EINVAL */
+     if (!(q = __libc_memalign(a, n)))
+	  return 12; /* ENOMEM */
+     *p = q;
+     return 0;
+}
+
+#define REAL(ret, name, params)					\
+     typedef ret (*name##_fn) params;				\
+     static name##_fn real_##name(void)			\
+     {								\
+	  static name##_fn fn = 0;				\
+	  if (!fn)						\
+	       fn = (name##_fn) dlsym(RTLD_NEXT, #name);	\
+	  return fn;						\
+     }
+
+REAL(int, pthread_mutex_lock, (pthread_mutex_t *))
+REAL(int, pthread_cond_wait, (pthread_cond_t *, pthread_mutex_t *))
+REAL(int, sem_wait, (sem_t *))
+
+int pthread_mutex_lock(pthread_mutex_t *m)
+{
+     AUDIT();
+     return real_pthread_mutex_lock()(m);
+}
+
+int pthread_cond_wait(pthread_cond_t *c, pthread_mutex_t *m)
+{
+     AUDIT();
+     return real_pthread_cond_wait()(c, m);
+}
+
+int sem_wait(sem_t *s)
+{
+     AUDIT();
+     return real_sem_wait()(s);
+}
+#endif
+
+static R *in, *out, *in0, *out0, *ref;
+
+/* the top-level problem of the current plan, recognized by its kind,
+   its arrays and its size */
+static int want_kind;
+static R *want_in, *want_out;
+static INT want_total;
+static int ncand;
+static int nheap; /* candidates that allocate without a workspace */
+
+static int top_p(const problem *p)
+{
+     const tensor *sz, *vecsz;
+     R *I, *O;
+
+     if (p->adt->problem_kind != want_kind)
+	  return 0;
+     switch (want_kind) {
+	 case PROBLEM_DFT: {
+	      const problem_dft *d = (const problem_dft *) p;
+	      sz = d->sz; vecsz = d->vecsz; I = d->ri; O = d->ro;
+	      break;
+	 }
+	 case PROBLEM_RDFT: {
+	      const problem_rdft *d = (const problem_rdft *) p;
+	      sz = d->sz; vecsz = d->vecsz; I = d->I; O = d->O;
+	      break;
+	 }
+	 default: {
+	      const problem_rdft2 *d = (const problem_rdft2 *) p;
+	      sz = d->sz; vecsz = d->vecsz; I = d->r0; O = d->cr;
+	      break;
+	 }
+     }
+     return I == want_in && O == want_out
+	  && X(tensor_sz)(sz) * X(tensor_sz)(vecsz) == want_total;
+}
+
+static void restore(void)
+{
+     memcpy(in, in0, sizeof(R) * NMAX);
+     memcpy(out, out0, sizeof(R) * NMAX);
+}
+
+static int same(void)
+{
+     return !memcmp(out, ref, sizeof(R) * NMAX)
+	  && !memcmp(in, ref + NMAX, sizeof(R) * NMAX);
+}
+
+static void print_plan(plan *pln)
+{
+     printer *pr = X(mkprinter_file)(stdout);
+     pr->print(pr, "%p\n", pln);
+     X(printer_destroy)(pr);
+}
+
+static void audit(planner *plnr, plan *pln, const problem *p, int optimalp)
+{
+     scratch ws, *prev;
+     size_t n = pln->scratch + SCRATCH_ALIGN;
+     void *mem;
+     unsigned long calls;
+
+     UNUSED(plnr);
+     UNUSED(optimalp);
+     if (!top_p(p))
+	  return;
+     ++ncand;
+
+     mem = malloc(n);
+     X(scratch_init)(&ws, mem, n);
+     X(plan_awake)(pln, AWAKE_SINCOS);
+
+     restore();
+     ncalls = 0;
+     auditing = 1;
+     pln->adt->solve(pln, p);
+     auditing = 0;
+     if (ncalls)
+	  ++nheap;
+     memcpy(ref, out, sizeof(R) * NMAX);
+     memcpy(ref + NMAX, in, sizeof(R) * NMAX);
+
+     restore();
+     prev = X(scratch_enter)(&ws);
+     ncalls = 0;
+     auditing = 1;
+     pln->adt->solve(pln, p);
+     auditing = 0;
+     calls = ncalls;
+     X(scratch_leave)(prev);
+
+     if (calls) {
+	  printf("%lu allocations or locks in ", calls);
+	  print_plan(pln);
+	  check_fail("candidate plan allocates or locks");
+     }
+     if (ws.used)
+	  check_fail("workspace not emptied");
+     if (!same()) {
+	  printf("different result in workspace: ");
+	  print_plan(pln);
+	  check_fail("candidate plan computes differently in its workspace");
+     }
+
+     X(plan_awake)(pln, SLEEPY);
+     free(mem);
+}
+
+/* execute P, checking that it neither allocates nor locks */
+static void execute_audited(fftw_plan p, const char *what)
+{
+     unsigned long calls;
+
+     restore();
+     ncalls = 0;
+     auditing = 1;
+     fftw_execute(p);
+     auditing = 0;
+     calls = ncalls;
+     if (calls) {
+	  printf("%s: %lu allocations or locks\n", what, calls);
+	  check_fail("realtime plan allocates or locks");
+     }
+}
+
+static void check_plan(fftw_plan p, const char *what)
+{
+     size_t n;
+     void *mem;
+
+     if (!p) {
+	  printf("%s: ", what);
+	  check_fail("no plan");
+	  return;
+     }
+     if (fftw_plan_nthreads(p) != 1)
+	  check_fail("realtime plan not single-threaded");
+
+     execute_audited(p, what);
+     memcpy(ref, out, sizeof(R) * NMAX);
+     memcpy(ref + NMAX, in, sizeof(R) * NMAX);
+
+     /* the caller's workspace */
+     n = fftw_plan_scratch_size(p);
+     mem = malloc(n + 1);
+     fftw_plan_set_scratch(p, (char *) mem + 1); /* misaligned */
+     execute_audited(p, what);
+     if (!same())
+	  check_fail("different result in the caller's workspace");
+
+     /* the heap */
+     fftw_plan_set_scratch(p, 0);
+     restore();
+     fftw_execute(p);
+     if (!same())
+	  check_fail("different result with heap buffers");
+
+     printf("%s: %d candidates, %lu bytes of scratch\n",
+	    what, ncand, (unsigned long) n);
+     fftw_destroy_plan(p);
+     free(mem);
+}
+
+static void expect(int kind, R *i, R *o, INT total)
+{
+     want_kind = kind;
+     want_in = i;
+     want_out = o;
+     want_total = total;
+     ncand = 0;
+}
+
+static void dft(int n, int howmany, int stride, int dist, unsigned flags)
+{
+     char what[64];
+     expect(PROBLEM_DFT, in, out, (INT) n * howmany);
+     sprintf(what, "dft %d x %d", n, howmany);
+     check_plan(fftw_plan_many_dft(1, &n, howmany,
+				   (fftw_complex *) in, 0, stride, dist,
+				   (fftw_complex *) out, 0, stride, dist,
+				   FFTW_FORWARD, flags | FFTW_REALTIME),
+		what);
+}
+
+static void r2c(int n, int howmany, int stride, int dist, unsigned flags)
+{
+     char what[64];
+     expect(PROBLEM_RDFT2, in, out, (INT) n * howmany);
+     sprintf(what, "r2c %d x %d", n, howmany);
+     check_plan(fftw_plan_many_dft_r2c(1, &n, howmany,
+				       in, 0, stride, dist,
+				       (fftw_complex *) out, 0, stride, dist,
+				       flags | FFTW_REALTIME),
+		what);
+}
+
+static void r2r(int n, fftw_r2r_kind kind, unsigned flags)
+{
+     char what[64];
+     expect(PROBLEM_RDFT, in, out, n);
+     sprintf(what, "r2r %d of kind %d", n, (int) kind);
+     check_plan(fftw_plan_r2r_1d(n, in, out, kind, flags | FFTW_REALTIME),
+		what);
+}
+
+/* in-place transpose of an n x m matrix */
+static void transpose(int n, int m, unsigned flags)
+{
+     char what[64];
+     fftw_iodim d[2];
+
+     d[0].n = n; d[0].is = m; d[0].os = 1;
+     d[1].n = m; d[1].is = 1; d[1].os = n;
+     expect(PROBLEM_RDFT, in, in, (INT) n * m);
+     sprintf(what, "transpose %d x %d", n, m);
+     check_plan(fftw_plan_guru_r2r(0, 0, 2, d, in, in, 0,
+				   flags | FFTW_REALTIME),
+		what);
+}
+
+static void *other_thread(void *arg)
+{
+     scratch *ws = (scratch *) arg;
+     char *p = (char *) X(scratch_malloc)(64);
+
+     if (p >= ws->base && p < ws->base + ws->size)
+	  check_fail("workspace of another thread used");
+     X(scratch_ifree)(p);
+     return 0;
+}
+
+/* a workspace current here is not current in another thread */
+static void check_thread_local(void)
+{
+     scratch ws, *prev;
+     void *mem = malloc(4096);
+     pthread_t t;
+
+     X(scratch_init)(&ws, mem, 4096);
+     prev = X(scratch_enter)(&ws);
+     if (pthread_create(&t, 0, other_thread, &ws))
+	  check_fail("pthread_create");
+     else
+	  pthread_join(t, 0);
+     X(scratch_leave)(prev);
+     free(mem);
+}
+
+int main(void)
+{
+     int i;
+
+#ifdef INTERPOSE
+     /* resolve the real functions before auditing */
+     real_pthread_mutex_lock();
+     real_pthread_cond_wait();
+     real_sem_wait();
+#else
+     printf("allocations and locks not audited\n");
+#endif
+     check_thread_local();
+#ifdef USE_THREADS
+     if (!fftw_init_threads()) {
+	  check_fail("fftw_init_threads");
+	  return 1;
+     }
+     fftw_plan_with_nthreads(4);
+     check_thread_local();
+#endif
+
+     in = fftw_alloc_real(NMAX);
+     out = fftw_alloc_real(NMAX);
+     in0 = fftw_alloc_real(NMAX);
+     out0 = fftw_alloc_real(NMAX);
+     ref = fftw_alloc_real(2 * NMAX);
+     for (i = 0; i < NMAX; ++i) {
+	  in0[i] = (double) ((i * 7) % 23) - 11.0;
+	  out0[i] = (double) (i % 5);
+     }
+     restore();
+     X(the_planner)()->hook = audit;
+
+     /* every candidate is executed three times: the sizes are the
+	smallest that reach each solver (8209 for the generic solvers to
+	buffer beyond the stack) */
+     dft(4096, 1, 1, 1, FFTW_MEASURE);
+     dft(101, 1, 1, 1, FFTW_PATIENT);
+     dft(4099, 1, 1, 1, FFTW_ESTIMATE | FFTW_ALLOW_LARGE_GENERIC);
+     dft(64, 256, 256, 1, FFTW_EXHAUSTIVE);
+
+     r2c(4096, 1, 1, 1, FFTW_MEASURE);
+     r2c(509, 1, 1, 1, FFTW_PATIENT);
+     r2c(64, 128, 128, 1, FFTW_EXHAUSTIVE);
+
+     r2r(4096, FFTW_R2HC, FFTW_MEASURE);
+     r2r(4096, FFTW_HC2R, FFTW_MEASURE);
+     r2r(8209, FFTW_R2HC, FFTW_ESTIMATE | FFTW_ALLOW_LARGE_GENERIC);
+     r2r(1009, FFTW_DHT, FFTW_PATIENT);
+     r2r(33, FFTW_REDFT00, FFTW_EXHAUSTIVE);
+     r2r(31, FFTW_RODFT00, FFTW_EXHAUSTIVE);
+     r2r(32, FFTW_REDFT10, FFTW_EXHAUSTIVE);
+     r2r(31, FFTW_REDFT01, FFTW_EXHAUSTIVE);
+     r2r(32, FFTW_REDFT11, FFTW_EXHAUSTIVE);
+     r2r(31, FFTW_RODFT11, FFTW_EXHAUSTIVE);
+
+     transpose(60, 48, FFTW_EXHAUSTIVE);
+     transpose(96, 64, FFTW_EXHAUSTIVE);
+
+     X(the_planner)()->hook = 0;
+#ifdef INTERPOSE
+     /* else the audit proves nothing */
+     if (!nheap)
+	  check_fail("no candidate allocates without a workspace");
+#endif
+     fftw_free(in);
+     fftw_free(out);
+     fftw_free(in0);
+     fftw_free(out0);
+     fftw_free(ref);
+#ifdef USE_THREADS
+     fftw_cleanup_threads();
+#else
+     fftw_cleanup();
+#endif
+
+     return check_exit();
+}
@@ -0,0 +1,183 @@
+/*
+ * Robust timing check.
+ *
+ * usage: robust-timing-check [nrounds]
+ *
+ * Plans a set of sizes NROUNDS times (default 4) with FFTW_MEASURE and
+ * fftw_set_robust_timing(2), forgetting wisdom in between.  Checks that
+ *   - where the threads library is there, X(measure_pin_hook) binds
+ *     the calling thread to the one cpu it runs on, and
+ *     X(measure_unpin_hook) gives it back the cpus it had,
+ *   - every replan is the plan chosen the first time, or one that is
+ *     as fast within TIE when the two are run in turns (twice, if
+ *     the first time says otherwise): plans that close are equally
+ *     good, and which of them wins is up to the noise.
+ * Prints how many replans were the same plan, for information.
+ */
+
+#ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+#endif
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/api.h"
+#include "tests/check.h"
+
+static const int sizes[] = { 64, 100, 256, 360, 1024, 4096 };
+#define NSIZES ((int)(sizeof(sizes) / sizeof(sizes[0])))
+
+#define MAXROUNDS 16
+#define TIE 0.10
+#define PAIRS 15
+#define SAMPLE_SEC 2.0e-3
+
+static void check_pin(void)
+{
+#if defined(__linux__) && defined(CPU_SETSIZE)
+     cpu_set_t before, pinned, after;
+     void *saved;
+
+     if (!X(measure_pin_hook))
+	  return;
+     sched_getaffinity(0, sizeof(before), &before);
+     saved = X(measure_pin_hook)();
+     if (!saved) {
+	  check_fail("measure_pin_hook did not pin");
+	  return;
+     }
+     sched_getaffinity(0, sizeof(pinned), &pinned);
+     if (CPU_COUNT(&pinned) != 1 || !CPU_ISSET(sched_getcpu(), &pinned))
+	  check_fail("pinned to %d cpus, not to the one it runs on",
+		     CPU_COUNT(&pinned));
+     X(measure_unpin_hook)(saved);
+     sched_getaffinity(0, sizeof(after), &after);
+     if (!CPU_EQUAL(&before, &after))
+	  check_fail("unpinning did not restore the affinity");
+#endif
+}
+
+/* seconds per execution of P over a sample of about SAMPLE_SEC */
+static double sample(fftw_plan p, int reps)
+{
+     double t0 = check_now();
+     int i;
+
+     for (i = 0; i < reps; ++i)
+	  fftw_execute(p);
+     return (check_now() - t0) / reps;
+}
+
+static int reps_for(fftw_plan p)
+{
+     int reps = 1;
+
+     while (sample(p, reps) * reps < SAMPLE_SEC)
+	  reps *= 2;
+     return reps;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+     double x = *(const double *)a, y = *(const double *)b;
+     return (x > y) - (x < y);
+}
+
+/* median over PAIRS turns of the time of B over that of A */
+static double paired_ratio(fftw_plan a, fftw_plan b)
+{
+     double r[PAIRS];
+     int ra = reps_for(a), rb = reps_for(b), i;
+
+     for (i = 0; i < PAIRS; ++i) {
+	  double ta, tb;
+	  if (i % 2) {
+	       tb = sample(b, rb);
+	       ta = sample(a, ra);
+	  } else {
+	       ta = sample(a, ra);
+	       tb = sample(b, rb);
+	  }
+	  r[i] = tb / ta;
+     }
+     qsort(r, PAIRS, sizeof(double), cmp_double);
+     return r[PAIRS / 2];
+}
+
+int main(int argc, char **argv)
+{
+     fftw_complex *in[NSIZES], *out[NSIZES];
+     fftw_plan first[NSIZES];
+     char *first_s[NSIZES];
+     int nrounds = 4, r, j, same = 0, replans = 0;
+     double worst = 1.0;
+
+     if (argc > 1)
+	  nrounds = atoi(argv[1]);
+     if (nrounds < 2 || nrounds > MAXROUNDS) {
+	  fprintf(stderr, "usage: robust-timing-check [nrounds]\n");
+	  return 2;
+     }
+
+#ifdef USE_THREADS
+     fftw_init_threads();
+#endif
+     check_pin();
+     fftw_set_robust_timing(2);
+
+     for (j = 0; j < NSIZES; ++j) {
+	  in[j] = fftw_alloc_complex(sizes[j]);
+	  out[j] = fftw_alloc_complex(sizes[j]);
+     }
+
+     for (r = 0; r < nrounds; ++r) {
+	  for (j = 0; j < NSIZES; ++j) {
+	       fftw_plan p = fftw_plan_dft_1d(sizes[j], in[j], out[j],
+					      FFTW_FORWARD, FFTW_MEASURE);
+	       char *s = fftw_sprint_plan(p);
+
+	       if (r == 0) {
+		    first[j] = p;
+		    first_s[j] = s;
+		    continue;
+	       }
+
+	       ++replans;
+	       if (!strcmp(s, first_s[j])) {
+		    ++same;
+	       } else {
+		    double ratio = paired_ratio(first[j], p);
+		    if (ratio > 1.0 + TIE) /* a burst of noise? */
+			 ratio = paired_ratio(first[j], p);
+		    if (ratio > worst)
+			 worst = ratio;
+		    if (ratio > 1.0 + TIE)
+			 check_fail("n=%d round %d: %s is %.1f%% slower "
+				    "than %s", sizes[j], r, s,
+				    100.0 * (ratio - 1.0), first_s[j]);
+	       }
+	       free(s);
+	       fftw_destroy_plan(p);
+	  }
+	  fftw_forget_wisdom();
+     }
+
+     printf("%d of %d replans the same; the others at most %.1f%% "
+	    "slower\n", same, replans, 100.0 * (worst - 1.0));
+
+     for (j = 0; j < NSIZES; ++j) {
+	  free(first_s[j]);
+	  fftw_destroy_plan(first[j]);
+	  fftw_free(in[j]);
+	  fftw_free(out[j]);
+     }
+     fftw_set_robust_timing(0);
+#ifdef USE_THREADS
+     fftw_cleanup_threads();
+#else
+     fftw_cleanup();
+#endif
+     return check_exit();
+}
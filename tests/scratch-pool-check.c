@@ -0,0 +1,116 @@
+/*
+ * Scratch pool check.
+ *
+ * usage: scratch-pool-check
+ *
+ * Executes, over and over, NPLAN r2r plans of nearby sizes whose
+ * solvers allocate buffers while they execute, and checks that
+ *   - they compute exactly what they do with the pool turned off,
+ *   - after the first round, the buffers all come from the pool (the
+ *     misses stop growing, the hits grow),
+ *   - the pool holds well less than the buffers of all the plans,
+ *   - fftw_set_scratch_pool(0) gives every buffer back.
+ * The pool statistics are printed for information.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/fftw3.h"
+#include "tests/check.h"
+
+#define N0 1000
+#define NPLAN 16
+#define NROUND 50
+
+static fftw_plan p[NPLAN];
+static double *in, *out, *ref[NPLAN];
+
+static void round_all(void)
+{
+     int k;
+
+     for (k = 0; k < NPLAN; ++k)
+	  fftw_execute_r2r(p[k], in, out);
+}
+
+int main(void)
+{
+     size_t bytes, peak, need = 0, most = 0;
+     double hits, misses, trimmed, hits1, misses1, trimmed1;
+     int k, i, r;
+
+     if (!fftw_init_threads()) {
+	  printf("threads not available\n");
+	  return 0;
+     }
+
+     in = fftw_alloc_real(N0 + NPLAN);
+     out = fftw_alloc_real(N0 + NPLAN);
+     for (i = 0; i < N0 + NPLAN; ++i)
+	  in[i] = (double) ((i * 7) % 23) - 11.0;
+     for (k = 0; k < NPLAN; ++k) {
+	  p[k] = fftw_plan_r2r_1d(N0 + k, in, out, FFTW_REDFT00,
+				  FFTW_ESTIMATE);
+	  ref[k] = fftw_alloc_real(N0 + k);
+	  need += fftw_plan_scratch_size(p[k]);
+	  if (fftw_plan_scratch_size(p[k]) > most)
+	       most = fftw_plan_scratch_size(p[k]);
+     }
+
+     /* reference, without the pool */
+     fftw_set_scratch_pool(0);
+     for (k = 0; k < NPLAN; ++k)
+	  fftw_execute_r2r(p[k], in, ref[k]);
+
+     fftw_set_scratch_pool((size_t) 64 * 1024 * 1024);
+     round_all();
+     fftw_scratch_pool_stats(0, 0, 0, &misses1, 0);
+     if (misses1 <= 0)
+	  check_fail("no buffer allocated: the check is vacuous");
+     fftw_scratch_pool_stats(0, 0, &hits1, 0, 0);
+     for (r = 0; r < NROUND; ++r)
+	  round_all();
+     fftw_scratch_pool_stats(&bytes, &peak, &hits, &misses, &trimmed);
+     printf("%d plans, %d rounds: %lu bytes (peak %lu) for %lu needed "
+	    "(%lu by the largest), %g hits, %g misses, %g trimmed\n",
+	    NPLAN, NROUND + 1, (unsigned long) bytes, (unsigned long) peak,
+	    (unsigned long) need, (unsigned long) most, hits, misses,
+	    trimmed);
+     if (misses != misses1)
+	  check_fail("buffers still allocated after the first round");
+     if (hits < hits1 + NROUND * misses1)
+	  check_fail("buffers not taken from the pool");
+     if (bytes == 0 || bytes > need / 2)
+	  check_fail("pool holds the buffers of every plan");
+
+     for (k = 0; k < NPLAN; ++k) {
+	  memset(out, 0, sizeof(double) * (N0 + k));
+	  fftw_execute_r2r(p[k], in, out);
+	  if (memcmp(out, ref[k], sizeof(double) * (N0 + k)))
+	       break;
+     }
+     if (k < NPLAN)
+	  check_fail("transform differs with the pool");
+
+     /* without a budget, the idle buffers go back at the next trim */
+     fftw_set_scratch_pool(0);
+     for (r = 0; r < NROUND; ++r)
+	  round_all();
+     fftw_scratch_pool_stats(&bytes, 0, 0, 0, &trimmed1);
+     if (bytes != 0)
+	  check_fail("fftw_set_scratch_pool(0) keeps buffers");
+     if (trimmed1 <= trimmed)
+	  check_fail("nothing trimmed");
+
+     for (k = 0; k < NPLAN; ++k) {
+	  fftw_destroy_plan(p[k]);
+	  fftw_free(ref[k]);
+     }
+     fftw_free(in);
+     fftw_free(out);
+     fftw_cleanup_threads();
+
+     return check_exit();
+}
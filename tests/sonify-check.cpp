@@ -0,0 +1,399 @@
+// Ҹ  ȸ/ ϳ׽ (PortAudio  renderBlock  )
+//
+// : sonify-check [--update] [--report FILE] GOLDEN
+//         sonify-check --rt-guard-selftest
+//
+// ̽ (  , ̽ , ȭ )  ü  ϰ
+// - 16Ʈ ȭ  FNV-1a ؽð   
+// - ؽð ٸ (ٸ libm )  RMS  ̵/̵ 뿪
+//   Ʈ SNR    ̸̻  (δ ̳
+//   ä   ٲ   )
+// -     Ҵ з ó
+//   (SONIFY_RT_GUARD 忡 malloc//ŷ ȣ rtguard  ˻)
+//  (ns/frame, ־  ð, Ҵ )  JSON  
+
+#include "libbench2/sonify.h"
+#include "libbench2/rtguard.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 1.    Ҵ Ƚ (operator new/delete    ü
+//    new    ׻ ¦ ´ delete  ư )
+static bool countAllocs = false;
+static unsigned long allocCount = 0;
+
+static void* countedAlloc(std::size_t n, std::size_t align) {
+    if (countAllocs) ++allocCount;
+    if (n == 0) n = 1;
+    void* p;
+    if (align <= alignof(std::max_align_t)) p = std::malloc(n);
+    else p = std::aligned_alloc(align, (n + align - 1) / align * align);
+    return p;
+}
+
+static void countedFree(void* p) noexcept { std::free(p); }
+
+static void* countedNew(std::size_t n, std::size_t align) {
+    void* p = countedAlloc(n, align);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t n) { return countedNew(n, 0); }
+void* operator new[](std::size_t n) { return countedNew(n, 0); }
+void* operator new(std::size_t n, std::align_val_t a) { return countedNew(n, (std::size_t)a); }
+void* operator new[](std::size_t n, std::align_val_t a) { return countedNew(n, (std::size_t)a); }
+void* operator new(std::size_t n, const std::nothrow_t&) noexcept { return countedAlloc(n, 0); }
+void* operator new[](std::size_t n, const std::nothrow_t&) noexcept { return countedAlloc(n, 0); }
+
+void operator delete(void* p) noexcept { countedFree(p); }
+void operator delete[](void* p) noexcept { countedFree(p); }
+void operator delete(void* p, std::size_t) noexcept { countedFree(p); }
+void operator delete[](void* p, std::size_t) noexcept { countedFree(p); }
+void operator delete(void* p, std::align_val_t) noexcept { countedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { countedFree(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { countedFree(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { countedFree(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { countedFree(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { countedFree(p); }
+
+constexpr int ENVELOPE_BANDS = 32;
+constexpr int SPECTRUM_BANDS = 48;        // 40 Hz ~ Ʈ, α 
+constexpr int SPECTRUM_FRAME = 4096;
+constexpr double SPECTRUM_LO_HZ = 40.0;
+constexpr double SNR_THRESHOLD_DB = 40.0;
+
+struct Case {
+    const char* name;
+    int numPoints;
+    int numVoices;
+    SpatialMode spatial;
+    unsigned int samplesPerStep;
+};
+
+static const Case cases[] = {
+    { "pan-v1-n30",   30,  1, SPATIAL_PAN,  SAMPLE_RATE / 4 },
+    { "room-v1-n30",  30,  1, SPATIAL_ROOM, SAMPLE_RATE / 4 },
+    { "pan-v4-n60",   60,  4, SPATIAL_PAN,  SAMPLE_RATE / 8 },
+    { "room-v4-n60",  60,  4, SPATIAL_ROOM, SAMPLE_RATE / 8 },
+    { "room-v16-n30", 30, 16, SPATIAL_ROOM, SAMPLE_RATE / 8 },
+};
+
+struct Golden {
+    std::string hash;
+    double envelope[ENVELOPE_BANDS];
+    double spectrum[2 * SPECTRUM_BANDS];
+};
+
+struct Result {
+    std::string hash;
+    double envelope[ENVELOPE_BANDS];
+    double spectrum[2 * SPECTRUM_BANDS];    // ̵, ̵
+    unsigned long frames;
+    unsigned long blocks;
+    double nsPerFrame;
+    double worstBlockUs;
+    unsigned long allocs;
+    unsigned long rtViolations;
+    double snrDb;
+    bool pass;
+};
+
+// 2. 뿪 Ʈ: ش â  Ŀ  (Welch)  α 
+//    뿪 RMS ũ. ̵(L+R) ̵(L-R)  ξ ä   
+static void fft(std::vector<std::complex<double>>& a) {
+    size_t n = a.size();
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(a[i], a[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        std::complex<double> w = std::polar(1.0, -2.0 * M_PI / (double)len);
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> wk = 1.0;
+            for (size_t k = 0; k < len / 2; ++k, wk *= w) {
+                std::complex<double> u = a[i + k], v = a[i + k + len / 2] * wk;
+                a[i + k] = u + v;
+                a[i + k + len / 2] = u - v;
+            }
+        }
+    }
+}
+
+static void bandSpectrum(const std::vector<float>& output, double* spectrum) {
+    size_t frames = output.size() / 2;
+    std::vector<double> power[2] = {
+        std::vector<double>(SPECTRUM_FRAME / 2), std::vector<double>(SPECTRUM_FRAME / 2)
+    };
+    std::vector<std::complex<double>> buf(SPECTRUM_FRAME);
+    int count = 0;
+
+    for (size_t f0 = 0; f0 + SPECTRUM_FRAME <= frames; f0 += SPECTRUM_FRAME / 2, ++count) {
+        for (int ch = 0; ch < 2; ++ch) {
+            for (int i = 0; i < SPECTRUM_FRAME; ++i) {
+                double l = output[2 * (f0 + i)], r = output[2 * (f0 + i) + 1];
+                double w = 0.5 - 0.5 * cos(2.0 * M_PI * i / SPECTRUM_FRAME);
+                buf[i] = w * (ch == 0 ? l + r : l - r);
+            }
+            fft(buf);
+            for (int k = 0; k < SPECTRUM_FRAME / 2; ++k) power[ch][k] += std::norm(buf[k]);
+        }
+    }
+
+    double ratio = (SAMPLE_RATE / 2.0) / SPECTRUM_LO_HZ;
+    for (int ch = 0; ch < 2; ++ch)
+        for (int b = 0; b < SPECTRUM_BANDS; ++b) {
+            double flo = SPECTRUM_LO_HZ * pow(ratio, (double)b / SPECTRUM_BANDS);
+            double fhi = SPECTRUM_LO_HZ * pow(ratio, (double)(b + 1) / SPECTRUM_BANDS);
+            int lo = (int)(flo * SPECTRUM_FRAME / SAMPLE_RATE);
+            int hi = std::max(lo + 1, (int)(fhi * SPECTRUM_FRAME / SAMPLE_RATE));
+            double e = 0.0;
+            for (int k = lo; k < hi && k < SPECTRUM_FRAME / 2; ++k) e += power[ch][k];
+            spectrum[ch * SPECTRUM_BANDS + b] = count ? sqrt(e / count) / SPECTRUM_FRAME : 0.0;
+        }
+}
+
+// 3.  ̽  + 
+static void runCase(const Case& c, Result& r) {
+    SonifyConfig cfg = defaultSonifyConfig();
+    cfg.numPoints = c.numPoints;
+    cfg.numVoices = c.numVoices;
+    cfg.spatial = c.spatial;
+    cfg.samplesPerStep = c.samplesPerStep;
+    sonifyInit(cfg);
+
+    //   +   ̸ Ȯ (  ۿ)
+    unsigned long total = (unsigned long)c.numPoints * c.samplesPerStep + 2 * FRAMES_PER_BUFFER;
+    std::vector<float> output;
+    output.reserve(total * 2);
+    std::vector<float> block(FRAMES_PER_BUFFER * 2);
+
+    typedef std::chrono::steady_clock clock;
+    double totalNs = 0.0, worstNs = 0.0;
+    r.blocks = 0;
+    allocCount = 0;
+    unsigned long rt0 = rtGuardViolations();
+
+    for (;;) {
+        countAllocs = true;
+        clock::time_point t0 = clock::now();
+        bool done;
+        {
+            RtGuardScope guard;
+            done = renderBlock(block.data(), FRAMES_PER_BUFFER);
+        }
+        clock::time_point t1 = clock::now();
+        countAllocs = false;
+
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+        totalNs += ns;
+        if (ns > worstNs) worstNs = ns;
+        ++r.blocks;
+
+        if (done) break;
+        output.insert(output.end(), block.begin(), block.end());
+    }
+
+    r.allocs = allocCount;
+    r.rtViolations = rtGuardViolations() - rt0;
+    r.frames = (unsigned long)(output.size() / 2);
+    r.nsPerFrame = totalNs / (r.blocks * (double)FRAMES_PER_BUFFER);
+    r.worstBlockUs = worstNs / 1000.0;
+
+    // 16Ʈ ȭ  FNV-1a 64
+    uint64_t h = 14695981039346656037ULL;
+    for (float x : output) {
+        long q = lrint((double)x * 32767.0);
+        if (q > 32767) q = 32767;
+        if (q < -32768) q = -32768;
+        uint16_t u = (uint16_t)(int16_t)q;
+        h = (h ^ (u & 0xff)) * 1099511628211ULL;
+        h = (h ^ (u >> 8)) * 1099511628211ULL;
+    }
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)h);
+    r.hash = buf;
+
+    //  RMS 
+    size_t n = output.size();
+    for (int b = 0; b < ENVELOPE_BANDS; ++b) {
+        size_t lo = n * b / ENVELOPE_BANDS, hi = n * (b + 1) / ENVELOPE_BANDS;
+        double e = 0.0;
+        for (size_t i = lo; i < hi; ++i) e += (double)output[i] * output[i];
+        r.envelope[b] = hi > lo ? sqrt(e / (hi - lo)) : 0.0;
+    }
+    bandSpectrum(output, r.spectrum);
+}
+
+static double bandSnr(const double* ref, const double* cur, int bands) {
+    double s = 0.0, d = 0.0;
+    for (int b = 0; b < bands; ++b) {
+        s += ref[b] * ref[b];
+        d += (ref[b] - cur[b]) * (ref[b] - cur[b]);
+    }
+    if (d == 0.0) return INFINITY;
+    return 10.0 * log10(s / d);
+}
+
+// 4.  : "̸ ؽ x32 ̵x48 ̵x48"  ٿ  ̽
+static std::map<std::string, Golden> readGolden(const char* path) {
+    std::map<std::string, Golden> golden;
+    FILE* f = fopen(path, "r");
+    if (!f) return golden;
+    char name[64], hash[32];
+    while (fscanf(f, "%63s %31s", name, hash) == 2) {
+        Golden g;
+        g.hash = hash;
+        for (int b = 0; b < ENVELOPE_BANDS; ++b)
+            if (fscanf(f, "%lf", &g.envelope[b]) != 1) g.envelope[b] = 0.0;
+        for (int b = 0; b < 2 * SPECTRUM_BANDS; ++b)
+            if (fscanf(f, "%lf", &g.spectrum[b]) != 1) g.spectrum[b] = 0.0;
+        golden[name] = g;
+    }
+    fclose(f);
+    return golden;
+}
+
+static bool writeGolden(const char* path, const std::vector<Result>& results) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    for (size_t i = 0; i < results.size(); ++i) {
+        fprintf(f, "%s %s", cases[i].name, results[i].hash.c_str());
+        for (int b = 0; b < ENVELOPE_BANDS; ++b)
+            fprintf(f, " %.9g", results[i].envelope[b]);
+        for (int b = 0; b < 2 * SPECTRUM_BANDS; ++b)
+            fprintf(f, " %.9g", results[i].spectrum[b]);
+        fprintf(f, "\n");
+    }
+    fclose(f);
+    return true;
+}
+
+static void writeReport(FILE* f, const std::vector<Result>& results) {
+    fprintf(f, "[\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        fprintf(f, "  {\"case\": \"%s\", \"voices\": %d, \"spatial\": \"%s\", "
+            "\"frames\": %lu, \"blocks\": %lu, \"ns_per_frame\": %.2f, "
+            "\"worst_block_us\": %.2f, \"hot_path_allocs\": %lu, "
+            "\"rt_violations\": %lu, "
+            "\"hash\": \"%s\", \"snr_db\": %.2f, \"pass\": %s}%s\n",
+            cases[i].name, cases[i].numVoices,
+            cases[i].spatial == SPATIAL_ROOM ? "room" : "pan",
+            r.frames, r.blocks, r.nsPerFrame, r.worstBlockUs, r.allocs, r.rtViolations,
+            r.hash.c_str(), std::isinf(r.snrDb) ? (r.snrDb > 0 ? 999.0 : -999.0) : r.snrDb,
+            r.pass ? "true" : "false", i + 1 < results.size() ? "," : "");
+    }
+    fprintf(f, "]\n");
+}
+
+// 5. rtguard ü ˻: Ϻη Ҵ//sleep  ϰ   Ȯ
+static int rtGuardSelfTest() {
+#ifdef SONIFY_RT_GUARD
+    static std::mutex m;
+    unsigned long before = rtGuardViolations();
+    {
+        RtGuardScope guard;
+        void* volatile p = malloc(64);
+        free(p);
+        m.lock();
+        m.unlock();
+        std::this_thread::sleep_for(std::chrono::microseconds(1));
+    }
+    unsigned long caught = rtGuardViolations() - before;
+    unsigned long logged = rtGuardDrain(stdout);
+    printf("rt-guard self test: %lu violations caught, %lu logged (expected 4)\n",
+        caught, logged);
+    return caught == 4 && logged == 4 ? 0 : 1;
+#else
+    printf("rt-guard self test: not built with SONIFY_RT_GUARD\n");
+    return 0;
+#endif
+}
+
+int main(int argc, char* argv[]) {
+    bool update = false;
+    const char* reportPath = nullptr;
+    const char* goldenPath = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--update")) update = true;
+        else if (!strcmp(argv[i], "--rt-guard-selftest")) {
+            rtGuardInit(false);
+            return rtGuardSelfTest();
+        }
+        else if (!strcmp(argv[i], "--report") && i + 1 < argc) reportPath = argv[++i];
+        else goldenPath = argv[i];
+    }
+    if (!goldenPath) {
+        fprintf(stderr, "usage: %s [--update] [--report FILE] GOLDEN\n", argv[0]);
+        return 2;
+    }
+
+    rtGuardInit(false);
+
+    std::map<std::string, Golden> golden = readGolden(goldenPath);
+    std::vector<Result> results(sizeof(cases) / sizeof(cases[0]));
+    bool ok = true;
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        Result& r = results[i];
+        runCase(cases[i], r);
+
+        std::map<std::string, Golden>::const_iterator g = golden.find(cases[i].name);
+        if (update) {
+            r.snrDb = INFINITY;
+            r.pass = r.allocs == 0 && r.rtViolations == 0;
+        } else if (g == golden.end()) {
+            r.snrDb = -INFINITY;
+            r.pass = false;
+        } else {
+            r.snrDb = g->second.hash == r.hash ? INFINITY
+                : std::min(bandSnr(g->second.envelope, r.envelope, ENVELOPE_BANDS),
+                           bandSnr(g->second.spectrum, r.spectrum, 2 * SPECTRUM_BANDS));
+            r.pass = r.snrDb >= SNR_THRESHOLD_DB && r.allocs == 0 && r.rtViolations == 0;
+        }
+        ok = ok && r.pass;
+
+        rtGuardDrain(stdout);
+        printf("%-14s %s  %8.2f ns/frame  worst %8.2f us  allocs %lu  rt %lu  snr %s  %s\n",
+            cases[i].name, r.hash.c_str(), r.nsPerFrame, r.worstBlockUs, r.allocs,
+            r.rtViolations,
+            std::isinf(r.snrDb) ? (r.snrDb > 0 ? "exact" : "missing")
+                : std::to_string(r.snrDb).c_str(),
+            r.pass ? "ok" : "FAIL");
+    }
+
+    if (update && !writeGolden(goldenPath, results)) {
+        fprintf(stderr, "cannot write %s\n", goldenPath);
+        return 2;
+    }
+
+    if (reportPath) {
+        FILE* f = fopen(reportPath, "w");
+        if (!f) {
+            fprintf(stderr, "cannot write %s\n", reportPath);
+            return 2;
+        }
+        writeReport(f, results);
+        fclose(f);
+    }
+
+    return ok ? 0 : 1;
+}
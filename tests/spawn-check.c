@@ -0,0 +1,157 @@
+/*
+ * Thread spawning check and spawn-and-join microbenchmark.
+ *
+ * usage: spawn-check [maxthreads]
+ *
+ * Calls the threads library's X(spawn_loop) directly.  Checks that
+ *   - every iteration runs exactly once, on a thread number below the
+ *     number of threads, for loops of any length,
+ *   - loops spawned from several threads at once, and loops nested in
+ *     loops, which cannot all have the spinning pool, still do.
+ * Then prints the time of an empty spawn_loop against the number of
+ * threads: on the pool, with and without spinning, and on the
+ * semaphore queue that it falls back to.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/api.h"
+#include "threads/threads.h"
+#include "tests/check.h"
+
+#define MAXTHR 16
+#define MAXLOOP 100
+#define NCONC 4
+#define NREP 2000
+
+typedef struct {
+     int nthr;
+     int hits[MAXLOOP];
+     int bad_thr;
+} count_data;
+
+static void *count(spawn_data *d)
+{
+     count_data *c = (count_data *) d->data;
+     int i;
+
+     if (d->thr_num < 0 || d->thr_num >= c->nthr)
+	  c->bad_thr = 1;
+     for (i = d->min; i < d->max; ++i)
+	  ++c->hits[i];
+     return 0;
+}
+
+/* one loop of each length on NTHR threads */
+static void check_loops(int nthr)
+{
+     count_data c;
+     int n, i;
+
+     for (n = 0; n < MAXLOOP; ++n) {
+	  memset(&c, 0, sizeof(c));
+	  c.nthr = nthr;
+	  fftw_spawn_loop(n, nthr, count, &c);
+	  for (i = 0; i < MAXLOOP; ++i)
+	       if (c.hits[i] != (i < n))
+		    break;
+	  if (i < MAXLOOP)
+	       check_fail("iteration missed or repeated (%d)", n);
+	  if (c.bad_thr)
+	       check_fail("thread number out of range (%d)", nthr);
+     }
+}
+
+static void *conc_thread(void *arg)
+{
+     int r;
+
+     (void) arg;
+     for (r = 0; r < 50; ++r)
+	  check_loops(3);
+     return 0;
+}
+
+static void *nested(spawn_data *d)
+{
+     (void) d;
+     check_loops(2);
+     return 0;
+}
+
+static void *empty(spawn_data *d)
+{
+     (void) d;
+     return 0;
+}
+
+/* microseconds per empty spawn_loop on NTHR threads */
+static double spawn_us(int nthr)
+{
+     double t0;
+     int r;
+
+     fftw_spawn_loop(nthr, nthr, empty, 0); /* start the workers */
+     t0 = check_now();
+     for (r = 0; r < NREP; ++r)
+	  fftw_spawn_loop(nthr, nthr, empty, 0);
+     return (check_now() - t0) / NREP * 1.0e6;
+}
+
+/* the same, while the pool is held by an enclosing loop */
+static int bench_nthr;
+static double queue_time;
+
+static void *queue_bench(spawn_data *d)
+{
+     if (d->thr_num == 1)
+	  queue_time = spawn_us(bench_nthr);
+     return 0;
+}
+
+int main(int argc, char *argv[])
+{
+     pthread_t tid[NCONC];
+     int maxthr = 8, nthr, i;
+
+     if (argc > 1)
+	  maxthr = atoi(argv[1]);
+     if (maxthr < 1 || maxthr > MAXTHR)
+	  maxthr = 8;
+
+     if (!fftw_init_threads()) {
+	  printf("threads not available\n");
+	  return 0;
+     }
+
+     for (nthr = 1; nthr <= maxthr; ++nthr)
+	  check_loops(nthr);
+
+     for (i = 0; i < NCONC; ++i)
+	  pthread_create(&tid[i], 0, conc_thread, 0);
+     for (i = 0; i < NCONC; ++i)
+	  pthread_join(tid[i], 0);
+
+     fftw_spawn_loop(4, 4, nested, 0);
+
+     printf("us per spawn and join: threads, spinning pool, sleeping pool, "
+	    "queue\n");
+     for (nthr = 1; nthr <= maxthr; nthr *= 2) {
+	  double spin, sleep;
+
+	  fftw_threads_set_spin(50.0e-6);
+	  spin = spawn_us(nthr);
+	  fftw_threads_set_spin(0);
+	  sleep = spawn_us(nthr);
+	  bench_nthr = nthr;
+	  fftw_spawn_loop(2, 2, queue_bench, 0);
+	  printf("%d %.3g %.3g %.3g\n", nthr, spin, sleep, queue_time);
+     }
+
+     fftw_cleanup_threads();
+
+     return check_exit();
+}
@@ -0,0 +1,161 @@
+/*
+ * Work stealing check.
+ *
+ * usage: steal-check [nthreads [nchunk]]
+ *
+ * Plans a batch of small DFTs, a large 1d DFT and a batch of r2c
+ * transforms on NTHREADS threads (default 4), with loops split in one
+ * block per thread and, after fftw_plan_with_work_stealing(NCHUNK)
+ * (default 4), in NCHUNK blocks per thread.  Checks that both compute
+ * the same transforms as a single-threaded plan.  Then times each
+ * plan while another thread keeps a cpu busy, and prints the median
+ * and the 99th percentile of its execute times for information.
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/fftw3.h"
+#include "tests/check.h"
+
+#define NREP 1000
+
+static volatile int loaded = 0;
+
+/* the other work of a shared machine */
+static void *load(void *arg)
+{
+     volatile double x = 1;
+     (void) arg;
+     while (loaded)
+	  x = x * 1.0000001 + 1e-9;
+     return 0;
+}
+
+static int cmp(const void *a, const void *b)
+{
+     double x = *(const double *) a, y = *(const double *) b;
+     return x < y ? -1 : x > y;
+}
+
+typedef struct {
+     const char *name;
+     int rank, n, howmany, r2c;
+} shape;
+
+static const shape shapes[] = {
+     { "256 dfts of 64", 1, 64, 256, 0 },
+     { "dft of 32768", 1, 32768, 1, 0 },
+     { "128 r2c of 256", 1, 256, 128, 1 },
+};
+#define NSHAPES ((int)(sizeof(shapes) / sizeof(shapes[0])))
+
+static fftw_plan plan(const shape *s, double *in, fftw_complex *out)
+{
+     int n = s->n;
+     if (s->r2c)
+	  return fftw_plan_many_dft_r2c(1, &n, s->howmany, in, 0, 1, n,
+					out, 0, 1, n / 2 + 1, FFTW_ESTIMATE);
+     return fftw_plan_many_dft(1, &n, s->howmany, (fftw_complex *) in, 0,
+			       1, n, out, 0, 1, n, FFTW_FORWARD,
+			       FFTW_ESTIMATE);
+}
+
+/* fill IN and transform it with P */
+static void run(fftw_plan p, double *in, size_t nin)
+{
+     size_t i;
+     for (i = 0; i < nin; ++i)
+	  in[i] = sin((double) i * 0.37) + 0.1 * (double) (i % 7);
+     fftw_execute(p);
+}
+
+static void time_plan(fftw_plan p, double *t50, double *t99)
+{
+     static double t[NREP];
+     int r;
+
+     for (r = 0; r < NREP; ++r) {
+	  double t0 = check_now();
+	  fftw_execute(p);
+	  t[r] = check_now() - t0;
+     }
+     qsort(t, NREP, sizeof(double), cmp);
+     *t50 = t[NREP / 2] * 1e6;
+     *t99 = t[NREP * 99 / 100] * 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+     int nthreads = 4, nchunk = 4, k;
+     pthread_t tid;
+
+     if (argc > 1)
+	  nthreads = atoi(argv[1]);
+     if (argc > 2)
+	  nchunk = atoi(argv[2]);
+
+     if (!fftw_init_threads()) {
+	  printf("threads not available\n");
+	  return 0;
+     }
+
+     printf("us per execute on %d threads, one other thread busy: "
+	    "median and p99, static and stealing %d chunks per thread\n",
+	    nthreads, nchunk);
+     for (k = 0; k < NSHAPES; ++k) {
+	  const shape *s = &shapes[k];
+	  size_t nin = (size_t) s->n * s->howmany * (s->r2c ? 1 : 2);
+	  size_t nout = (size_t) (s->r2c ? s->n / 2 + 1 : s->n) * s->howmany;
+	  double *in = fftw_alloc_real(nin);
+	  fftw_complex *out[3];
+	  fftw_plan p[3];
+	  double t50[3], t99[3], err = 0, mag = 0;
+	  size_t i;
+	  int j;
+
+	  for (j = 0; j < 3; ++j) {
+	       out[j] = fftw_alloc_complex(nout);
+	       fftw_plan_with_nthreads(j == 0 ? 1 : nthreads);
+	       fftw_plan_with_work_stealing(j == 2 ? nchunk : 1);
+	       p[j] = plan(s, in, out[j]);
+	       if (!p[j]) {
+		    check_fail("no plan");
+		    return 1;
+	       }
+	       run(p[j], in, nin);
+	  }
+	  for (j = 1; j < 3; ++j)
+	       for (i = 0; i < nout; ++i) {
+		    double dr = out[j][i][0] - out[0][i][0];
+		    double di = out[j][i][1] - out[0][i][1];
+		    err += dr * dr + di * di;
+		    mag += out[0][i][0] * out[0][i][0]
+			 + out[0][i][1] * out[0][i][1];
+	       }
+	  if (sqrt(err / mag) > 1e-14)
+	       check_fail("%s", s->name);
+
+	  loaded = 1;
+	  pthread_create(&tid, 0, load, 0);
+	  for (j = 1; j < 3; ++j)
+	       time_plan(p[j], &t50[j], &t99[j]);
+	  loaded = 0;
+	  pthread_join(tid, 0);
+	  printf("%s: %.3g %.3g, %.3g %.3g\n", s->name,
+		 t50[1], t99[1], t50[2], t99[2]);
+
+	  for (j = 0; j < 3; ++j) {
+	       fftw_destroy_plan(p[j]);
+	       fftw_free(out[j]);
+	  }
+	  fftw_free(in);
+     }
+
+     fftw_cleanup_threads();
+
+     return check_exit();
+}
@@ -0,0 +1,212 @@
+/*
+ * Thread pool check.
+ *
+ * usage: threadpool-check [nstreams]
+ *
+ * Runs NSTREAMS (default 8) application threads that each execute a
+ * 4-thread plan of their own.  Checks that
+ *   - plans executed on a thread pool, bound to one or passed to
+ *     fftw_execute_in_threadpool, compute the same transform as
+ *     without one, whether the pool has fewer threads than the plan
+ *     or is busy with another stream,
+ *   - fftw_threads_set_max_workers caps the workers of the pools and,
+ *     where the system tells (Linux), the threads of the process while
+ *     all streams share the global workers.
+ * Then prints the transforms per second of all streams together, with
+ * the global workers and with a 2-thread pool per pair of streams.
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/fftw3.h"
+#include "tests/check.h"
+
+#define N 4096
+#define HOWMANY 16
+#define MAXSTREAMS 64
+#define NREP 200
+#define MAXWORKERS 6
+
+/* threads of the process, or -1 if unknown */
+static int process_threads(void)
+{
+     FILE *f = fopen("/proc/self/status", "r");
+     char line[256];
+     int n = -1;
+
+     if (!f)
+	  return -1;
+     while (fgets(line, sizeof(line), f))
+	  if (!strncmp(line, "Threads:", 8))
+	       n = atoi(line + 8);
+     fclose(f);
+     return n;
+}
+
+typedef struct {
+     fftw_plan p;
+     fftw_complex *in, *out;
+     fftw_threadpool pool;	/* to execute on, or 0 */
+     int nrep;
+     const fftw_complex *ref;
+} stream;
+
+static void fill(fftw_complex *in)
+{
+     int i;
+     for (i = 0; i < N * HOWMANY; ++i) {
+	  in[i][0] = sin(0.37 * i);
+	  in[i][1] = 0.1 * (i % 7);
+     }
+}
+
+static void *run_stream(void *arg)
+{
+     stream *s = (stream *) arg;
+     int r, i;
+
+     for (r = 0; r < s->nrep; ++r) {
+	  if (s->pool)
+	       fftw_execute_in_threadpool(s->p, s->pool);
+	  else
+	       fftw_execute(s->p);
+     }
+     if (s->ref) {
+	  for (i = 0; i < N * HOWMANY; ++i)
+	       if (s->out[i][0] != s->ref[i][0]
+		   || s->out[i][1] != s->ref[i][1])
+		    break;
+	  if (i < N * HOWMANY)
+	       check_fail("wrong transform on a thread pool");
+     }
+     return 0;
+}
+
+/* run all streams at once; returns the transforms per second */
+static double run_all(stream *s, int nstreams)
+{
+     pthread_t tid[MAXSTREAMS];
+     double t0 = check_now();
+     int k;
+
+     for (k = 0; k < nstreams; ++k)
+	  pthread_create(&tid[k], 0, run_stream, &s[k]);
+     for (k = 0; k < nstreams; ++k)
+	  pthread_join(tid[k], 0);
+     return nstreams * s[0].nrep / (check_now() - t0);
+}
+
+int main(int argc, char *argv[])
+{
+     stream s[MAXSTREAMS];
+     fftw_threadpool pools[MAXSTREAMS];
+     fftw_complex *ref;
+     int nstreams = 8, npools, k, nw, nthr, thr0;
+     int n = N, cpu0 = 0;
+     double global, pooled;
+
+     if (argc > 1)
+	  nstreams = atoi(argv[1]);
+     if (nstreams < 4 || nstreams > MAXSTREAMS)
+	  nstreams = 8;
+     npools = nstreams / 2;
+
+     if (!fftw_init_threads()) {
+	  printf("threads not available\n");
+	  return 0;
+     }
+     thr0 = process_threads();
+
+     ref = fftw_alloc_complex(N * HOWMANY);
+     fftw_plan_with_nthreads(4);
+     for (k = 0; k < nstreams; ++k) {
+	  s[k].in = fftw_alloc_complex(N * HOWMANY);
+	  s[k].out = fftw_alloc_complex(N * HOWMANY);
+	  s[k].p = fftw_plan_many_dft(1, &n, HOWMANY, s[k].in, 0, 1, N,
+				      s[k].out, 0, 1, N, FFTW_FORWARD,
+				      FFTW_ESTIMATE);
+	  fill(s[k].in);
+	  s[k].pool = 0;
+	  s[k].nrep = 1;
+	  s[k].ref = ref;
+     }
+     fftw_plan_with_nthreads(1);
+     {
+	  fftw_plan p = fftw_plan_many_dft(1, &n, HOWMANY, s[0].in, 0, 1, N,
+					   ref, 0, 1, N, FFTW_FORWARD,
+					   FFTW_ESTIMATE);
+	  fftw_execute(p);
+	  fftw_destroy_plan(p);
+     }
+
+     /* a pool per pair of streams, two of which get a worker within the
+        limit and the others none; all must compute the transform */
+     fftw_threads_set_max_workers(2);
+     for (k = nw = 0; k < npools; ++k) {
+	  pools[k] = fftw_threadpool_create(2, &cpu0, 1);
+	  if (!pools[k]) {
+	       printf("thread pools not available\n");
+	       return 0;
+	  }
+	  nw += fftw_threadpool_nthreads(pools[k]) - 1;
+     }
+     if (nw != 2)
+	  check_fail("pools beyond the limit on workers");
+     for (k = 0; k < nstreams; ++k)
+	  s[k].pool = pools[k / 2];
+     run_all(s, nstreams);
+
+     /* a bound plan, on a pool smaller than the plan */
+     fftw_plan_set_threadpool(s[0].p, pools[0]);
+     s[0].pool = 0;
+     memset(s[0].out, 0, sizeof(fftw_complex) * N * HOWMANY);
+     run_stream(&s[0]);
+     fftw_plan_set_threadpool(s[0].p, 0);
+     for (k = 0; k < npools; ++k)
+	  fftw_threadpool_destroy(pools[k]);
+
+     /* all streams on the global workers, within the limit */
+     fftw_threads_set_max_workers(MAXWORKERS);
+     for (k = 0; k < nstreams; ++k)
+	  s[k].pool = 0;
+     run_all(s, nstreams);
+     nthr = process_threads();
+     if (thr0 >= 0 && nthr > thr0 + MAXWORKERS)
+	  check_fail("more workers than the limit");
+
+     /* throughput, without a limit */
+     fftw_threads_set_max_workers(0);
+     for (k = 0; k < nstreams; ++k) {
+	  s[k].nrep = NREP;
+	  s[k].ref = 0;
+     }
+     global = run_all(s, nstreams);
+     for (k = 0; k < npools; ++k)
+	  pools[k] = fftw_threadpool_create(2, 0, 0);
+     for (k = 0; k < nstreams; ++k)
+	  s[k].pool = pools[k / 2];
+     pooled = run_all(s, nstreams);
+
+     printf("%d streams of %d dfts of %d, transforms per second: "
+	    "global workers %.3g, a 2-thread pool per pair %.3g\n",
+	    nstreams, HOWMANY, N, global, pooled);
+     if (thr0 >= 0)
+	  printf("threads: %d at start, %d with the limit of %d workers\n",
+		 thr0, nthr, MAXWORKERS);
+
+     for (k = 0; k < npools; ++k)
+	  fftw_threadpool_destroy(pools[k]);
+     for (k = 0; k < nstreams; ++k) {
+	  fftw_destroy_plan(s[k].p);
+	  fftw_free(s[k].in);
+	  fftw_free(s[k].out);
+     }
+     fftw_free(ref);
+     fftw_cleanup_threads();
+
+     return check_exit();
+}
@@ -0,0 +1,411 @@
+/*
+ * Binary wisdom check.
+ *
+ * usage: wisdom-check [directory]
+ *
+ * Plans a set of sizes with FFTW_MEASURE, writes the wisdom in binary
+ * form to DIRECTORY (default: the current one) and checks that
+ *   - after fftw_forget_wisdom(), importing it makes every size
+ *     plannable with FFTW_WISDOM_ONLY again,
+ *   - the text wisdom exported from it is the text wisdom we started
+ *     with,
+ *   - an image of another configuration, or a truncated one, is
+ *     refused, and one of another fast hash is used without its filter,
+ *   - NMANY problems planned from imported wisdom, binary and text,
+ *     get the plans they were exported with, and problems that were
+ *     never planned get no wisdom (the planner keys its tables, and
+ *     the images' filters, by a fast hash rather than MD5),
+ *   - importing an image of a million slots takes about as long as
+ *     importing a small one (it is mapped, not read),
+ *   - on POSIX systems, wisdom that processes publish to a shared
+ *     wisdom file, while planning at the same time (one of them being
+ *     killed halfway), is wisdom for every process that attaches it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define HAVE_FORK 1
+#endif
+
+#include "api/fftw3.h"
+#include "tests/check.h"
+
+static const int sizes[] = { 16, 17, 24, 60, 64, 97, 128, 243, 256, 360,
+			     512, 1000, 1024 };
+#define NSIZES ((int)(sizeof(sizes) / sizeof(sizes[0])))
+
+/* offsets in the binary header (see kernel/planner.c) */
+#define HDR_CONFIG 16
+#define HDR_NSLOT 32
+#define HDR_UNFILTERED 40
+#define HDR_FASTHASH 44
+#define HDR_SIZE 48
+#define ENTRY_SIZE 40
+#define SLOT_SIZE (ENTRY_SIZE + 4)	/* with its filter word */
+
+static char dir[1024] = ".";
+
+static const char *path(const char *name)
+{
+     static char buf[2][1100];
+     static int k = 0;
+     k ^= 1;
+     sprintf(buf[k], "%s/%s", dir, name);
+     return buf[k];
+}
+
+static int plan_size(int n, unsigned flags)
+{
+     fftw_complex *in = fftw_alloc_complex(n), *out = fftw_alloc_complex(n);
+     fftw_plan p = fftw_plan_dft_1d(n, in, out, FFTW_FORWARD, flags);
+     int ok = p != 0;
+     if (p) fftw_destroy_plan(p);
+     fftw_free(in);
+     fftw_free(out);
+     return ok;
+}
+
+static void expect_wisdom(int expect, const char *what)
+{
+     int j;
+     for (j = 0; j < NSIZES; ++j)
+	  if (plan_size(sizes[j], FFTW_MEASURE | FFTW_WISDOM_ONLY) != expect)
+	       check_fail("%s (n = %d)", what, sizes[j]);
+}
+
+static unsigned char *slurp(const char *fname, long *n)
+{
+     FILE *f = fopen(fname, "rb");
+     unsigned char *b;
+     if (!f) return 0;
+     fseek(f, 0, SEEK_END);
+     *n = ftell(f);
+     fseek(f, 0, SEEK_SET);
+     b = (unsigned char *) malloc(*n);
+     if (fread(b, 1, *n, f) != (size_t) *n) { free(b); b = 0; }
+     fclose(f);
+     return b;
+}
+
+static int spit(const char *fname, const unsigned char *b, long n)
+{
+     FILE *f = fopen(fname, "wb");
+     int ok;
+     if (!f) return 0;
+     ok = fwrite(b, 1, n, f) == (size_t) n;
+     return fclose(f) == 0 && ok;
+}
+
+/* a NSLOT-slot image with the header of HDR, half full of entries
+   for problems nobody will ever plan, which are not in the filter (so
+   that every lookup probes the image) */
+static int write_big(const char *fname, const unsigned char *hdr, 
+		     unsigned nslot)
+{
+     long n = HDR_SIZE + (long) nslot * SLOT_SIZE;
+     unsigned char *b = (unsigned char *) malloc(n);
+     unsigned i, seed = 1, unfiltered = nslot / 2;
+     int ok;
+
+     memcpy(b, hdr, HDR_SIZE);
+     memcpy(b + HDR_NSLOT, &nslot, 4);
+     memcpy(b + HDR_UNFILTERED, &unfiltered, 4);
+     memset(b + HDR_SIZE, 0, n - HDR_SIZE);
+     for (i = 0; i < nslot; ++i) {
+	  unsigned *e = (unsigned *) (b + HDR_SIZE + (long) i * ENTRY_SIZE);
+	  if (i % 2) {
+	       e[5] = 0xffffffffU;	/* empty */
+	       continue;
+	  }
+	  seed = seed * 1103515245u + 12345u;
+	  e[0] = i; e[1] = seed; e[2] = ~seed; e[3] = i ^ seed;
+	  e[4] = 0; e[5] = 0; e[6] = 0; e[7] = 0;
+     }
+     ok = spit(fname, b, n);
+     free(b);
+     return ok;
+}
+
+/* IMG (N bytes) as if written with another fast hash: its filter,
+   meaningless then, is cleared, so that its wisdom is found only if the
+   image is probed without it */
+static void spit_foreign_hash(const char *fname, const unsigned char *img,
+			      long n)
+{
+     unsigned char *b = (unsigned char *) malloc(n);
+     unsigned nslot;
+
+     memcpy(b, img, n);
+     memcpy(&nslot, b + HDR_NSLOT, 4);
+     b[HDR_FASTHASH] ^= 1;
+     memset(b + HDR_SIZE + (long) nslot * ENTRY_SIZE, 0, (long) nslot * 4);
+     spit(fname, b, n);
+     free(b);
+}
+
+static double import_time(const char *fname, int *ok)
+{
+     double t;
+     fftw_forget_wisdom();
+     t = check_now();
+     *ok = fftw_import_wisdom_from_binary_filename(fname);
+     return check_now() - t;
+}
+
+/* does the text S contain the line L of LEN characters? */
+static int has_line(const char *s, const char *l, size_t len)
+{
+     for (; s; s = strchr(s, '\n'), s = s ? s + 1 : 0)
+	  if (!strncmp(s, l, len))
+	       return 1;
+     return 0;
+}
+
+/* same lines, in any order */
+static int same_lines(const char *a, const char *b)
+{
+     const char *l, *e;
+
+     if (strlen(a) != strlen(b))
+	  return 0;
+     for (l = a; *l; l = e + 1) {
+	  e = strchr(l, '\n');
+	  if (!e || !has_line(b, l, (size_t) (e - l + 1)))
+	       return 0;
+     }
+     return 1;
+}
+
+/* problem K of check_many: in place or not, over 1 to 3 vectors */
+static fftw_plan plan_many(int k, int n, unsigned flags)
+{
+     int howmany = 1 + k % 3;
+     fftw_complex *in = fftw_alloc_complex(n * howmany);
+     fftw_complex *out = k % 2 ? in : fftw_alloc_complex(n * howmany);
+     fftw_plan p = fftw_plan_many_dft(1, &n, howmany, in, 0, 1, n,
+				      out, 0, 1, n, FFTW_FORWARD, flags);
+     if (out != in) fftw_free(out);
+     fftw_free(in);
+     return p;
+}
+
+#define NMANY 300
+
+/* returns the time taken by the problems that miss */
+static double replan_many(char **name, const char *what)
+{
+     double t;
+     int k, wrong = 0, extra = 0;
+
+     for (k = 0; k < NMANY; ++k) {
+	  fftw_plan p = plan_many(k, 2 + k, FFTW_ESTIMATE | FFTW_WISDOM_ONLY);
+	  char *s = p ? fftw_sprint_plan(p) : 0;
+	  wrong += !s || strcmp(s, name[k]);
+	  free(s);
+	  if (p) fftw_destroy_plan(p);
+     }
+     t = check_now();
+     for (k = 0; k < NMANY; ++k) {
+	  fftw_plan p = plan_many(k, 1000 + k, FFTW_ESTIMATE | FFTW_WISDOM_ONLY);
+	  extra += p != 0;
+	  if (p) fftw_destroy_plan(p);
+     }
+     t = check_now() - t;
+     if (wrong)
+	  check_fail("%s (n = %d)", what, wrong);
+     if (extra)
+	  check_fail("wisdom for problems never planned (n = %d)", extra);
+     return t;
+}
+
+static void check_many(void)
+{
+     char *name[NMANY], *text;
+     int k;
+     double tb, tt;
+
+     fftw_forget_wisdom();
+     for (k = 0; k < NMANY; ++k) {
+	  fftw_plan p = plan_many(k, 2 + k, FFTW_ESTIMATE);
+	  name[k] = fftw_sprint_plan(p);
+	  fftw_destroy_plan(p);
+     }
+     text = fftw_export_wisdom_to_string();
+     if (!fftw_export_wisdom_to_binary_filename(path("wisdom-many.bin")))
+	  check_fail("cannot write binary wisdom (n = %d)", NMANY);
+
+     fftw_forget_wisdom();
+     if (!fftw_import_wisdom_from_binary_filename(path("wisdom-many.bin")))
+	  check_fail("binary wisdom does not import (n = %d)", NMANY);
+     tb = replan_many(name, "wrong plan from binary wisdom");
+     fftw_forget_wisdom();
+     if (!text || !fftw_import_wisdom_from_string(text))
+	  check_fail("text wisdom does not import (n = %d)", NMANY);
+     tt = replan_many(name, "wrong plan from text wisdom");
+     printf("wisdom of %d problems: %d misses in %.3g s from binary, "
+	    "%.3g s from text\n", NMANY, NMANY, tb, tt);
+
+     fftw_forget_wisdom();
+     remove(path("wisdom-many.bin"));
+     for (k = 0; k < NMANY; ++k)
+	  free(name[k]);
+     free(text);
+}
+
+#ifdef HAVE_FORK
+#define NPROC 4
+
+/* NPROC processes attach the shared wisdom file and plan all sizes,
+   with FLAGS; the first of them dies halfway if KILL.  Returns the
+   number of failures. */
+static int processes(unsigned flags, int kill)
+{
+     pid_t pid[NPROC];
+     int i, status, bad = 0;
+
+     for (i = 0; i < NPROC; ++i) {
+	  pid[i] = fork();
+	  if (pid[i] == 0) {
+	       int j, nbad = 0;
+	       if (!fftw_attach_shared_wisdom(path("wisdom-shared"), 0))
+		    _exit(100);
+	       for (j = 0; j < NSIZES; ++j) {
+		    if (kill && i == 0 && j == NSIZES / 2)
+			 raise(SIGKILL);
+		    nbad += !plan_size(sizes[(i + j) % NSIZES], flags);
+	       }
+	       _exit(nbad);
+	  }
+     }
+     for (i = 0; i < NPROC; ++i) {
+	  if (waitpid(pid[i], &status, 0) != pid[i])
+	       ++bad;
+	  else if (WIFEXITED(status))
+	       bad += WEXITSTATUS(status);
+	  else if (!(kill && i == 0))
+	       ++bad;
+     }
+     return bad;
+}
+
+static void check_shared(void)
+{
+     double t;
+
+     remove(path("wisdom-shared"));
+     fftw_forget_wisdom();
+
+     if (processes(FFTW_MEASURE, 1))
+	  check_fail("planning with shared wisdom");
+     if (processes(FFTW_MEASURE | FFTW_WISDOM_ONLY, 0))
+	  check_fail("other processes miss shared wisdom");
+
+     if (!fftw_attach_shared_wisdom(path("wisdom-shared"), 0))
+	  check_fail("cannot attach shared wisdom");
+     t = check_now();
+     expect_wisdom(1, "shared wisdom missing");
+     printf("shared: %d sizes planned from %d processes' wisdom in %.3g s\n",
+	    NSIZES, NPROC, check_now() - t);
+
+     /* forgetting detaches the file (and leaves it alone) */
+     fftw_forget_wisdom();
+     expect_wisdom(0, "wisdom survived fftw_forget_wisdom");
+     if (processes(FFTW_MEASURE | FFTW_WISDOM_ONLY, 0))
+	  check_fail("shared wisdom lost");
+
+     remove(path("wisdom-shared"));
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+     char *text, *text2;
+     unsigned char *img;
+     long n;
+     int j, ok1, ok2;
+     double t_small, t_big;
+
+     if (argc > 1)
+	  strncpy(dir, argv[1], sizeof(dir) - 1);
+
+     for (j = 0; j < NSIZES; ++j)
+	  if (!plan_size(sizes[j], FFTW_MEASURE))
+	       check_fail("FFTW_MEASURE plan (n = %d)", sizes[j]);
+     text = fftw_export_wisdom_to_string();
+
+     if (!fftw_export_wisdom_to_binary_filename(path("wisdom.bin")))
+	  check_fail("cannot write binary wisdom");
+
+     fftw_forget_wisdom();
+     expect_wisdom(0, "wisdom survived fftw_forget_wisdom");
+     if (!fftw_import_wisdom_from_binary_filename(path("wisdom.bin")))
+	  check_fail("binary wisdom does not import");
+     expect_wisdom(1, "wisdom missing after binary import");
+
+     text2 = fftw_export_wisdom_to_string();
+     if (!text || !text2 || !same_lines(text, text2))
+	  check_fail("text wisdom does not survive the binary format");
+     free(text2);
+
+     /* refuse foreign or damaged images */
+     img = slurp(path("wisdom.bin"), &n);
+     if (!img || n < HDR_SIZE)
+	  check_fail("cannot read back binary wisdom");
+     else {
+	  img[HDR_CONFIG] ^= 1;
+	  spit(path("wisdom-foreign.bin"), img, n);
+	  img[HDR_CONFIG] ^= 1;
+	  spit(path("wisdom-short.bin"), img, n - ENTRY_SIZE);
+	  spit_foreign_hash(path("wisdom-hash.bin"), img, n);
+	  fftw_forget_wisdom();
+	  if (fftw_import_wisdom_from_binary_filename(path("wisdom-foreign.bin")))
+	       check_fail("imported wisdom of another configuration");
+	  if (fftw_import_wisdom_from_binary_filename(path("wisdom-short.bin")))
+	       check_fail("imported truncated wisdom");
+	  if (!fftw_import_wisdom_from_binary_filename(path("wisdom-hash.bin")))
+	       check_fail("wisdom of another fast hash does not import");
+	  expect_wisdom(1, "wisdom of another fast hash missing");
+	  fftw_forget_wisdom();
+	  if (fftw_import_wisdom_from_string(text) == 0)
+	       check_fail("text wisdom does not import");
+	  expect_wisdom(1, "text wisdom lost");
+
+	  /* import cost does not grow with the size of the image */
+	  if (!write_big(path("wisdom-big.bin"), img, 1u << 20))
+	       check_fail("cannot write big image");
+	  t_small = import_time(path("wisdom.bin"), &ok1);
+	  t_big = import_time(path("wisdom-big.bin"), &ok2);
+	  if (!ok1 || !ok2)
+	       check_fail("image does not import");
+	  printf("import: %d-slot image %.3g s, %d-slot image %.3g s\n",
+		 (int) ((n - HDR_SIZE) / SLOT_SIZE), t_small, 1 << 20, t_big);
+	  if (t_big > 10 * t_small + 0.005)
+	       check_fail("import time grows with the image (n = %d)", 1 << 20);
+
+	  /* the big image answers lookups too (and finds nothing) */
+	  expect_wisdom(0, "found wisdom that is not there");
+	  fftw_forget_wisdom();
+	  free(img);
+     }
+
+     check_many();
+#ifdef HAVE_FORK
+     check_shared();
+#endif
+
+     remove(path("wisdom.bin"));
+     remove(path("wisdom-foreign.bin"));
+     remove(path("wisdom-short.bin"));
+     remove(path("wisdom-hash.bin"));
+     remove(path("wisdom-big.bin"));
+     free(text);
+     fftw_cleanup();
+
+     return check_exit();
+}
@@ -20,19 +20,104 @@
 
 #include "api/api.h"
 #include "threads/threads.h"
+#include <string.h>
+#ifdef HAVE_UNISTD_H
+#  include <unistd.h>
+#endif
 
 static int threads_inited = 0;
 
+/* concurrent planning: the wisdom shared by all thread planners, and
+   the settings they start with */
+static shtab *shared_wisdom = 0;
+static int shared_nthr, shared_nchunk, shared_nmeasure, shared_robust_timing;
+static double shared_timelimit;
+
+/* first touch of a block of huge pages: in as many contiguous parts,
+   by as many threads, as the threaded plans split their loops, so that
+   on a NUMA machine each part lands on the node of a thread that works
+   on it */
+#define TOUCH_PAGE 4096
+
+typedef struct {
+     char *p;
+     size_t n;
+} touch_data;
+
+static void *touch_part(spawn_data *d)
+{
+     touch_data *t = (touch_data *) d->data;
+     size_t lo = (size_t) d->min * TOUCH_PAGE;
+     size_t hi = (size_t) d->max * TOUCH_PAGE;
+
+     if (hi > t->n)
+	  hi = t->n;
+     memset(t->p + lo, 0, hi - lo);
+     return 0;
+}
+
+static void first_touch(void *p, size_t n)
+{
+     touch_data t;
+
+     t.p = (char *) p;
+     t.n = n;
+     X(spawn_loop)((int) ((n + TOUCH_PAGE - 1) / TOUCH_PAGE),
+		   X(the_planner)()->nthr, touch_part, (void *) &t);
+}
+
+/* the arrays of X(execute_dft_batch) and friends, in ranges of
+   consecutive ones, one per thread */
+typedef struct {
+     void (*f)(void *data, int lo, int hi);
+     void *data;
+} batch_data;
+
+static void *batch_part(spawn_data *d)
+{
+     batch_data *b = (batch_data *) d->data;
+     b->f(b->data, d->min, d->max);
+     return 0;
+}
+
+static void batch_loop(int n, int nthr,
+		       void (*f)(void *data, int lo, int hi), void *data)
+{
+     batch_data b;
+
+     b.f = f;
+     b.data = data;
+     X(spawn_loop)(n, nthr, batch_part, (void *) &b);
+}
+
 static void threads_register_hooks(void)
 {
+     int ncpus = X(measure_ncpus)();
+
+     if (ncpus > 0)
+	  X(thr_model).ncpus = (double) ncpus;
      X(mksolver_ct_hook) = X(mksolver_ct_threads);
      X(mksolver_hc2hc_hook) = X(mksolver_hc2hc_threads);
+     X(measure_loop_hook) = X(measure_loop);
+     X(measure_pin_hook) = X(measure_pin);
+     X(measure_unpin_hook) = X(measure_unpin);
+     X(first_touch_hook) = first_touch;
+     X(batch_hook) = batch_loop;
+     X(threadpool_enter_hook) = X(tpool_enter);
+     X(threadpool_leave_hook) = X(tpool_leave);
 }
 
 static void threads_unregister_hooks(void)
 {
      X(mksolver_ct_hook) = 0;
      X(mksolver_hc2hc_hook) = 0;
+     X(measure_loop_hook) = 0;
+     X(measure_pin_hook) = 0;
+     X(measure_unpin_hook) = 0;
+     X(first_touch_hook) = 0;
+     X(batch_hook) = 0;
+     X(threadpool_enter_hook) = 0;
+     X(threadpool_leave_hook) = 0;
 }
 
 /* should be called before all other FFTW functions! */
@@ -60,6 +145,12 @@ int X(init_threads)(void)
 void X(cleanup_threads)(void)
 {
      X(cleanup)();
+     if (shared_wisdom) {
+	  X(the_planner_hook) = 0;
+	  X(thread_planners_cleanup)();
+	  X(shtab_destroy)(shared_wisdom);
+	  shared_wisdom = 0;
+     }
      if (threads_inited) {
 	  X(threads_cleanup)();
 	  threads_unregister_hooks();
@@ -85,11 +176,493 @@ int X(planner_nthreads)(void)
     return X(the_planner)()->nthr;
 }
 
+/* split the loops of threaded plans in NCHUNK blocks per thread, which
+   threads that are done with their own steal from the others */
+void X(plan_with_work_stealing)(int nchunk)
+{
+     planner *plnr;
+
+     if (!threads_inited) {
+	  X(cleanup)();
+	  X(init_threads)();
+     }
+     A(threads_inited);
+     plnr = X(the_planner)();
+     plnr->nchunk = X(imax)(1, nchunk);
+}
+
+/* number of plans the planner may time at once (FFTW_MEASURE and up) */
+void X(plan_with_measure_threads)(int nthreads)
+{
+     planner *plnr;
+     int ncpus;
+
+     if (!threads_inited) {
+	  X(cleanup)();
+	  X(init_threads)();
+     }
+     A(threads_inited);
+     plnr = X(the_planner)();
+     /* concurrent timings that share a cpu are worthless */
+     ncpus = X(measure_ncpus)();
+     if (ncpus > 0)
+	  nthreads = X(imin)(nthreads, ncpus);
+     plnr->nmeasure = X(imax)(1, nthreads);
+}
+
+int X(planner_measure_threads)(void)
+{
+    return X(the_planner)()->nmeasure;
+}
+
 void X(make_planner_thread_safe)(void)
 {
      X(threads_register_planner_hooks)();
 }
 
+static planner *mk_thread_planner(void)
+{
+     planner *plnr = X(mkplanner)();
+     X(configure_planner)(plnr);
+     X(threads_conf_standard)(plnr);
+     plnr->nthr = shared_nthr;
+     plnr->nchunk = shared_nchunk;
+     plnr->nmeasure = shared_nmeasure;
+     plnr->robust_timing = shared_robust_timing;
+     plnr->timelimit = shared_timelimit;
+     plnr->shared = shared_wisdom;
+     return plnr;
+}
+
+/* Give every thread its own planner, so that threads plan in parallel
+   instead of queueing behind the lock of X(make_planner_thread_safe).
+   Blessed solutions go to a lock-free table that all thread planners
+   read, so wisdom found or imported by one thread serves all.  Thread
+   planners start with the settings (threads, timing, time limit) and
+   the wisdom of the planner in use at the time of the call.  Returns 0
+   if the platform has no atomic operations to build the table with. */
+int X(make_planner_concurrent)(void)
+{
+     planner *plnr;
+     char *wis;
+
+     if (shared_wisdom)
+	  return 1;
+
+     if (!threads_inited) {
+	  X(cleanup)();
+	  X(init_threads)();
+     }
+     A(threads_inited);
+
+     if (!(shared_wisdom = X(mkshtab)()))
+	  return 0;
+     if (!X(thread_planners_init)(mk_thread_planner)) {
+	  X(shtab_destroy)(shared_wisdom);
+	  shared_wisdom = 0;
+	  return 0;
+     }
+
+     plnr = X(the_planner)();
+     shared_nthr = plnr->nthr;
+     shared_nchunk = plnr->nchunk;
+     shared_nmeasure = plnr->nmeasure;
+     shared_robust_timing = plnr->robust_timing;
+     shared_timelimit = plnr->timelimit;
+     wis = X(export_wisdom_to_string)();
+
+     X(the_planner_hook) = X(thread_planner);
+
+     if (wis) {
+	  X(import_wisdom_from_string)(wis);
+	  free(wis);
+     }
+     return 1;
+}
+
+/* seconds that idle workers spin before they sleep; negative until
+   the threads backend picks a default */
+double X(threads_spin_time) = -1;
+
+void X(threads_set_spin)(double seconds)
+{
+     X(threads_spin_time) = seconds > 0 ? seconds : 0;
+}
+
+/* Scratch pools: the most idle bytes that the pool of each thread
+   keeps (0 turns the pools off, letting them drain), and the sums over
+   the pools */
+void X(set_scratch_pool)(size_t bytes)
+{
+     X(scratch_pool_budget) = bytes;
+}
+
+void X(scratch_pool_stats)(size_t *bytes, size_t *peak, double *hits,
+			   double *misses, double *trimmed)
+{
+     scratch_pool_stats s;
+
+     X(scratch_pools_stats)(&s);
+     if (bytes) *bytes = s.bytes;
+     if (peak) *peak = s.peak;
+     if (hits) *hits = s.hits;
+     if (misses) *misses = s.misses;
+     if (trimmed) *trimmed = s.trimmed;
+}
+
+/* Thread pools.  A plan run on a pool splits its loops among the
+   threads of the pool, however many threads it was planned for, and
+   never spawns threads beyond them; a pool runs one loop at a time, so
+   a transform that finds it taken runs in the calling thread alone. */
+X(threadpool) X(threadpool_create)(int nthreads, const int *cpus, int ncpus)
+{
+     if (!threads_inited) {
+	  X(cleanup)();
+	  X(init_threads)();
+     }
+     A(threads_inited);
+     return X(mktpool)(nthreads, cpus, ncpus);
+}
+
+/* no plan may be executing on POOL */
+void X(threadpool_destroy)(X(threadpool) pool)
+{
+     X(tpool_destroy)(pool);
+}
+
+int X(threadpool_nthreads)(const X(threadpool) pool)
+{
+     return pool ? X(tpool_nthreads)(pool) : 1;
+}
+
+void X(plan_set_threadpool)(X(plan) p, X(threadpool) pool)
+{
+     if (p)
+	  p->pool = pool;
+}
+
+void X(execute_in_threadpool)(const X(plan) p, X(threadpool) pool)
+{
+     plan *pln = p->pln;
+     X(threadpool) prev = X(tpool_enter)(pool);
+     WITH_PLAN_SCRATCH(p, pln->adt->solve(pln, p->prb));
+     X(tpool_leave)(prev);
+}
+
+/* Asynchronous execution: each request runs P on its arrays on a
+   worker of its own, or at submission if there is none; the requests
+   queued for one plan and kind at the time a worker takes the first
+   of them run as one batch (X(execute_dft_batch) and friends). */
+struct X(request_s) {
+     async_job j;
+     apiplan *p;
+     void *in, *out;
+};
+typedef struct X(request_s) request;
+
+#define REQ(jobs, i) ((request *) (jobs)[i])
+
+static void run_plan(async_job **jobs, int n)
+{
+     int i;
+     for (i = 0; i < n; ++i)
+	  X(execute)(REQ(jobs, i)->p);
+}
+
+static void run_dft(async_job **jobs, int n)
+{
+     C *in[ASYNC_BATCH], *out[ASYNC_BATCH];
+     int i;
+
+     for (i = 0; i < n; ++i) {
+	  in[i] = (C *) REQ(jobs, i)->in;
+	  out[i] = (C *) REQ(jobs, i)->out;
+     }
+     X(execute_dft_batch)(REQ(jobs, 0)->p, n, in, out);
+}
+
+static void run_r2c(async_job **jobs, int n)
+{
+     R *in[ASYNC_BATCH];
+     C *out[ASYNC_BATCH];
+     int i;
+
+     for (i = 0; i < n; ++i) {
+	  in[i] = (R *) REQ(jobs, i)->in;
+	  out[i] = (C *) REQ(jobs, i)->out;
+     }
+     X(execute_dft_r2c_batch)(REQ(jobs, 0)->p, n, in, out);
+}
+
+static void run_c2r(async_job **jobs, int n)
+{
+     C *in[ASYNC_BATCH];
+     R *out[ASYNC_BATCH];
+     int i;
+
+     for (i = 0; i < n; ++i) {
+	  in[i] = (C *) REQ(jobs, i)->in;
+	  out[i] = (R *) REQ(jobs, i)->out;
+     }
+     X(execute_dft_c2r_batch)(REQ(jobs, 0)->p, n, in, out);
+}
+
+static void run_r2r(async_job **jobs, int n)
+{
+     R *in[ASYNC_BATCH], *out[ASYNC_BATCH];
+     int i;
+
+     for (i = 0; i < n; ++i) {
+	  in[i] = (R *) REQ(jobs, i)->in;
+	  out[i] = (R *) REQ(jobs, i)->out;
+     }
+     X(execute_r2r_batch)(REQ(jobs, 0)->p, n, in, out);
+}
+
+static request *submit(apiplan *p, void (*run)(async_job **, int),
+		       void *in, void *out, void (*done)(void *), void *arg)
+{
+     request *r = (request *) MALLOC(sizeof(request), OTHER);
+
+     r->p = p;
+     r->in = in;
+     r->out = out;
+     r->j.run = run;
+     r->j.key = p;
+     r->j.done = done;
+     r->j.arg = arg;
+     X(async_submit)(&r->j);
+     return r;
+}
+
+X(request) X(execute_async)(const X(plan) p,
+			    void (*done)(void *arg), void *arg)
+{
+     return submit(p, run_plan, 0, 0, done, arg);
+}
+
+X(request) X(execute_dft_async)(const X(plan) p, C *in, C *out,
+				void (*done)(void *arg), void *arg)
+{
+     return submit(p, run_dft, in, out, done, arg);
+}
+
+X(request) X(execute_dft_r2c_async)(const X(plan) p, R *in, C *out,
+				    void (*done)(void *arg), void *arg)
+{
+     return submit(p, run_r2c, in, out, done, arg);
+}
+
+X(request) X(execute_dft_c2r_async)(const X(plan) p, C *in, R *out,
+				    void (*done)(void *arg), void *arg)
+{
+     return submit(p, run_c2r, in, out, done, arg);
+}
+
+X(request) X(execute_r2r_async)(const X(plan) p, R *in, R *out,
+				void (*done)(void *arg), void *arg)
+{
+     return submit(p, run_r2r, in, out, done, arg);
+}
+
+/* nonzero once R is done, its callback included */
+int X(request_test)(X(request) r)
+{
+     return X(async_test)(&r->j);
+}
+
+/* wait until R is done, and free it */
+void X(request_wait)(X(request) r)
+{
+     X(async_wait)(&r->j);
+     X(ifree)(r);
+}
+
+/* the most workers that all loops and pools together may have */
+void X(threads_set_max_workers)(int nworkers)
+{
+     if (!threads_inited) {
+	  X(cleanup)();
+	  X(init_threads)();
+     }
+     A(threads_inited);
+     X(threads_max_workers)(nworkers);
+}
+
+/* bind the workers that run block i of the threaded loops to
+   CPUS[i % NCPUS], or unbind them if NCPUS <= 0 */
+void X(threads_set_affinity)(const int *cpus, int ncpus)
+{
+     if (!threads_inited) {
+	  X(cleanup)();
+	  X(init_threads)();
+     }
+     A(threads_inited);
+     X(threads_affinity)(cpus, ncpus);
+}
+
+/* the cpus of NUMA node NODE, in CPUS[0..MAXCPUS-1]; returns how many
+   there are, or 0 if the system does not tell */
+int X(threads_node_cpus)(int node, int *cpus, int maxcpus)
+{
+     int n = 0;
+#ifdef __linux__
+     char name[64];
+     FILE *f;
+     int lo, hi, c;
+
+     sprintf(name, "/sys/devices/system/node/node%d/cpulist", node);
+     if (node < 0 || !(f = fopen(name, "r")))
+	  return 0;
+     /* e.g. "0-3,8-11" */
+     while (fscanf(f, "%d", &lo) == 1) {
+	  hi = lo;
+	  c = fgetc(f);
+	  if (c == '-') {
+	       if (fscanf(f, "%d", &hi) != 1)
+		    break;
+	       c = fgetc(f);
+	  }
+	  for (; lo <= hi; ++lo, ++n)
+	       if (n < maxcpus)
+		    cpus[n] = lo;
+	  if (c != ',')
+	       break;
+     }
+     fclose(f);
+#else
+     UNUSED(node);
+     UNUSED(cpus);
+     UNUSED(maxcpus);
+#endif
+     return n;
+}
+
+/* calibration of the thread model: seconds per call of F(D, N),
+   repeated until the clock can tell */
+#define CALIB_SEC 1.0e-2
+#define CALIB_BYTES (32 << 20)	/* copied to find the bandwidth */
+
+static double calib_time(void (*f)(void *d, int n), void *d, int n)
+{
+     planner *plnr = X(the_planner)();
+     int nrep;
+
+     for (nrep = 1; ; nrep *= 2) {
+	  crude_time t0 = X(get_crude_time)();
+	  double t;
+	  int r;
+
+	  for (r = 0; r < nrep; ++r)
+	       f(d, n);
+	  t = X(elapsed_since)(plnr, 0, t0);
+	  if (t >= CALIB_SEC || nrep >= (1 << 24))
+	       return t / nrep;
+     }
+}
+
+static void *calib_nothing(spawn_data *d)
+{
+     UNUSED(d);
+     return 0;
+}
+
+static void calib_spawn(void *d, int n)
+{
+     X(spawn_loop)(n, n, calib_nothing, d);
+}
+
+static void calib_execute(void *d, int n)
+{
+     UNUSED(n);
+     X(execute)((X(plan)) d);
+}
+
+typedef struct {
+     char *from, *to;
+     size_t part;
+} copy_data;
+
+static void *calib_copy_part(spawn_data *d)
+{
+     copy_data *c = (copy_data *) d->data;
+     size_t lo = (size_t) d->min * c->part, hi = (size_t) d->max * c->part;
+     memcpy(c->to + lo, c->from + lo, hi - lo);
+     return 0;
+}
+
+static void calib_copy(void *d, int n)
+{
+     copy_data *c = (copy_data *) d;
+     c->part = CALIB_BYTES / (size_t) n;
+     X(spawn_loop)(n, n, calib_copy_part, d);
+}
+
+/* measure the thread model on this machine, for as many threads as the
+   planner has (at least 2): the cost of waking up threads, the rate of
+   a serial transform, how many threads a large copy keeps busy, and
+   the size of the cache */
+void X(threads_calibrate)(void)
+{
+     thrmodel *m = &X(thr_model);
+     planner *plnr;
+     int nthr, t;
+     X(plan) p;
+     C *a;
+     copy_data c;
+     double t1, best;
+
+     if (!threads_inited) {
+	  X(cleanup)();
+	  X(init_threads)();
+     }
+     A(threads_inited);
+     plnr = X(the_planner)();
+     nthr = X(imax)(2, plnr->nthr);
+
+     m->spawn = (calib_time(calib_spawn, 0, nthr)
+		 - calib_time(calib_spawn, 0, 1)) / (nthr - 1);
+     if (m->spawn <= 0)
+	  m->spawn = 1.0e-8;
+
+     t = plnr->nthr;
+     plnr->nthr = 1;
+     a = X(alloc_complex)(4096);
+     p = X(plan_dft_1d)(4096, a, a, FFTW_FORWARD, FFTW_ESTIMATE);
+     plnr->nthr = t;
+     if (p) {
+	  memset(a, 0, sizeof(C) * 4096);
+	  m->rate = X(estimate_cost)(p) / calib_time(calib_execute, p, 1);
+	  X(destroy_plan)(p);
+     }
+     X(free)(a);
+
+     c.from = (char *) X(malloc)(CALIB_BYTES);
+     c.to = (char *) X(malloc)(CALIB_BYTES);
+     if (c.from && c.to) {
+	  memset(c.from, 1, CALIB_BYTES);
+	  memset(c.to, 0, CALIB_BYTES);
+	  t1 = calib_time(calib_copy, &c, 1);
+	  best = 1;
+	  for (t = 2; t <= nthr; ++t) {
+	       double s = t1 / calib_time(calib_copy, &c, t);
+	       if (s > best)
+		    best = s;
+	  }
+	  m->bw = best;
+     }
+     X(free)(c.from);
+     X(free)(c.to);
+
+#if defined(HAVE_UNISTD_H) && defined(_SC_LEVEL2_CACHE_SIZE)
+     {
+	  long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+	  if (l2 > 0)
+	       m->cache = (double) l2;
+     }
+#endif
+}
+
 spawnloop_function X(spawnloop_callback) = (spawnloop_function) 0;
 void *X(spawnloop_callback_data) = (void *) 0;
 void X(threads_set_callback)(void (*spawnloop)(void *(*work)(char *), char *, size_t, int, void *), void *data)
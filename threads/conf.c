@@ -34,3 +34,61 @@ void X(threads_conf_standard)(planner *p)
 {
      X(solvtab_exec)(s, p);
 }
+
+/* size of the blocks in which the threaded solvers split a loop of N
+   iterations among NTHR threads: one block per thread, or plnr->nchunk
+   per thread so that idle threads can steal them (X(spawn_chunks)) */
+INT X(thr_block_size)(INT n, int nthr, const planner *plnr)
+{
+     INT nblk = (INT) nthr * X(imax)(1, plnr->nchunk);
+     return (n + nblk - 1) / nblk;
+}
+
+/* threads of a solver variant that uses NTHR >> SHIFT (rounded up) of
+   the NTHR threads of the planner, or 0 if that is as many as the
+   variant of SHIFT - 1 uses.  The planner picks among the variants
+   (and serial plans) by estimate or measurement, so that a problem
+   gets as many threads as pay for themselves. */
+int X(thr_nthr)(int nthr, int shift)
+{
+     int t = (nthr + (1 << shift) - 1) >> shift;
+     if (shift > 0 && t == (nthr + (1 << (shift - 1)) - 1) >> (shift - 1))
+	  return 0;
+     return t;
+}
+
+/* The operations of a threaded plan are spread among its threads, as
+   far as there are cpus to run them, but each extra thread costs the
+   time to wake it up and join it, and blocks whose data do not fit in
+   the caches of their threads run at the speed of memory, which a few
+   threads saturate.  X(thr_model) prices both, with typical values
+   until X(threads_calibrate) measures them. */
+thrmodel X(thr_model) = {
+     2.0e-6,			/* spawn */
+     5.0e9,			/* rate */
+     1.0e9,			/* ncpus, set by X(init_threads) */
+     4.0,			/* bw */
+     512.0 * 1024.0		/* cache */
+};
+
+/* add to OPS->thr what NTHR threads save on the blocks of operations
+   PAR (included in OPS, and possibly OPS itself) that they run at the
+   same time */
+void X(thr_ops)(opcnt *ops, const opcnt *par, int nthr)
+{
+     const thrmodel *t = &X(thr_model);
+     double n = (double) nthr;
+     double ops1 = par->add + par->mul + par->fma + par->other;
+     double speed = n < t->ncpus ? n : t->ncpus;
+     double time1; /* as in X(iestimate_cost) */
+
+#if HAVE_FMA
+     time1 = ops1 - par->thr;
+#else
+     time1 = ops1 + par->fma - par->thr;
+#endif
+     /* a block touches about as many bytes as it does operations */
+     if (ops1 / n > t->cache && speed > t->bw)
+	  speed = t->bw;
+     ops->thr += time1 - time1 / speed - (n - 1) * t->spawn * t->rate;
+}
@@ -26,13 +26,15 @@ typedef struct {
      int vecloop_dim;
      const int *buddies;
      size_t nbuddies;
+     int shift;			/* uses nthr >> shift threads */
 } S;
 
 typedef struct {
      plan_dft super;
      plan **cldrn;
      INT its, ots;
-     int nthr;
+     int nblk;			/* blocks, one child plan each */
+     int nthr;			/* threads to run them on */
      const S *solver;
 } P;
 
@@ -47,12 +49,14 @@ static void *spawn_apply(spawn_data *d)
      PD *ego = (PD *) d->data;
      INT its = ego->its;
      INT ots = ego->ots;
-     int thr_num = d->thr_num;
-     plan_dft *cld = (plan_dft *) ego->cldrn[thr_num];
+     int i;
 
-     cld->apply((plan *) cld,
-		ego->ri + thr_num * its, ego->ii + thr_num * its,
-		ego->ro + thr_num * ots, ego->io + thr_num * ots);
+     for (i = d->min; i < d->max; ++i) {
+	  plan_dft *cld = (plan_dft *) ego->cldrn[i];
+	  cld->apply((plan *) cld,
+		     ego->ri + i * its, ego->ii + i * its,
+		     ego->ro + i * ots, ego->io + i * ots);
+     }
      return 0;
 }
 
@@ -66,14 +70,14 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
      d.cldrn = ego->cldrn;
      d.ri = ri; d.ii = ii; d.ro = ro; d.io = io;
 
-     X(spawn_loop)(ego->nthr, ego->nthr, spawn_apply, (void*) &d);
+     X(spawn_chunks)(ego->nblk, ego->nthr, spawn_apply, (void*) &d);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
 {
      P *ego = (P *) ego_;
      int i;
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  X(plan_awake)(ego->cldrn[i], wakefulness);
 }
 
@@ -81,9 +85,9 @@ static void destroy(plan *ego_)
 {
      P *ego = (P *) ego_;
      int i;
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  X(plan_destroy_internal)(ego->cldrn[i]);
-     X(ifree)(ego->cldrn);
+     X(arena_ifree)(ego->cldrn);
 }
 
 static void print(const plan *ego_, printer *p)
@@ -92,7 +96,7 @@ static void print(const plan *ego_, printer *p)
      const S *s = ego->solver;
      int i;
      p->print(p, "(dft-thr-vrank>=1-x%d/%d", ego->nthr, s->vecloop_dim);
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  if (i == 0 || (ego->cldrn[i] != ego->cldrn[i-1] &&
 			 (i <= 1 || ego->cldrn[i] != ego->cldrn[i-2])))
 	       p->print(p, "%(%p%)", ego->cldrn[i]);
@@ -113,6 +117,7 @@ static int applicable0(const solver *ego_, const problem *p_,
 
      return (1
 	     && plnr->nthr > 1
+	     && X(thr_nthr)(plnr->nthr, ego->shift) > 1
 	     && FINITE_RNK(p->vecsz->rnk)
 	     && p->vecsz->rnk > 0
 	     && pickdim(ego, p->vecsz, p->ri != p->ro, dp)
@@ -142,7 +147,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      int vdim;
      iodim *d;
      plan **cldrn = (plan **) 0;
-     int i, nthr;
+     int i, nblk, nthr;
      INT its, ots, block_size;
      tensor *vecsz = 0;
 
@@ -155,19 +160,21 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      p = (const problem_dft *) p_;
      d = p->vecsz->dims + vdim;
 
-     block_size = (d->n + plnr->nthr - 1) / plnr->nthr;
-     nthr = (int)((d->n + block_size - 1) / block_size);
-     plnr->nthr = (plnr->nthr + nthr - 1) / nthr;
+     nthr = X(thr_nthr)(plnr->nthr, ego->shift);
+     block_size = X(thr_block_size)(d->n, nthr, plnr);
+     nblk = (int)((d->n + block_size - 1) / block_size);
+     plnr->nthr = (nthr + nblk - 1) / nblk;
+     nthr = X(imin)(nthr, nblk);
      its = d->is * block_size;
      ots = d->os * block_size;
 
-     cldrn = (plan **)MALLOC(sizeof(plan *) * nthr, PLANS);
-     for (i = 0; i < nthr; ++i) cldrn[i] = (plan *) 0;
+     cldrn = (plan **)MALLOC(sizeof(plan *) * nblk, PLANS);
+     for (i = 0; i < nblk; ++i) cldrn[i] = (plan *) 0;
      
      vecsz = X(tensor_copy)(p->vecsz);
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
 	  vecsz->dims[vdim].n =
-	       (i == nthr - 1) ? (d->n - i*block_size) : block_size;
+	       (i == nblk - 1) ? (d->n - i*block_size) : block_size;
 	  cldp = X(mkproblem_dft)(p->sz, vecsz,
 				  p->ri + i*its, p->ii + i*its, 
 				  p->ro + i*ots, p->io + i*ots);
@@ -181,35 +188,41 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->cldrn = cldrn;
      pln->its = its;
      pln->ots = ots;
+     pln->nblk = nblk;
      pln->nthr = nthr;
 
      pln->solver = ego;
      X(ops_zero)(&pln->super.super.ops);
      pln->super.super.pcost = 0;
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
 	  X(ops_add2)(&cldrn[i]->ops, &pln->super.super.ops);
 	  pln->super.super.pcost += cldrn[i]->pcost;
+	  pln->super.super.nthr = X(imax)(pln->super.super.nthr,
+					  nthr * cldrn[i]->nthr);
      }
+     X(thr_ops)(&pln->super.super.ops, &pln->super.super.ops, nthr);
 
      return &(pln->super.super);
 
  nada:
      if (cldrn) {
-	  for (i = 0; i < nthr; ++i)
+	  for (i = 0; i < nblk; ++i)
 	       X(plan_destroy_internal)(cldrn[i]);
-	  X(ifree)(cldrn);
+	  X(arena_ifree)(cldrn);
      }
      X(tensor_destroy)(vecsz);
      return (plan *) 0;
 }
 
-static solver *mksolver(int vecloop_dim, const int *buddies, size_t nbuddies)
+static solver *mksolver(int vecloop_dim, const int *buddies, size_t nbuddies,
+			int shift)
 {
      static const solver_adt sadt = { PROBLEM_DFT, mkplan, 0 };
      S *slv = MKSOLVER(S, &sadt);
      slv->vecloop_dim = vecloop_dim;
      slv->buddies = buddies;
      slv->nbuddies = nbuddies;
+     slv->shift = shift;
      return &(slv->super);
 }
 
@@ -218,7 +231,10 @@ void X(dft_thr_vrank_geq1_register)(planner *p)
      /* FIXME: Should we try other vecloop_dim values? */
      static const int buddies[] = { 1, -1 };
      size_t i;
+     int shift;
 
-     for (i = 0; i < NELEM(buddies); ++i)
-          REGISTER_SOLVER(p, mksolver(buddies[i], buddies, NELEM(buddies)));
+     for (shift = 0; shift < THR_NSHIFT; ++shift)
+	  for (i = 0; i < NELEM(buddies); ++i)
+	       REGISTER_SOLVER(p, mksolver(buddies[i], buddies,
+					   NELEM(buddies), shift));
 }
@@ -21,13 +21,223 @@
 /* openmp.c: thread spawning via OpenMP  */
 
 #include "threads/threads.h"
+#include <omp.h>
 
 #if !defined(_OPENMP)
 #error OpenMP enabled but not using an OpenMP compiler
 #endif
 
+/* each thread has its own current arena (X(arena_enter)) and, where
+   the compiler has no THREAD_LOCAL, scratch workspace
+   (X(scratch_enter)) */
+static arena *my_arena;
+#pragma omp threadprivate(my_arena)
+
+static arena *get_arena(void) { return my_arena; }
+static void set_arena(arena *a) { my_arena = a; }
+
+#ifndef THREAD_LOCAL
+static scratch *my_scratch;
+#pragma omp threadprivate(my_scratch)
+
+static scratch *get_scratch(void) { return my_scratch; }
+static void set_scratch(scratch *s) { my_scratch = s; }
+#endif
+
+/* and its own pool of scratch buffers, made with its first one; the
+   pools are listed for their statistics, and live as long as the
+   process */
+struct spool {
+     scratch_pool *p;
+     struct spool *next;
+};
+static struct spool *my_spool;
+#pragma omp threadprivate(my_spool)
+static struct spool *spools = 0;
+
+static scratch_pool *get_spool(void)
+{
+     if (!my_spool) {
+	  struct spool *t = (struct spool *) MALLOC(sizeof(struct spool),
+						    OTHER);
+	  t->p = X(mkscratch_pool)();
+#pragma omp critical (fftw_spools)
+	  {
+	       t->next = spools;
+	       spools = t;
+	  }
+	  my_spool = t;
+     }
+     return my_spool->p;
+}
+
+void X(scratch_pools_stats)(scratch_pool_stats *s)
+{
+#pragma omp critical (fftw_spools)
+     {
+	  struct spool *t;
+	  s->bytes = s->peak = 0;
+	  s->hits = s->misses = s->trimmed = 0;
+	  for (t = spools; t; t = t->next)
+	       X(scratch_pool_add_stats)(t->p, s);
+     }
+}
+
+static void install_arena_hooks(void)
+{
+     X(arena_get_hook) = get_arena;
+     X(arena_set_hook) = set_arena;
+#ifndef THREAD_LOCAL
+     X(scratch_get_hook) = get_scratch;
+     X(scratch_set_hook) = set_scratch;
+#endif
+     X(scratch_pool_hook) = get_spool;
+}
+
+/* Thread pools (X(threadpool_create)).  The threads belong to the
+   OpenMP runtime, which also places them (OMP_PLACES), so a pool only
+   caps the threads of the loops run on it, and CPUS are ignored.  As
+   with our own threads, the workers of the pools count against the
+   limit of X(threads_set_max_workers), which also caps all loops. */
+struct X(threadpool_s) {
+     int nthr;
+};
+typedef struct X(threadpool_s) tpool;
+
+static tpool *my_tpool;
+#pragma omp threadprivate(my_tpool)
+static int max_workers = 0;	/* 0: no limit */
+static int pool_workers = 0;	/* workers of all pools */
+
+tpool *X(mktpool)(int nthreads, const int *cpus, int ncpus)
+{
+     tpool *tp = (tpool *) MALLOC(sizeof(tpool), OTHER);
+     int k = X(imax)(0, nthreads - 1);
+     UNUSED(cpus);
+     UNUSED(ncpus);
+#pragma omp critical (fftw_workers)
+     {
+	  if (max_workers > 0)
+	       k = X(imin)(k, X(imax)(0, max_workers - pool_workers));
+	  pool_workers += k;
+     }
+     tp->nthr = 1 + k;
+     return tp;
+}
+
+void X(tpool_destroy)(tpool *tp)
+{
+     if (tp) {
+#pragma omp critical (fftw_workers)
+	  pool_workers -= tp->nthr - 1;
+	  X(ifree)(tp);
+     }
+}
+
+int X(tpool_nthreads)(const tpool *tp)
+{
+     return tp->nthr;
+}
+
+tpool *X(tpool_enter)(tpool *tp)
+{
+     tpool *prev = my_tpool;
+     my_tpool = tp;
+     return prev;
+}
+
+void X(tpool_leave)(tpool *prev)
+{
+     my_tpool = prev;
+}
+
+void X(threads_max_workers)(int n)
+{
+#pragma omp critical (fftw_workers)
+     max_workers = X(imax)(0, n);
+}
+
+/* placement is OMP_PLACES and OMP_PROC_BIND's business */
+void X(threads_affinity)(const int *cpus, int ncpus)
+{
+     UNUSED(cpus);
+     UNUSED(ncpus);
+}
+
+/* the threads a loop of NTHR blocks may use */
+static int cap_threads(int nthr)
+{
+     if (my_tpool)
+	  nthr = X(imin)(nthr, my_tpool->nthr);
+     if (max_workers > 0)
+	  nthr = X(imin)(nthr, max_workers + 1);
+     return nthr;
+}
+
+/* Loops called from inside a parallel region of the caller (say, an
+   omp parallel for over a batch of transforms) join its team as tasks,
+   which its threads pick up whenever they are idle, instead of opening
+   a nested region, which OpenMP either runs on one thread or, with
+   nesting enabled, oversubscribes the cpus.  Outside any team, a loop
+   opens a region as long as omp_get_max_active_levels allows one, and
+   otherwise runs on the calling thread.  Blocks are numbered by
+   thr_num, which is thus unique among those running, but not the
+   number of an OpenMP thread. */
+enum { IN_TEAM, NEW_TEAM, NO_TEAM };
+
+static int where_to_run(void)
+{
+     if (omp_get_num_threads() > 1)
+	  return IN_TEAM;
+     if (omp_get_active_level() < omp_get_max_active_levels())
+	  return NEW_TEAM;
+     return NO_TEAM;
+}
+
+static void run_block(int i, int block_size, int loopmax,
+		      spawn_function proc, void *data)
+{
+     spawn_data d;
+
+     d.max = (d.min = i * block_size) + block_size;
+     if (d.max > loopmax)
+	  d.max = loopmax;
+     d.thr_num = i;
+     d.data = data;
+     proc(&d);
+}
+
+/* blocks 0..NBLK-1 as tasks of the current team, or in turn on the
+   calling thread, returning when all are done.  The tasks are tied:
+   a block uses the per-thread scratch pool, arena and workspace, so it
+   must not resume on another thread after a scheduling point. */
+static void run_blocks(int nblk, int block_size, int loopmax,
+		       spawn_function proc, void *data, int where)
+{
+     int i;
+
+     if (where == NO_TEAM) {
+	  for (i = 0; i < nblk; ++i)
+	       run_block(i, block_size, loopmax, proc, data);
+	  return;
+     }
+
+#if _OPENMP >= 201511 /* OpenMP 4.5 */
+#pragma omp taskloop grainsize(1)
+     for (i = 0; i < nblk; ++i)
+	  run_block(i, block_size, loopmax, proc, data);
+#else
+     for (i = 0; i < nblk; ++i) {
+#pragma omp task
+	  run_block(i, block_size, loopmax, proc, data);
+     }
+#pragma omp taskwait
+#endif
+}
+
 int X(ithreads_init)(void)
 {
+     install_arena_hooks();
      return 0; /* no error */
 }
 
@@ -40,7 +250,7 @@ int X(ithreads_init)(void)
    This function returns only after all the threads have completed. */
 void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
 {
-     int block_size;
+     int block_size, where;
      spawn_data d;
      int i;
 
@@ -49,6 +259,7 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
      A(proc);
 
      if (!loopmax) return;
+     nthr = cap_threads(nthr);
 
      /* Choose the block size and number of threads in order to (1)
         minimize the critical path and (2) use the fewest threads that
@@ -74,7 +285,12 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
           return;
      }
 
-#pragma omp parallel for private(d)
+     if ((where = where_to_run()) != NEW_TEAM) {
+	  run_blocks(nthr, block_size, loopmax, proc, data, where);
+	  return;
+     }
+
+#pragma omp parallel for num_threads(nthr) private(d)
      for (i = 0; i < nthr; ++i) {
 	  d.max = (d.min = i * block_size) + block_size;
 	  if (d.max > loopmax)
@@ -85,12 +301,168 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
      }
 }
 
+/* Work stealing (X(spawn_chunks)) is left to the OpenMP runtime: its
+   dynamic schedule, or its task scheduler, hands each chunk to the next
+   idle thread. */
+void X(spawn_chunks)(int nchunk, int nthr, spawn_function proc, void *data)
+{
+     spawn_data d;
+     int i, where;
+
+     nthr = cap_threads(nthr);
+     if (nchunk <= nthr || X(spawnloop_callback)) {
+	  X(spawn_loop)(nchunk, nthr, proc, data);
+	  return;
+     }
+     if ((where = where_to_run()) != NEW_TEAM) {
+	  run_blocks(nchunk, 1, nchunk, proc, data, where);
+	  return;
+     }
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthr) private(d)
+     for (i = 0; i < nchunk; ++i) {
+	  d.min = i;
+	  d.max = i + 1;
+	  d.thr_num = omp_get_thread_num();
+	  d.data = data;
+	  proc(&d);
+     }
+}
+
+/* Asynchronous execution (X(async_submit)) needs workers outside any
+   team, which OpenMP does not give us: a job runs at submission. */
+void X(async_submit)(async_job *j)
+{
+     j->next = 0;
+     j->sync = 0;
+     j->finished = 0;
+     j->run(&j, 1);
+     if (j->done)
+	  j->done(j->arg);
+     j->finished = 1;
+}
+
+int X(async_test)(async_job *j)
+{
+     return j->finished;
+}
+
+void X(async_wait)(async_job *j)
+{
+     UNUSED(j);
+}
+
+/* Concurrent plan measurement (X(measure_loop_hook)).  Thread
+   placement is left to the OpenMP runtime (OMP_PROC_BIND), so PIN is
+   ignored. */
+int X(measure_ncpus)(void)
+{
+     return omp_get_num_procs();
+}
+
+void X(measure_loop)(int n, int nslots, int pin, 
+		     measure_function f, void *data)
+{
+     int i;
+
+     UNUSED(pin);
+     A(n >= 0 && nslots > 0);
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nslots)
+     for (i = 0; i < n; ++i)
+	  f(data, i, omp_get_thread_num());
+}
+
+/* Pinned robust timing (X(measure_pin_hook)): placement is the OpenMP
+   runtime's business here too, so the caller is never bound. */
+void *X(measure_pin)(void)
+{
+     return 0;
+}
+
+void X(measure_unpin)(void *saved)
+{
+     UNUSED(saved);
+}
+
+/* Per-thread planners (X(make_planner_concurrent)).  OpenMP offers no
+   thread-exit hook, so planners live until X(thread_planners_cleanup). */
+struct tplanner {
+     planner *plnr;
+     struct tplanner *next;
+};
+
+static struct tplanner *my_tplanner;
+#pragma omp threadprivate(my_tplanner)
+
+static unsigned tplanners_gen; /* invalidates stale MY_TPLANNERs */
+static unsigned my_tplanner_gen;
+#pragma omp threadprivate(my_tplanner_gen)
+
+static omp_lock_t tplanners_lock, caches_lock;
+static struct tplanner *tplanners;
+static planner *(*tplanner_mk)(void);
+
+static void lock_caches(void) { omp_set_lock(&caches_lock); }
+static void unlock_caches(void) { omp_unset_lock(&caches_lock); }
+
+int X(thread_planners_init)(planner *(*mk)(void))
+{
+     omp_init_lock(&tplanners_lock);
+     omp_init_lock(&caches_lock);
+     tplanners = 0;
+     ++tplanners_gen;
+     tplanner_mk = mk;
+     X(lock_caches_hook) = lock_caches;
+     X(unlock_caches_hook) = unlock_caches;
+     return 1;
+}
+
+planner *X(thread_planner)(void)
+{
+     if (!my_tplanner || my_tplanner_gen != tplanners_gen) {
+	  struct tplanner *t;
+	  t = (struct tplanner *) MALLOC(sizeof(struct tplanner), PLANNERS);
+	  t->plnr = tplanner_mk();
+	  omp_set_lock(&tplanners_lock);
+	  t->next = tplanners;
+	  tplanners = t;
+	  omp_unset_lock(&tplanners_lock);
+	  my_tplanner = t;
+	  my_tplanner_gen = tplanners_gen;
+     }
+     return my_tplanner->plnr;
+}
+
+/* no thread may be planning */
+void X(thread_planners_cleanup)(void)
+{
+     while (tplanners) {
+	  struct tplanner *t = tplanners;
+	  tplanners = t->next;
+	  X(planner_destroy)(t->plnr);
+	  X(ifree)(t);
+     }
+     X(lock_caches_hook) = 0;
+     X(unlock_caches_hook) = 0;
+     omp_destroy_lock(&tplanners_lock);
+     omp_destroy_lock(&caches_lock);
+}
+
+/* no plan may be executing */
 void X(threads_cleanup)(void)
 {
+#pragma omp critical (fftw_spools)
+     {
+	  struct spool *t;
+	  for (t = spools; t; t = t->next)
+	       X(scratch_pool_flush)(t->p);
+     }
 }
 
 /* FIXME [Matteo Frigo 2015-05-25] What does "thread-safe"
    mean for openmp? */
 void X(threads_register_planner_hooks)(void)
 {
+     install_arena_hooks();
 }
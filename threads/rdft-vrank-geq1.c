@@ -26,13 +26,15 @@ typedef struct {
      int vecloop_dim;
      const int *buddies;
      size_t nbuddies;
+     int shift;			/* uses nthr >> shift threads */
 } S;
 
 typedef struct {
      plan_rdft super;
      plan **cldrn;
      INT its, ots;
-     int nthr;
+     int nblk;			/* blocks, one child plan each */
+     int nthr;			/* threads to run them on */
      const S *solver;
 } P;
 
@@ -45,11 +47,13 @@ typedef struct {
 static void *spawn_apply(spawn_data *d)
 {
      PD *ego = (PD *) d->data;
-     int thr_num = d->thr_num;
-     plan_rdft *cld = (plan_rdft *) ego->cldrn[d->thr_num];
+     int i;
 
-     cld->apply((plan *) cld,
-		ego->I + thr_num * ego->its, ego->O + thr_num * ego->ots);
+     for (i = d->min; i < d->max; ++i) {
+	  plan_rdft *cld = (plan_rdft *) ego->cldrn[i];
+	  cld->apply((plan *) cld,
+		     ego->I + i * ego->its, ego->O + i * ego->ots);
+     }
      return 0;
 }
 
@@ -63,14 +67,14 @@ static void apply(const plan *ego_, R *I, R *O)
      d.cldrn = ego->cldrn;
      d.I = I; d.O = O;
 
-     X(spawn_loop)(ego->nthr, ego->nthr, spawn_apply, (void*) &d);
+     X(spawn_chunks)(ego->nblk, ego->nthr, spawn_apply, (void*) &d);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
 {
      P *ego = (P *) ego_;
      int i;
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  X(plan_awake)(ego->cldrn[i], wakefulness);
 }
 
@@ -78,9 +82,9 @@ static void destroy(plan *ego_)
 {
      P *ego = (P *) ego_;
      int i;
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  X(plan_destroy_internal)(ego->cldrn[i]);
-     X(ifree)(ego->cldrn);
+     X(arena_ifree)(ego->cldrn);
 }
 
 static void print(const plan *ego_, printer *p)
@@ -89,7 +93,7 @@ static void print(const plan *ego_, printer *p)
      const S *s = ego->solver;
      int i;
      p->print(p, "(rdft-thr-vrank>=1-x%d/%d", ego->nthr, s->vecloop_dim);
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  if (i == 0 || (ego->cldrn[i] != ego->cldrn[i-1] &&
 			 (i <= 1 || ego->cldrn[i] != ego->cldrn[i-2])))
 	       p->print(p, "%(%p%)", ego->cldrn[i]);
@@ -110,6 +114,7 @@ static int applicable0(const solver *ego_, const problem *p_,
 
      return (1
 	     && plnr->nthr > 1
+	     && X(thr_nthr)(plnr->nthr, ego->shift) > 1
 	     && FINITE_RNK(p->vecsz->rnk)
 	     && p->vecsz->rnk > 0
 	     && pickdim(ego, p->vecsz, p->I != p->O, dp)
@@ -139,7 +144,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      int vdim;
      iodim *d;
      plan **cldrn = (plan **) 0;
-     int i, nthr;
+     int i, nblk, nthr;
      INT its, ots, block_size;
      tensor *vecsz;
 
@@ -153,19 +158,21 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      d = p->vecsz->dims + vdim;
 
-     block_size = (d->n + plnr->nthr - 1) / plnr->nthr;
-     nthr = (int)((d->n + block_size - 1) / block_size);
-     plnr->nthr = (plnr->nthr + nthr - 1) / nthr;
+     nthr = X(thr_nthr)(plnr->nthr, ego->shift);
+     block_size = X(thr_block_size)(d->n, nthr, plnr);
+     nblk = (int)((d->n + block_size - 1) / block_size);
+     plnr->nthr = (nthr + nblk - 1) / nblk;
+     nthr = X(imin)(nthr, nblk);
      its = d->is * block_size;
      ots = d->os * block_size;
 
-     cldrn = (plan **)MALLOC(sizeof(plan *) * nthr, PLANS);
-     for (i = 0; i < nthr; ++i) cldrn[i] = (plan *) 0;
+     cldrn = (plan **)MALLOC(sizeof(plan *) * nblk, PLANS);
+     for (i = 0; i < nblk; ++i) cldrn[i] = (plan *) 0;
      
      vecsz = X(tensor_copy)(p->vecsz);
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
 	  vecsz->dims[vdim].n =
-	       (i == nthr - 1) ? (d->n - i*block_size) : block_size;
+	       (i == nblk - 1) ? (d->n - i*block_size) : block_size;
 	  cldp = X(mkproblem_rdft)(p->sz, vecsz,
 				   p->I + i*its, p->O + i*ots, p->kind);
 	  cldrn[i] = X(mkplan_d)(plnr, cldp);
@@ -178,45 +185,54 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->cldrn = cldrn;
      pln->its = its;
      pln->ots = ots;
+     pln->nblk = nblk;
      pln->nthr = nthr;
 
      pln->solver = ego;
      X(ops_zero)(&pln->super.super.ops);
      pln->super.super.pcost = 0;
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
 	  X(ops_add2)(&cldrn[i]->ops, &pln->super.super.ops);
 	  pln->super.super.pcost += cldrn[i]->pcost;
+	  pln->super.super.nthr = X(imax)(pln->super.super.nthr,
+					  nthr * cldrn[i]->nthr);
      }
+     X(thr_ops)(&pln->super.super.ops, &pln->super.super.ops, nthr);
 
      return &(pln->super.super);
 
  nada:
      if (cldrn) {
-	  for (i = 0; i < nthr; ++i)
+	  for (i = 0; i < nblk; ++i)
 	       X(plan_destroy_internal)(cldrn[i]);
-	  X(ifree)(cldrn);
+	  X(arena_ifree)(cldrn);
      }
      X(tensor_destroy)(vecsz);
      return (plan *) 0;
 }
 
-static solver *mksolver(int vecloop_dim, const int *buddies, size_t nbuddies)
+static solver *mksolver(int vecloop_dim, const int *buddies, size_t nbuddies,
+			int shift)
 {
      static const solver_adt sadt = { PROBLEM_RDFT, mkplan, 0 };
      S *slv = MKSOLVER(S, &sadt);
      slv->vecloop_dim = vecloop_dim;
      slv->buddies = buddies;
      slv->nbuddies = nbuddies;
+     slv->shift = shift;
      return &(slv->super);
 }
 
 void X(rdft_thr_vrank_geq1_register)(planner *p)
 {
      size_t i;
+     int shift;
 
      /* FIXME: Should we try other vecloop_dim values? */
      static const int buddies[] = { 1, -1 };
 
-     for (i = 0; i < NELEM(buddies); ++i)
-          REGISTER_SOLVER(p, mksolver(buddies[i], buddies, NELEM(buddies)));
+     for (shift = 0; shift < THR_NSHIFT; ++shift)
+	  for (i = 0; i < NELEM(buddies); ++i)
+	       REGISTER_SOLVER(p, mksolver(buddies[i], buddies,
+					   NELEM(buddies), shift));
 }
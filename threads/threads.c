@@ -22,6 +22,11 @@
    function.  The first portion of this file is a set of macros to
    spawn and join threads on various systems. */
 
+/* for sched_getaffinity and pthread_setaffinity_np */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#  define _GNU_SOURCE
+#endif
+
 #include "threads/threads.h"
 #include "api/api.h"
 
@@ -29,9 +34,14 @@
 
 #include <pthread.h>
 
+#if defined(__linux__) && defined(CPU_SETSIZE)
+#  define MEASURE_PIN 1
+#endif
+
 #ifdef HAVE_UNISTD_H
 #  include <unistd.h>
 #endif
+#include <time.h>
 
 /* implementation of semaphores and mutexes: */
 #if (defined(_POSIX_SEMAPHORES) && (_POSIX_SEMAPHORES >= 200112L))
@@ -156,6 +166,99 @@ typedef pthread_mutex_t os_static_mutex_t;
 static void os_static_mutex_lock(os_static_mutex_t *s) { pthread_mutex_lock(s); }
 static void os_static_mutex_unlock(os_static_mutex_t *s) { pthread_mutex_unlock(s); }
 
+/* thread-local storage */
+typedef pthread_key_t os_tls_t;
+static int os_tls_init(os_tls_t *k, void (*dtor)(void *))
+{
+     return !pthread_key_create(k, dtor);
+}
+static void os_tls_destroy(os_tls_t *k) { pthread_key_delete(*k); }
+static void *os_tls_get(os_tls_t *k) { return pthread_getspecific(*k); }
+static void os_tls_set(os_tls_t *k, void *v) { pthread_setspecific(*k, v); }
+
+/* bind the calling thread to CPU, where the system allows it, or if
+   CPU < 0 let it run on all the cpus that the process could at first */
+#ifdef MEASURE_PIN
+static cpu_set_t os_process_cpus;
+static int os_process_cpus_known = 0;
+#endif
+
+static void os_pin_thread(int cpu)
+{
+#ifdef MEASURE_PIN
+     cpu_set_t one;
+     if (cpu >= 0 && cpu < CPU_SETSIZE) {
+	  CPU_ZERO(&one);
+	  CPU_SET(cpu, &one);
+	  pthread_setaffinity_np(pthread_self(), sizeof(one), &one);
+     } else if (cpu < 0 && os_process_cpus_known)
+	  pthread_setaffinity_np(pthread_self(), sizeof(os_process_cpus),
+				 &os_process_cpus);
+#else
+     UNUSED(cpu);
+#endif
+}
+
+static void os_pin_init(void)
+{
+#ifdef MEASURE_PIN
+     if (!os_process_cpus_known)
+	  os_process_cpus_known =
+	       !sched_getaffinity(0, sizeof(os_process_cpus), &os_process_cpus);
+#endif
+}
+
+/* atomics and a clock, for the spinning pool */
+#if defined(__GNUC__)
+#  define HAVE_SPIN_POOL 1
+typedef volatile int os_atomic_t;
+static int os_atomic_get(os_atomic_t *p)
+{
+     return __atomic_load_n(p, __ATOMIC_SEQ_CST);
+}
+static void os_atomic_set(os_atomic_t *p, int v)
+{
+     __atomic_store_n(p, v, __ATOMIC_SEQ_CST);
+}
+static int os_atomic_swap(os_atomic_t *p, int v)
+{
+     return __atomic_exchange_n(p, v, __ATOMIC_SEQ_CST);
+}
+static int os_atomic_dec(os_atomic_t *p)
+{
+     return __atomic_sub_fetch(p, 1, __ATOMIC_SEQ_CST);
+}
+static int os_atomic_cas(os_atomic_t *p, int old, int v)
+{
+     return __atomic_compare_exchange_n(p, &old, v, 0, __ATOMIC_SEQ_CST,
+					__ATOMIC_SEQ_CST);
+}
+static void os_cpu_relax(void)
+{
+#  if defined(__i386__) || defined(__x86_64__)
+     __builtin_ia32_pause();
+#  elif defined(__aarch64__) || defined(__arm__)
+     __asm__ __volatile__("yield");
+#  endif
+}
+
+#  if defined(_POSIX_TIMERS) && (_POSIX_TIMERS > 0) && defined(CLOCK_MONOTONIC)
+static double os_seconds(void)
+{
+     struct timespec t;
+     clock_gettime(CLOCK_MONOTONIC, &t);
+     return (double) t.tv_sec + 1.0e-9 * (double) t.tv_nsec;
+}
+#  else
+static double os_seconds(void)
+{
+     struct timeval t;
+     gettimeofday(&t, 0);
+     return (double) t.tv_sec + 1.0e-6 * (double) t.tv_usec;
+}
+#  endif
+#endif
+
 #elif defined(__WIN32__) || defined(_WIN32) || defined(_WINDOWS)
 /* hack: windef.h defines INT for its own purposes and this causes
    a conflict with our own INT in ifftw.h.  Divert the windows
@@ -245,6 +348,66 @@ static void os_static_mutex_unlock(os_static_mutex_t *s)
      LONG old = InterlockedExchange(s, 0);
      A(old == 1);
 }
+
+/* thread-local storage.  There are no destructors: the values of
+   exited threads are reclaimed by whoever destroys the key */
+typedef DWORD os_tls_t;
+static int os_tls_init(os_tls_t *k, void (*dtor)(void *))
+{
+     UNUSED(dtor);
+     *k = TlsAlloc();
+     return *k != TLS_OUT_OF_INDEXES;
+}
+static void os_tls_destroy(os_tls_t *k) { TlsFree(*k); }
+static void *os_tls_get(os_tls_t *k) { return TlsGetValue(*k); }
+static void os_tls_set(os_tls_t *k, void *v) { TlsSetValue(*k, v); }
+
+static DWORD_PTR os_process_cpus = 0;
+
+static void os_pin_thread(int cpu)
+{
+     if (cpu >= 0 && cpu < (int) (8 * sizeof(DWORD_PTR)))
+	  SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR) 1 << cpu);
+     else if (cpu < 0 && os_process_cpus)
+	  SetThreadAffinityMask(GetCurrentThread(), os_process_cpus);
+}
+
+static void os_pin_init(void)
+{
+     DWORD_PTR system_cpus;
+     if (!os_process_cpus)
+	  GetProcessAffinityMask(GetCurrentProcess(), &os_process_cpus,
+				 &system_cpus);
+}
+
+/* atomics and a clock, for the spinning pool */
+#define HAVE_SPIN_POOL 1
+typedef volatile LONG os_atomic_t;
+static int os_atomic_get(os_atomic_t *p)
+{
+     LONG v = *p;
+     MemoryBarrier();
+     return (int) v;
+}
+static void os_atomic_set(os_atomic_t *p, int v) { InterlockedExchange(p, v); }
+static int os_atomic_swap(os_atomic_t *p, int v)
+{
+     return (int) InterlockedExchange(p, v);
+}
+static int os_atomic_dec(os_atomic_t *p) { return (int) InterlockedDecrement(p); }
+static int os_atomic_cas(os_atomic_t *p, int old, int v)
+{
+     return InterlockedCompareExchange(p, v, old) == old;
+}
+static void os_cpu_relax(void) { YieldProcessor(); }
+
+static double os_seconds(void)
+{
+     LARGE_INTEGER t, f;
+     QueryPerformanceCounter(&t);
+     QueryPerformanceFrequency(&f);
+     return (double) t.QuadPart / (double) f.QuadPart;
+}
 #else
 #error "No threading layer defined"
 #endif
@@ -291,6 +454,34 @@ static struct worker *worker_queue;
      os_mutex_unlock(&queue_lock);		\
 }
 
+/* Workers of the queue, of the spinning pool and of the thread pools
+   of X(threadpool_create) all count against one limit, if any
+   (X(threads_set_max_workers)); loops that cannot have a worker for a
+   block do it in the calling thread instead.  Guarded by queue_lock. */
+static int max_workers = 0;	/* 0: no limit */
+static int nworkers = 0;
+
+/* leave to create up to N more workers; returns how many */
+static int reserve_workers(int n)
+{
+     WITH_QUEUE_LOCK({
+	  if (max_workers > 0)
+	       n = X(imin)(n, X(imax)(0, max_workers - nworkers));
+	  nworkers += n;
+     });
+     return n;
+}
+
+static void release_workers(int n)
+{
+     WITH_QUEUE_LOCK(nworkers -= n);
+}
+
+void X(threads_max_workers)(int n)
+{
+     WITH_QUEUE_LOCK(max_workers = X(imax)(0, n));
+}
+
 static FFTW_WORKER worker(void *arg)
 {
      struct worker *ego = (struct worker *)arg;
@@ -338,13 +529,13 @@ static struct worker *dequeue(void)
 	       worker_queue = q->cdr;
      });
 
-     if (!q) {
+     if (!q && reserve_workers(1)) {
 	  /* no worker is available.  Create one */
 	  q = make_worker();
 	  os_create_thread(worker, q);
      }
 
-     return q;
+     return q; /* 0 if over the limit */
 }
 
 
@@ -369,14 +560,673 @@ static void kill_workforce(void)
 	       os_sem_up(&q->ready);
 	       os_sem_down(&termination_semaphore);
 	       unmake_worker(q);
+	       --nworkers;
 	  }
      });
 }
 
+/* Spinning pools.  A spawn_loop that gets hold of a pool hands its
+   blocks to persistent workers through slots of their own, on cache
+   lines of their own, and joins them at a sense-reversing barrier.
+   Workers waiting for work, and the thread waiting at the barrier,
+   spin for X(threads_spin_time) seconds before they sleep on a
+   semaphore, so that back-to-back loops of small transforms make no
+   system calls.
+
+   Loops run on the pool that is current in the calling thread (see
+   X(tpool_enter)), if any, and otherwise on a global pool that grows
+   as needed.  A loop that finds the global pool taken (nested in
+   another one, or concurrent with it) uses the queue above; one that
+   finds its thread pool taken, or without workers, runs alone, so that
+   the threads of a thread pool are all it ever uses. */
+#ifdef HAVE_SPIN_POOL
+#define CACHE_LINE 64
+
+struct pslot {
+     os_atomic_t seq;		/* bumped to hand W over */
+     os_atomic_t sleeping;	/* the worker waits on WAKE */
+     struct work *w;
+     struct X(threadpool_s) *owner;
+     int cpu;			/* to pin the worker to, or -1 */
+     os_sem_t wake;
+     char pad[CACHE_LINE];
+};
+
+struct X(threadpool_s) {
+     char pad0[CACHE_LINE];
+     os_atomic_t count;		/* barrier: workers yet to arrive */
+     os_atomic_t sense;		/* flipped by the last of them */
+     os_atomic_t sleeping;	/* the joining thread waits on WAKE */
+     char pad1[CACHE_LINE];
+     os_atomic_t busy;		/* a loop has the pool */
+     struct pslot **slot;
+     int n;			/* workers */
+     int user;			/* made by X(mktpool), of fixed size */
+     os_sem_t wake;
+     char pad2[CACHE_LINE];
+};
+typedef struct X(threadpool_s) tpool;
+
+static tpool gpool;
+
+/* Workers of the global pool run block i of every loop, the i-th of
+   them on cpu AFFINITY[i % NAFFINITY] if NAFFINITY > 0, so that a plan
+   touches the same memory from the same cpu at each execution (the
+   last block runs in the calling thread, wherever it is). */
+static int *affinity = 0;
+static int naffinity = 0;
+
+/* wait until *P is no longer OLD: spin, then sleep on S after telling
+   the waker (signal_change) through *SLEEPING */
+static void wait_change(os_atomic_t *p, int old, os_atomic_t *sleeping,
+			os_sem_t *s)
+{
+     double spin = X(threads_spin_time);
+
+     if (spin > 0) {
+	  double t0 = os_seconds();
+	  int i;
+
+	  for (i = 1; os_atomic_get(p) == old; ++i) {
+	       os_cpu_relax();
+	       if (!(i & 255) && os_seconds() - t0 > spin)
+		    break;
+	  }
+     }
+     if (os_atomic_get(p) != old)
+	  return;
+
+     os_atomic_set(sleeping, 1);
+     if (os_atomic_get(p) != old && os_atomic_swap(sleeping, 0))
+	  return; /* nobody saw us asleep */
+     os_sem_down(s);
+}
+
+static void signal_change(os_atomic_t *p, int v, os_atomic_t *sleeping,
+			  os_sem_t *s)
+{
+     os_atomic_set(p, v);
+     if (os_atomic_swap(sleeping, 0))
+	  os_sem_up(s);
+}
+
+static void set_tpool(tpool *tp);
+
+static FFTW_WORKER pool_worker(void *arg)
+{
+     struct pslot *ego = (struct pslot *)arg;
+     tpool *tp = ego->owner;
+     struct work *w;
+     int seq = 0, pinned = ego->cpu;
+
+     if (pinned >= 0)
+	  os_pin_thread(pinned);
+     if (tp->user)
+	  set_tpool(tp); /* for the loops nested in ours */
+
+     for (;;) {
+	  wait_change(&ego->seq, seq, &ego->sleeping, &ego->wake);
+	  seq = os_atomic_get(&ego->seq);
+	  w = ego->w;
+
+	  if (ego->cpu != pinned) /* X(threads_affinity) moved us */
+	       os_pin_thread(pinned = ego->cpu);
+
+	  /* !w->proc ==> terminate worker */
+	  if (!w->proc) break;
+
+	  w->proc(&w->d);
+
+	  if (os_atomic_dec(&tp->count) == 0)
+	       signal_change(&tp->sense, !os_atomic_get(&tp->sense),
+			     &tp->sleeping, &tp->wake);
+     }
+
+     os_sem_up(&termination_semaphore);
+     os_destroy_thread();
+     /* UNREACHABLE */
+     return 0;
+}
+
+static void pool_init(tpool *tp, int user)
+{
+     tp->count = tp->sense = tp->sleeping = 0;
+     tp->busy = 0;
+     tp->slot = 0;
+     tp->n = 0;
+     tp->user = user;
+     os_sem_init(&tp->wake);
+}
+
+/* give TP K more workers, the i-th of them pinned to CPUS[i % NCPUS]
+   if NCPUS > 0 */
+static void pool_grow(tpool *tp, int k, const int *cpus, int ncpus)
+{
+     struct pslot **p = (struct pslot **)
+	  MALLOC((tp->n + k) * sizeof(struct pslot *), OTHER);
+     int i;
+
+     for (i = 0; i < tp->n; ++i)
+	  p[i] = tp->slot[i];
+     for (; i < tp->n + k; ++i) {
+	  struct pslot *q = (struct pslot *)MALLOC(sizeof(*q), OTHER);
+	  q->seq = 0;
+	  q->sleeping = 0;
+	  q->owner = tp;
+	  q->cpu = ncpus > 0 ? cpus[i % ncpus] : -1;
+	  os_sem_init(&q->wake);
+	  p[i] = q;
+	  os_create_thread(pool_worker, q);
+     }
+     X(ifree0)(tp->slot);
+     tp->slot = p;
+     tp->n += k;
+}
+
+/* take TP, if nobody has it, and as many workers as it has up to N
+   (the global pool first grows to N, within the limit); returns the
+   number of workers, 0 if none */
+static int pool_acquire(tpool *tp, int n)
+{
+     if (!os_atomic_cas(&tp->busy, 0, 1))
+	  return 0;
+
+     if (!tp->user && n > tp->n) {
+	  int k = reserve_workers(n - tp->n);
+	  if (k > 0)
+	       pool_grow(tp, k, affinity, naffinity);
+     }
+     n = X(imin)(n, tp->n);
+     if (!n)
+	  os_atomic_set(&tp->busy, 0);
+     return n;
+}
+
+/* run R[0..nthr-1] on TP, the last one ourselves */
+static void pool_run(tpool *tp, struct work *r, int nthr)
+{
+     int sense = os_atomic_get(&tp->sense);
+     int i;
+
+     os_atomic_set(&tp->count, nthr - 1);
+     for (i = 0; i < nthr - 1; ++i) {
+	  struct pslot *q = tp->slot[i];
+	  q->w = &r[i];
+	  signal_change(&q->seq, os_atomic_get(&q->seq) + 1,
+			&q->sleeping, &q->wake);
+     }
+     r[nthr - 1].proc(&r[nthr - 1].d);
+     wait_change(&tp->sense, sense, &tp->sleeping, &tp->wake);
+     os_atomic_set(&tp->busy, 0);
+}
+
+static void pool_kill(tpool *tp)
+{
+     struct work w;
+     int i;
+
+     w.proc = 0;
+     for (i = 0; i < tp->n; ++i) {
+	  struct pslot *q = tp->slot[i];
+	  q->w = &w;
+	  signal_change(&q->seq, os_atomic_get(&q->seq) + 1,
+			&q->sleeping, &q->wake);
+	  os_sem_down(&termination_semaphore);
+	  os_sem_destroy(&q->wake);
+	  X(ifree)(q);
+     }
+     release_workers(tp->n);
+     X(ifree0)(tp->slot);
+     tp->slot = 0;
+     tp->n = 0;
+     os_sem_destroy(&tp->wake);
+}
+
+static void pools_init(void)
+{
+     int ncpus = X(measure_ncpus)();
+
+     pool_init(&gpool, 0);
+
+     /* spinning on the only cpu only delays the thread we wait for */
+     if (X(threads_spin_time) < 0)
+	  X(threads_spin_time) = ncpus == 1 ? 0 : 50.0e-6;
+}
+
+static void pools_kill(void)
+{
+     pool_kill(&gpool);
+     X(ifree0)(affinity);
+     affinity = 0;
+     naffinity = 0;
+}
+
+/* pin the workers of the global pool to CPUS[0..NCPUS-1], or unpin
+   them if NCPUS <= 0; the workers move at their next block, so no
+   loop may be running */
+void X(threads_affinity)(const int *cpus, int ncpus)
+{
+     int i;
+
+     X(ifree0)(affinity);
+     affinity = 0;
+     naffinity = 0;
+     if (cpus && ncpus > 0) {
+	  affinity = (int *)MALLOC(ncpus * sizeof(int), OTHER);
+	  for (i = 0; i < ncpus; ++i)
+	       affinity[i] = cpus[i];
+	  naffinity = ncpus;
+     }
+     for (i = 0; i < gpool.n; ++i)
+	  gpool.slot[i]->cpu = naffinity > 0 ? affinity[i % naffinity] : -1;
+}
+
+/* a thread pool of NTHREADS threads: the thread that executes on it
+   and NTHREADS - 1 workers, fewer if over the limit on workers */
+tpool *X(mktpool)(int nthreads, const int *cpus, int ncpus)
+{
+     tpool *tp = (tpool *)MALLOC(sizeof(tpool), OTHER);
+     int k;
+
+     pool_init(tp, 1);
+     k = reserve_workers(X(imax)(0, nthreads - 1));
+     if (k > 0)
+	  pool_grow(tp, k, cpus, cpus ? ncpus : 0);
+     return tp;
+}
+
+/* TP must be idle */
+void X(tpool_destroy)(tpool *tp)
+{
+     if (tp) {
+	  A(!tp->busy);
+	  pool_kill(tp);
+	  X(ifree)(tp);
+     }
+}
+
+int X(tpool_nthreads)(const tpool *tp)
+{
+     return tp->n + 1;
+}
+#else
+typedef struct X(threadpool_s) tpool;
+static int pool_acquire(tpool *tp, int n) { UNUSED(tp); UNUSED(n); return 0; }
+static void pool_run(tpool *tp, struct work *r, int nthr)
+{
+     UNUSED(tp); UNUSED(r); UNUSED(nthr);
+}
+static void pools_init(void) {}
+static void pools_kill(void) {}
+void X(threads_affinity)(const int *cpus, int ncpus)
+{
+     UNUSED(cpus); UNUSED(ncpus);
+}
+struct X(threadpool_s) { int n; };
+static tpool gpool;
+
+/* there are no thread pools without atomics */
+tpool *X(mktpool)(int nthreads, const int *cpus, int ncpus)
+{
+     UNUSED(nthreads); UNUSED(cpus); UNUSED(ncpus);
+     return 0;
+}
+void X(tpool_destroy)(tpool *tp) { UNUSED(tp); }
+int X(tpool_nthreads)(const tpool *tp) { UNUSED(tp); return 1; }
+#endif
+
+/* The thread pool current in each thread, whose workers run the loops
+   that the thread spawns.  The key is never destroyed. */
+static os_static_mutex_t tpool_key_mutex = OS_STATIC_MUTEX_INITIALIZER;
+static os_tls_t tpool_key;
+static int tpool_key_installed = 0;
+
+static tpool *get_tpool(void)
+{
+     return tpool_key_installed ? (tpool *) os_tls_get(&tpool_key) : 0;
+}
+static void set_tpool(tpool *tp) { os_tls_set(&tpool_key, tp); }
+
+static void install_tpool_key(void)
+{
+     os_static_mutex_lock(&tpool_key_mutex); {
+	  if (!tpool_key_installed && os_tls_init(&tpool_key, 0))
+	       tpool_key_installed = 1;
+     } os_static_mutex_unlock(&tpool_key_mutex);
+}
+
+/* make TP (or none, if 0) current in this thread; returns the pool it
+   replaces, to be given back to X(tpool_leave) */
+tpool *X(tpool_enter)(tpool *tp)
+{
+     tpool *prev = get_tpool();
+     if (tp != prev)
+	  set_tpool(tp);
+     return prev;
+}
+
+void X(tpool_leave)(tpool *prev)
+{
+     if (get_tpool() != prev)
+	  set_tpool(prev);
+}
+
+/* Each thread has its own current arena (X(arena_enter)), lest a
+   thread that creates a problem take it from the arena in which
+   another one is planning, and, where the compiler has no
+   THREAD_LOCAL, its own current scratch workspace (X(scratch_enter)),
+   lest plans executed at once by different threads share one.  The
+   keys are never destroyed. */
+static os_static_mutex_t arena_key_mutex = OS_STATIC_MUTEX_INITIALIZER;
+static os_tls_t arena_key;
+static int arena_key_installed = 0;
+
+static arena *get_arena(void) { return (arena *) os_tls_get(&arena_key); }
+static void set_arena(arena *a) { os_tls_set(&arena_key, a); }
+
+#ifndef THREAD_LOCAL
+static os_tls_t scratch_key;
+
+static scratch *get_scratch(void)
+{
+     return (scratch *) os_tls_get(&scratch_key);
+}
+
+static void set_scratch(scratch *s) { os_tls_set(&scratch_key, s); }
+#endif
+
+static void install_arena_hooks(void)
+{
+     os_static_mutex_lock(&arena_key_mutex); {
+	  if (!arena_key_installed && os_tls_init(&arena_key, 0)) {
+#ifndef THREAD_LOCAL
+	       if (os_tls_init(&scratch_key, 0)) {
+		    X(scratch_get_hook) = get_scratch;
+		    X(scratch_set_hook) = set_scratch;
+	       }
+#endif
+	       X(arena_get_hook) = get_arena;
+	       X(arena_set_hook) = set_arena;
+	       arena_key_installed = 1;
+	  }
+     } os_static_mutex_unlock(&arena_key_mutex);
+}
+
+/* Each thread has its own pool of scratch buffers (X(scratch_malloc)),
+   made with its first buffer and destroyed when it exits, so that no
+   lock guards the buffers.  The pools are listed for their statistics,
+   to which those of the exited threads add in RETIRED.  The key is
+   never destroyed. */
+struct spool {
+     scratch_pool *p;
+     struct spool *prev, *next;
+};
+static os_static_mutex_t spools_mutex = OS_STATIC_MUTEX_INITIALIZER;
+static os_tls_t spool_key;
+static int spool_key_installed = 0;
+static struct spool *spools = 0;
+static scratch_pool_stats retired;
+
+static void spool_unlink(struct spool *t)
+{
+     if (t->prev) t->prev->next = t->next;
+     else spools = t->next;
+     if (t->next) t->next->prev = t->prev;
+}
+
+static void spool_exit(void *t_)
+{
+     struct spool *t = (struct spool *) t_;
+
+     X(scratch_pool_flush)(t->p);
+     os_static_mutex_lock(&spools_mutex); {
+	  spool_unlink(t);
+	  X(scratch_pool_add_stats)(t->p, &retired);
+     } os_static_mutex_unlock(&spools_mutex);
+     X(scratch_pool_destroy)(t->p);
+     X(ifree)(t);
+}
+
+static scratch_pool *get_spool(void)
+{
+     struct spool *t = (struct spool *) os_tls_get(&spool_key);
+
+     if (!t) {
+	  t = (struct spool *) MALLOC(sizeof(struct spool), OTHER);
+	  t->p = X(mkscratch_pool)();
+	  os_static_mutex_lock(&spools_mutex); {
+	       t->prev = 0;
+	       t->next = spools;
+	       if (spools) spools->prev = t;
+	       spools = t;
+	  } os_static_mutex_unlock(&spools_mutex);
+	  os_tls_set(&spool_key, t);
+     }
+     return t->p;
+}
+
+static void install_spool_hook(void)
+{
+     os_static_mutex_lock(&spools_mutex); {
+	  if (!spool_key_installed && os_tls_init(&spool_key, spool_exit)) {
+	       X(scratch_pool_hook) = get_spool;
+	       spool_key_installed = 1;
+	  }
+     } os_static_mutex_unlock(&spools_mutex);
+}
+
+/* give the idle buffers of every pool back to the heap; no plan may be
+   executing */
+static void spools_flush(void)
+{
+     struct spool *t;
+
+     os_static_mutex_lock(&spools_mutex); {
+	  for (t = spools; t; t = t->next)
+	       X(scratch_pool_flush)(t->p);
+     } os_static_mutex_unlock(&spools_mutex);
+}
+
+/* the counts of the other threads are read as they change */
+void X(scratch_pools_stats)(scratch_pool_stats *s)
+{
+     struct spool *t;
+
+     os_static_mutex_lock(&spools_mutex); {
+	  *s = retired;
+	  for (t = spools; t; t = t->next)
+	       X(scratch_pool_add_stats)(t->p, s);
+     } os_static_mutex_unlock(&spools_mutex);
+}
+
+/* Asynchronous execution (X(async_submit)).  Jobs wait in a FIFO for
+   workers of their own, up to one per cpu, which are created as jobs
+   arrive and count against the limit of X(threads_max_workers).  A
+   worker takes the first job and every other queued one with the same
+   run function and key, up to ASYNC_BATCH, and runs them as one.  A
+   job that finds no worker, or the threads not initialized, runs at
+   submission.  Guarded by async_lock. */
+static os_mutex_t async_lock;
+static os_sem_t async_ready;	/* posted once per job, and to quit */
+static async_job *async_head, *async_tail;
+static int async_on = 0;
+static int async_nworkers, async_maxworkers, async_idle, async_queued;
+static int async_quit;
+
+/* the first job and its batch; the queue must not be empty */
+static int async_take(async_job **jobs)
+{
+     async_job *first = async_head, *j, **pp, *last = 0;
+     int n = 1;
+
+     jobs[0] = first;
+     async_head = first->next;
+     for (pp = &async_head; (j = *pp); ) {
+	  if (n < ASYNC_BATCH && j->run == first->run && j->key == first->key) {
+	       *pp = j->next;
+	       jobs[n++] = j;
+	  } else {
+	       last = j;
+	       pp = &j->next;
+	  }
+     }
+     async_tail = last;
+     async_queued -= n;
+     return n;
+}
+
+static void async_finish(async_job *j)
+{
+     if (async_on) {
+	  os_mutex_lock(&async_lock);
+	  j->finished = 1;
+	  os_mutex_unlock(&async_lock);
+     } else
+	  j->finished = 1;
+}
+
+static void async_run(async_job **jobs, int n)
+{
+     int i;
+
+     jobs[0]->run(jobs, n);
+     for (i = 0; i < n; ++i) {
+	  async_job *j = jobs[i];
+	  os_sem_t *s = (os_sem_t *) j->sync;
+
+	  if (j->done)
+	       j->done(j->arg);
+	  async_finish(j);
+	  os_sem_up(s); /* J may be gone from here on */
+     }
+}
+
+static FFTW_WORKER async_worker(void *arg)
+{
+     async_job *jobs[ASYNC_BATCH];
+
+     UNUSED(arg);
+     for (;;) {
+	  int n = 0;
+
+	  os_mutex_lock(&async_lock);
+	  ++async_idle;
+	  os_mutex_unlock(&async_lock);
+
+	  os_sem_down(&async_ready);
+
+	  os_mutex_lock(&async_lock);
+	  --async_idle;
+	  if (async_head)
+	       n = async_take(jobs);
+	  else if (async_quit) {
+	       os_mutex_unlock(&async_lock);
+	       break;
+	  }
+	  os_mutex_unlock(&async_lock);
+
+	  if (n)
+	       async_run(jobs, n);
+     }
+
+     os_sem_up(&termination_semaphore);
+     os_destroy_thread();
+     /* UNREACHABLE */
+     return 0;
+}
+
+void X(async_submit)(async_job *j)
+{
+     int queued = 0;
+
+     j->next = 0;
+     j->finished = 0;
+     j->sync = MALLOC(sizeof(os_sem_t), OTHER);
+     os_sem_init((os_sem_t *) j->sync);
+
+     if (async_on) {
+	  os_mutex_lock(&async_lock);
+	  if (async_queued >= async_idle
+	      && async_nworkers < async_maxworkers
+	      && reserve_workers(1)) {
+	       ++async_nworkers;
+	       os_create_thread(async_worker, 0);
+	  }
+	  if (async_nworkers > 0) {
+	       if (async_tail)
+		    async_tail->next = j;
+	       else
+		    async_head = j;
+	       async_tail = j;
+	       ++async_queued;
+	       queued = 1;
+	  }
+	  os_mutex_unlock(&async_lock);
+     }
+
+     if (queued)
+	  os_sem_up(&async_ready);
+     else
+	  async_run(&j, 1);
+}
+
+int X(async_test)(async_job *j)
+{
+     int finished;
+
+     if (!async_on)
+	  return j->finished;
+     os_mutex_lock(&async_lock);
+     finished = j->finished;
+     os_mutex_unlock(&async_lock);
+     return finished;
+}
+
+void X(async_wait)(async_job *j)
+{
+     os_sem_t *s = (os_sem_t *) j->sync;
+
+     os_sem_down(s);
+     os_sem_destroy(s);
+     X(ifree)(s);
+}
+
+static void async_init(void)
+{
+     os_mutex_init(&async_lock);
+     os_sem_init(&async_ready);
+     async_head = async_tail = 0;
+     async_nworkers = async_idle = async_queued = async_quit = 0;
+     async_maxworkers = X(imax)(1, X(measure_ncpus)());
+     async_on = 1;
+}
+
+/* the workers finish the queued jobs first */
+static void async_kill(void)
+{
+     int i;
+
+     os_mutex_lock(&async_lock);
+     async_quit = 1;
+     os_mutex_unlock(&async_lock);
+     for (i = 0; i < async_nworkers; ++i)
+	  os_sem_up(&async_ready);
+     for (i = 0; i < async_nworkers; ++i)
+	  os_sem_down(&termination_semaphore);
+     release_workers(async_nworkers);
+     async_on = 0;
+     os_sem_destroy(&async_ready);
+     os_mutex_destroy(&async_lock);
+}
+
 static os_static_mutex_t initialization_mutex = OS_STATIC_MUTEX_INITIALIZER;
 
 int X(ithreads_init)(void)
 {
+     install_arena_hooks();
+     install_tpool_key();
+     install_spool_hook();
+     os_pin_init();
      os_static_mutex_lock(&initialization_mutex); {
           os_mutex_init(&queue_lock);
           os_sem_init(&termination_semaphore);
@@ -384,6 +1234,8 @@ int X(ithreads_init)(void)
           WITH_QUEUE_LOCK({
                worker_queue = 0;
           });
+          pools_init();
+          async_init();
      } os_static_mutex_unlock(&initialization_mutex);
 
      return 0; /* no error */
@@ -398,8 +1250,9 @@ int X(ithreads_init)(void)
    This function returns only after all the threads have completed. */
 void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
 {
+     tpool *tp = get_tpool();
      int block_size;
-     int i;
+     int i, nw;
 
      A(loopmax >= 0);
      A(nthr > 0);
@@ -429,6 +1282,36 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
           X(spawnloop_callback)(proc, sdata, sizeof(spawn_data), nthr, X(spawnloop_callback_data));
           STACK_FREE(sdata);
      }
+     else if (nthr > 1 && (nw = pool_acquire(tp ? tp : &gpool, nthr - 1))) {
+          struct work *r;
+
+          if (nw < nthr - 1) { /* fewer workers: larger blocks */
+               block_size = (loopmax + nw) / (nw + 1);
+               nthr = (loopmax + block_size - 1) / block_size;
+          }
+          STACK_MALLOC(struct work *, r, sizeof(struct work) * nthr);
+
+          for (i = 0; i < nthr; ++i) {
+               spawn_data *d = &r[i].d;
+               d->max = (d->min = i * block_size) + block_size;
+               if (d->max > loopmax)
+                    d->max = loopmax;
+               d->thr_num = i;
+               d->data = data;
+               r[i].proc = proc;
+          }
+          pool_run(tp ? tp : &gpool, r, nthr);
+
+          STACK_FREE(r);
+     }
+     else if (tp) { /* never go beyond the threads of TP */
+          spawn_data d;
+          d.min = 0;
+          d.max = loopmax;
+          d.thr_num = 0;
+          d.data = data;
+          proc(&d);
+     }
      else {
           struct work *r;
           STACK_MALLOC(struct work *, r, sizeof(struct work) * nthr);
@@ -452,25 +1335,343 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
                     /* assign a worker to W */
                     w->q = dequeue();
 
-                    /* tell worker w->q to do it */
-                    w->q->w = w; /* Dirac could have written this */
-                    os_sem_up(&w->q->ready);
+                    if (!w->q) /* over the limit: do it ourselves */
+                         proc(d);
+                    else {
+                         /* tell worker w->q to do it */
+                         w->q->w = w; /* Dirac could have written this */
+                         os_sem_up(&w->q->ready);
+                    }
                }
           }
 
           for (i = 0; i < nthr - 1; ++i) {
                struct work *w = &r[i];
-               os_sem_down(&w->q->done);
-               enqueue(w->q);
+               if (w->q) {
+                    os_sem_down(&w->q->done);
+                    enqueue(w->q);
+               }
           }
 
           STACK_FREE(r);
      }
 }
 
+/* Work stealing (X(spawn_chunks)).  Each of the NTHR threads starts
+   with its share of the chunks in a deque of its own: a range of chunk
+   numbers, packed into one word.  It takes chunks from the front of
+   its range, and once that is empty it steals the back half of the
+   range of another thread, so that the chunks of a thread that is
+   late to start, or descheduled, are done by the others. */
+#ifdef HAVE_SPIN_POOL
+#define MAXCHUNK 0x7fff
+#define RANGE(lo, hi) ((lo) | ((hi) << 16))
+#define RANGE_LO(r) ((r) & 0xffff)
+#define RANGE_HI(r) ((r) >> 16)
+
+typedef struct {
+     os_atomic_t range;		/* chunks not taken yet */
+     char pad[CACHE_LINE];
+} chunk_deque;
+
+typedef struct {
+     int nthr;
+     chunk_deque *dq;
+     spawn_function proc;
+     void *data;
+} steal_data;
+
+/* the first chunk of Q, or -1 if none */
+static int take_chunk(chunk_deque *q)
+{
+     for (;;) {
+	  int r = os_atomic_get(&q->range);
+	  int lo = RANGE_LO(r), hi = RANGE_HI(r);
+	  if (lo >= hi)
+	       return -1;
+	  if (os_atomic_cas(&q->range, r, RANGE(lo + 1, hi)))
+	       return lo;
+     }
+}
+
+/* move the back half of the chunks of VICTIM to MINE, which is empty
+   and which only thieves touch meanwhile; returns the first of them,
+   or -1 if VICTIM has none */
+static int steal_chunks(chunk_deque *victim, chunk_deque *mine)
+{
+     for (;;) {
+	  int r = os_atomic_get(&victim->range);
+	  int lo = RANGE_LO(r), hi = RANGE_HI(r), mid;
+	  if (lo >= hi)
+	       return -1;
+	  mid = lo + (hi - lo) / 2;
+	  if (os_atomic_cas(&victim->range, r, RANGE(lo, mid))) {
+	       os_atomic_set(&mine->range, RANGE(mid + 1, hi));
+	       return mid;
+	  }
+     }
+}
+
+static void *steal_thread(spawn_data *d)
+{
+     steal_data *s = (steal_data *) d->data;
+     chunk_deque *mine = s->dq + d->thr_num;
+     spawn_data c;
+     int i, k;
+
+     c.thr_num = d->thr_num;
+     c.data = s->data;
+     for (;;) {
+	  i = take_chunk(mine);
+	  for (k = 1; i < 0 && k < s->nthr; ++k)
+	       i = steal_chunks(s->dq + (d->thr_num + k) % s->nthr, mine);
+	  if (i < 0)
+	       break;
+	  c.min = i;
+	  c.max = i + 1;
+	  s->proc(&c);
+     }
+     return 0;
+}
+
+void X(spawn_chunks)(int nchunk, int nthr, spawn_function proc, void *data)
+{
+     steal_data s;
+     int block_size, i;
+
+     if (nchunk <= nthr || nchunk > MAXCHUNK || X(spawnloop_callback)) {
+	  X(spawn_loop)(nchunk, nthr, proc, data);
+	  return;
+     }
+
+     block_size = (nchunk + nthr - 1) / nthr;
+     nthr = (nchunk + block_size - 1) / block_size;
+     s.nthr = nthr;
+     s.proc = proc;
+     s.data = data;
+     STACK_MALLOC(chunk_deque *, s.dq, sizeof(chunk_deque) * nthr);
+     for (i = 0; i < nthr; ++i)
+	  s.dq[i].range = RANGE(i * block_size,
+				X(imin)((i + 1) * block_size, nchunk));
+     X(spawn_loop)(nthr, nthr, steal_thread, &s);
+     STACK_FREE(s.dq);
+}
+#else
+void X(spawn_chunks)(int nchunk, int nthr, spawn_function proc, void *data)
+{
+     X(spawn_loop)(nchunk, nthr, proc, data);
+}
+#endif
+
+/* Concurrent plan measurement (X(measure_loop_hook)): run f(data, i,
+   slot) for i = 0..n-1 on NSLOTS threads, thread SLOT taking the next
+   unclaimed i each time.  If PIN, each thread is bound to a distinct
+   cpu of those the caller may run on while it measures. */
+typedef struct {
+     int n, next, pin;
+     int *cpus;
+     measure_function f;
+     void *data;
+     os_mutex_t lock;
+} measure_loop_data;
+
+static void *measure_thread(spawn_data *d)
+{
+     measure_loop_data *m = (measure_loop_data *) d->data;
+     int i;
+#ifdef MEASURE_PIN
+     cpu_set_t saved, one;
+     int pinned = 0;
+
+     if (m->pin && !pthread_getaffinity_np(pthread_self(), 
+					   sizeof(saved), &saved)) {
+	  CPU_ZERO(&one);
+	  CPU_SET(m->cpus[d->thr_num], &one);
+	  pinned = !pthread_setaffinity_np(pthread_self(), sizeof(one), &one);
+     }
+#endif
+
+     for (;;) {
+	  os_mutex_lock(&m->lock);
+	  i = m->next++;
+	  os_mutex_unlock(&m->lock);
+	  if (i >= m->n)
+	       break;
+	  m->f(m->data, i, d->thr_num);
+     }
+
+#ifdef MEASURE_PIN
+     if (pinned)
+	  pthread_setaffinity_np(pthread_self(), sizeof(saved), &saved);
+#endif
+     return 0;
+}
+
+/* number of cpus the caller may run on, or 0 if unknown */
+int X(measure_ncpus)(void)
+{
+#ifdef MEASURE_PIN
+     cpu_set_t allowed;
+     if (!sched_getaffinity(0, sizeof(allowed), &allowed))
+	  return CPU_COUNT(&allowed);
+#endif
+     return 0;
+}
+
+void X(measure_loop)(int n, int nslots, int pin, 
+		     measure_function f, void *data)
+{
+     measure_loop_data m;
+#ifdef MEASURE_PIN
+     cpu_set_t allowed;
+     int cpu, ncpu;
+#endif
+
+     A(n >= 0 && nslots > 0);
+     m.n = n;
+     m.next = 0;
+     m.pin = 0;
+     m.cpus = 0;
+     m.f = f;
+     m.data = data;
+
+#ifdef MEASURE_PIN
+     if (pin && !sched_getaffinity(0, sizeof(allowed), &allowed)) {
+	  m.cpus = (int *)MALLOC(nslots * sizeof(int), OTHER);
+	  for (cpu = ncpu = 0; cpu < CPU_SETSIZE && ncpu < nslots; ++cpu)
+	       if (CPU_ISSET(cpu, &allowed))
+		    m.cpus[ncpu++] = cpu;
+	  /* never put two measurements on one cpu */
+	  nslots = X(imax)(1, ncpu);
+	  m.pin = 1;
+     }
+#else
+     UNUSED(pin);
+#endif
+
+     os_mutex_init(&m.lock);
+     X(spawn_loop)(nslots, nslots, measure_thread, &m);
+     os_mutex_destroy(&m.lock);
+     X(ifree0)(m.cpus);
+}
+
+/* Pinned robust timing (X(measure_pin_hook)): bind the calling thread
+   to the cpu it is running on, saving its own affinity to give back. */
+void *X(measure_pin)(void)
+{
+#ifdef MEASURE_PIN
+     cpu_set_t *saved = (cpu_set_t *)MALLOC(sizeof(cpu_set_t), OTHER);
+     int cpu = sched_getcpu();
+
+     if (cpu >= 0 && !pthread_getaffinity_np(pthread_self(), 
+					     sizeof(*saved), saved)) {
+	  os_pin_thread(cpu);
+	  return saved;
+     }
+     X(ifree)(saved);
+#endif
+     return 0;
+}
+
+void X(measure_unpin)(void *saved)
+{
+#ifdef MEASURE_PIN
+     pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), 
+			    (cpu_set_t *) saved);
+     X(ifree)(saved);
+#else
+     UNUSED(saved);
+#endif
+}
+
+/* Per-thread planners (X(make_planner_concurrent)).  A thread gets
+   its planner from MK the first time it plans.  All of them are kept
+   on a list, so that X(thread_planners_cleanup) can destroy those of
+   threads that are still alive; a thread that exits destroys its own. */
+struct tplanner {
+     planner *plnr;
+     struct tplanner *prev, *next;
+};
+
+static os_tls_t tplanner_key;
+static os_mutex_t tplanners_lock; /* guards tplanners */
+static struct tplanner *tplanners;
+static planner *(*tplanner_mk)(void);
+static os_mutex_t caches_lock;
+
+static void lock_caches(void) { os_mutex_lock(&caches_lock); }
+static void unlock_caches(void) { os_mutex_unlock(&caches_lock); }
+
+static void tplanner_unlink(struct tplanner *t)
+{
+     if (t->prev) t->prev->next = t->next; else tplanners = t->next;
+     if (t->next) t->next->prev = t->prev;
+}
+
+static void tplanner_exit(void *arg)
+{
+     struct tplanner *t = (struct tplanner *) arg;
+
+     os_mutex_lock(&tplanners_lock);
+     tplanner_unlink(t);
+     os_mutex_unlock(&tplanners_lock);
+     X(planner_destroy)(t->plnr);
+     X(ifree)(t);
+}
+
+int X(thread_planners_init)(planner *(*mk)(void))
+{
+     if (!os_tls_init(&tplanner_key, tplanner_exit))
+	  return 0;
+     os_mutex_init(&tplanners_lock);
+     os_mutex_init(&caches_lock);
+     tplanners = 0;
+     tplanner_mk = mk;
+     X(lock_caches_hook) = lock_caches;
+     X(unlock_caches_hook) = unlock_caches;
+     return 1;
+}
+
+planner *X(thread_planner)(void)
+{
+     struct tplanner *t = (struct tplanner *) os_tls_get(&tplanner_key);
+
+     if (!t) {
+	  t = (struct tplanner *) MALLOC(sizeof(struct tplanner), PLANNERS);
+	  t->plnr = tplanner_mk();
+	  os_mutex_lock(&tplanners_lock);
+	  t->prev = 0;
+	  t->next = tplanners;
+	  if (tplanners) tplanners->prev = t;
+	  tplanners = t;
+	  os_mutex_unlock(&tplanners_lock);
+	  os_tls_set(&tplanner_key, t);
+     }
+     return t->plnr;
+}
+
+/* no thread may be planning */
+void X(thread_planners_cleanup)(void)
+{
+     os_tls_destroy(&tplanner_key);
+     while (tplanners) {
+	  struct tplanner *t = tplanners;
+	  tplanner_unlink(t);
+	  X(planner_destroy)(t->plnr);
+	  X(ifree)(t);
+     }
+     X(lock_caches_hook) = 0;
+     X(unlock_caches_hook) = 0;
+     os_mutex_destroy(&tplanners_lock);
+     os_mutex_destroy(&caches_lock);
+}
+
 void X(threads_cleanup)(void)
 {
+     async_kill();
+     pools_kill();
      kill_workforce();
+     spools_flush();
      os_mutex_destroy(&queue_lock);
      os_sem_destroy(&termination_semaphore);
 }
@@ -491,6 +1692,8 @@ static void unlock_planner_mutex(void)
 
 void X(threads_register_planner_hooks)(void)
 {
+     install_arena_hooks();
+     install_spool_hook();
      os_static_mutex_lock(&install_planner_hooks_mutex); {
           if (!planner_hooks_installed) {
                os_mutex_init(&planner_mutex);
@@ -34,8 +34,71 @@ typedef void *(*spawn_function) (spawn_data *);
 
 void X(spawn_loop)(int loopmax, int nthreads,
 		   spawn_function proc, void *data);
+void X(spawn_chunks)(int nchunk, int nthreads,
+		     spawn_function proc, void *data);
+INT X(thr_block_size)(INT n, int nthr, const planner *plnr);
+int X(thr_nthr)(int nthr, int shift);
+#define THR_NSHIFT 3 /* variants of the vrank solvers: all, 1/2, 1/4 */
+
+/* what threads cost, in the estimates of the threaded solvers */
+typedef struct {
+     double spawn;   /* seconds to wake up and join each extra thread */
+     double rate;    /* operations per second of one thread */
+     double ncpus;   /* threads that run at once */
+     double bw;      /* threads that saturate the memory bandwidth */
+     double cache;   /* bytes of cache of each thread */
+} thrmodel;
+
+extern thrmodel X(thr_model);
+void X(thr_ops)(opcnt *ops, const opcnt *par, int nthr);
 int X(ithreads_init)(void);
 void X(threads_cleanup)(void);
+int X(measure_ncpus)(void);
+
+/* per-thread planners for X(make_planner_concurrent) */
+int X(thread_planners_init)(planner *(*mk)(void));
+planner *X(thread_planner)(void);
+void X(thread_planners_cleanup)(void);
+
+void X(measure_loop)(int n, int nslots, int pin, 
+		     measure_function f, void *data);
+void *X(measure_pin)(void);
+void X(measure_unpin)(void *saved);
+
+extern double X(threads_spin_time);
+
+/* thread pools of X(threadpool_create), and the one whose workers run
+   the loops of the calling thread */
+struct X(threadpool_s) *X(mktpool)(int nthreads, const int *cpus, int ncpus);
+void X(tpool_destroy)(struct X(threadpool_s) *tp);
+int X(tpool_nthreads)(const struct X(threadpool_s) *tp);
+struct X(threadpool_s) *X(tpool_enter)(struct X(threadpool_s) *tp);
+void X(tpool_leave)(struct X(threadpool_s) *prev);
+void X(threads_max_workers)(int n);
+void X(threads_affinity)(const int *cpus, int ncpus);
+
+/* jobs of the asynchronous execute functions: RUN(JOBS, N) carries
+   out N jobs queued with the same RUN and KEY, back to back, after
+   which DONE(ARG), if any, is called for each */
+typedef struct async_job_s async_job;
+struct async_job_s {
+     void (*run)(async_job **jobs, int n);
+     const void *key;
+     void (*done)(void *arg);
+     void *arg;
+     async_job *next;
+     void *sync;
+     int finished;
+};
+#define ASYNC_BATCH 64 /* the most jobs run as one */
+
+void X(async_submit)(async_job *j);
+int X(async_test)(async_job *j);
+void X(async_wait)(async_job *j);
+
+/* the sum of the statistics of the scratch pools of all threads, those
+   that exited included */
+void X(scratch_pools_stats)(scratch_pool_stats *s);
 
 typedef void (*spawnloop_function)(spawn_function, spawn_data *, size_t, int, void *);
 extern spawnloop_function X(spawnloop_callback);
@@ -27,6 +27,7 @@ typedef struct {
      int vecloop_dim;
      const int *buddies;
      size_t nbuddies;
+     int shift;			/* uses nthr >> shift threads */
 } S;
 
 typedef struct {
@@ -34,7 +35,8 @@ typedef struct {
 
      plan **cldrn;
      INT its, ots;
-     int nthr;
+     int nblk;			/* blocks, one child plan each */
+     int nthr;			/* threads to run them on */
      const S *solver;
 } P;
 
@@ -49,12 +51,14 @@ static void *spawn_apply(spawn_data *d)
      PD *ego = (PD *) d->data;
      INT its = ego->its;
      INT ots = ego->ots;
-     int thr_num = d->thr_num;
-     plan_rdft2 *cld = (plan_rdft2 *) ego->cldrn[d->thr_num];
+     int i;
 
-     cld->apply((plan *) cld,
-		ego->r0 + thr_num * its, ego->r1 + thr_num * its,
-		ego->cr + thr_num * ots, ego->ci + thr_num * ots);
+     for (i = d->min; i < d->max; ++i) {
+	  plan_rdft2 *cld = (plan_rdft2 *) ego->cldrn[i];
+	  cld->apply((plan *) cld,
+		     ego->r0 + i * its, ego->r1 + i * its,
+		     ego->cr + i * ots, ego->ci + i * ots);
+     }
      return 0;
 }
 
@@ -68,14 +72,14 @@ static void apply(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
      d.cldrn = ego->cldrn;
      d.r0 = r0; d.r1 = r1; d.cr = cr; d.ci = ci;
 
-     X(spawn_loop)(ego->nthr, ego->nthr, spawn_apply, (void*) &d);
+     X(spawn_chunks)(ego->nblk, ego->nthr, spawn_apply, (void*) &d);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
 {
      P *ego = (P *) ego_;
      int i;
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  X(plan_awake)(ego->cldrn[i], wakefulness);
 }
 
@@ -83,9 +87,9 @@ static void destroy(plan *ego_)
 {
      P *ego = (P *) ego_;
      int i;
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  X(plan_destroy_internal)(ego->cldrn[i]);
-     X(ifree)(ego->cldrn);
+     X(arena_ifree)(ego->cldrn);
 }
 
 static void print(const plan *ego_, printer *p)
@@ -94,7 +98,7 @@ static void print(const plan *ego_, printer *p)
      const S *s = ego->solver;
      int i;
      p->print(p, "(rdft2-thr-vrank>=1-x%d/%d)", ego->nthr, s->vecloop_dim);
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  if (i == 0 || (ego->cldrn[i] != ego->cldrn[i-1] &&
 			 (i <= 1 || ego->cldrn[i] != ego->cldrn[i-2])))
 	       p->print(p, "%(%p%)", ego->cldrn[i]);
@@ -116,6 +120,7 @@ static int applicable0(const solver *ego_, const problem *p_,
      if (FINITE_RNK(p->vecsz->rnk)
 	 && p->vecsz->rnk > 0
 	 && plnr->nthr > 1
+	 && X(thr_nthr)(plnr->nthr, ego->shift) > 1
 	 && pickdim(ego, p->vecsz, p->r0 != p->cr, dp)) {
 	  if (p->r0 != p->cr)
 	       return 1;  /* can always operate out-of-place */
@@ -149,7 +154,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      int vdim;
      iodim *d;
      plan **cldrn = (plan **) 0;
-     int i, nthr;
+     int i, nblk, nthr;
      INT its, ots, block_size;
      tensor *vecsz;
 
@@ -163,19 +168,21 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      d = p->vecsz->dims + vdim;
 
-     block_size = (d->n + plnr->nthr - 1) / plnr->nthr;
-     nthr = (int)((d->n + block_size - 1) / block_size);
-     plnr->nthr = (plnr->nthr + nthr - 1) / nthr;
+     nthr = X(thr_nthr)(plnr->nthr, ego->shift);
+     block_size = X(thr_block_size)(d->n, nthr, plnr);
+     nblk = (int)((d->n + block_size - 1) / block_size);
+     plnr->nthr = (nthr + nblk - 1) / nblk;
+     nthr = X(imin)(nthr, nblk);
      X(rdft2_strides)(p->kind, d, &its, &ots);
      its *= block_size; ots *= block_size;
 
-     cldrn = (plan **)MALLOC(sizeof(plan *) * nthr, PLANS);
-     for (i = 0; i < nthr; ++i) cldrn[i] = (plan *) 0;
+     cldrn = (plan **)MALLOC(sizeof(plan *) * nblk, PLANS);
+     for (i = 0; i < nblk; ++i) cldrn[i] = (plan *) 0;
      
      vecsz = X(tensor_copy)(p->vecsz);
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
 	  vecsz->dims[vdim].n =
-	       (i == nthr - 1) ? (d->n - i*block_size) : block_size;
+	       (i == nblk - 1) ? (d->n - i*block_size) : block_size;
 	  cldp = X(mkproblem_rdft2)(p->sz, vecsz,
 				    p->r0 + i*its, p->r1 + i*its,
 				    p->cr + i*ots, p->ci + i*ots, 
@@ -190,35 +197,41 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->cldrn = cldrn;
      pln->its = its;
      pln->ots = ots;
+     pln->nblk = nblk;
      pln->nthr = nthr;
 
      pln->solver = ego;
      X(ops_zero)(&pln->super.super.ops);
      pln->super.super.pcost = 0;
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
 	  X(ops_add2)(&cldrn[i]->ops, &pln->super.super.ops);
 	  pln->super.super.pcost += cldrn[i]->pcost;
+	  pln->super.super.nthr = X(imax)(pln->super.super.nthr,
+					  nthr * cldrn[i]->nthr);
      }
+     X(thr_ops)(&pln->super.super.ops, &pln->super.super.ops, nthr);
 
      return &(pln->super.super);
 
  nada:
      if (cldrn) {
-	  for (i = 0; i < nthr; ++i)
+	  for (i = 0; i < nblk; ++i)
 	       X(plan_destroy_internal)(cldrn[i]);
-	  X(ifree)(cldrn);
+	  X(arena_ifree)(cldrn);
      }
      X(tensor_destroy)(vecsz);
      return (plan *) 0;
 }
 
-static solver *mksolver(int vecloop_dim, const int *buddies, size_t nbuddies)
+static solver *mksolver(int vecloop_dim, const int *buddies, size_t nbuddies,
+			int shift)
 {
      static const solver_adt sadt = { PROBLEM_RDFT2, mkplan, 0 };
      S *slv = MKSOLVER(S, &sadt);
      slv->vecloop_dim = vecloop_dim;
      slv->buddies = buddies;
      slv->nbuddies = nbuddies;
+     slv->shift = shift;
      return &(slv->super);
 }
 
@@ -227,7 +240,10 @@ void X(rdft2_thr_vrank_geq1_register)(planner *p)
      /* FIXME: Should we try other vecloop_dim values? */
      static const int buddies[] = { 1, -1 };
      size_t i;
+     int shift;
 
-     for (i = 0; i < NELEM(buddies); ++i)
-          REGISTER_SOLVER(p, mksolver(buddies[i], buddies, NELEM(buddies)));
+     for (shift = 0; shift < THR_NSHIFT; ++shift)
+	  for (i = 0; i < NELEM(buddies); ++i)
+	       REGISTER_SOLVER(p, mksolver(buddies[i], buddies,
+					   NELEM(buddies), shift));
 }
@@ -79,6 +79,7 @@ static struct my_option options[] =
   {"time-limit", REQARG, 't'},
 
   {"output-file", REQARG, 'o'},
+  {"binary", NOARG, 'b'},
 
   {"impatient", NOARG, 'i'},
   {"measure", NOARG, 'm'},
@@ -104,6 +105,7 @@ static void help(FILE *f, const char *program_name)
 	  "Usage: %s [options] [sizes]\n"
 "    Create wisdom (pre-planned/optimized transforms) for specified sizes,\n"
 "    writing wisdom to stdout (or to a file, using -o).\n"
+"    Without sizes, converts wisdom read with -w (e.g. to binary with -b).\n"
 	  "\nOptions:\n"
  "                   -h, --help: print this help\n"
  "                -V, --version: print version/copyright info\n"
@@ -111,11 +113,13 @@ static void help(FILE *f, const char *program_name)
  "              -c, --canonical: plan/optimize canonical set of sizes\n"
  "     -t <h>, --time-limit=<h>: time limit in hours (default: 0, no limit)\n"
  "  -o FILE, --output-file=FILE: output to FILE instead of stdout\n"
+ "                 -b, --binary: output binary wisdom (requires -o)\n"
  "                -m, --measure: plan in MEASURE mode (PATIENT is default)\n"
  "               -e, --estimate: plan in ESTIMATE mode (not recommended)\n"
  "             -x, --exhaustive: plan in EXHAUSTIVE mode (may be slow)\n"
  "       -n, --no-system-wisdom: don't read /etc/fftw/ system wisdom file\n"
- "  -w FILE, --wisdom-file=FILE: read wisdom from FILE (stdin if -)\n"
+ "  -w FILE, --wisdom-file=FILE: read wisdom from FILE (stdin if -),\n"
+ "                               text or binary\n"
 #ifdef HAVE_SMP
  "            -T N, --threads=N: plan with N threads\n"
 #endif
@@ -155,8 +159,9 @@ int bench_main(int argc, char *argv[])
      int system_wisdom = 1;
      int canonical = 0;
      double hours = 0;
-     FILE *output_file;
+     FILE *output_file = 0;
      char *output_fname = 0;
+     int binary = 0;
      bench_problem **problems = 0;
      int nproblems = 0, iproblem = 0;
      time_t begin;
@@ -227,6 +232,10 @@ int bench_main(int argc, char *argv[])
 		   }
 		   break;
 
+	      case 'b':
+		   binary = 1;
+		   break;
+
 	      case 'm':
 	      case 'i':
 		   impatient = 1;
@@ -246,6 +255,9 @@ int bench_main(int argc, char *argv[])
 
 	      case 'w': {
 		   FILE *w = stdin;
+		   if (strcmp(my_optarg, "-")
+		       && FFTW(import_wisdom_from_binary_filename)(my_optarg))
+			break;
 		   if (strcmp(my_optarg, "-") && !(w = fopen(my_optarg, "r"))) {
 			fprintf(stderr,
 				"fftw-wisdom: error opening \"%s\": ", my_optarg);
@@ -324,9 +336,13 @@ int bench_main(int argc, char *argv[])
      nproblems = iproblem;
      qsort(problems, nproblems, sizeof(bench_problem *), prob_size_cmp);
 
+     if (binary && !output_fname) {
+	  fprintf(stderr, "fftw-wisdom: binary output requires -o\n");
+	  exit(EXIT_FAILURE);
+     }
      if (!output_fname)
 	  output_file = stdout;
-     else
+     else if (!binary)
 	  if (!(output_file = fopen(output_fname, "w"))) {
 	       fprintf(stderr,
 		       "fftw-wisdom: error creating \"%s\"", output_fname);
@@ -348,9 +364,17 @@ int bench_main(int argc, char *argv[])
 	 && hours < (time((time_t*)0) - begin) / 3600.0)
 	  fprintf(stderr, "EXCEEDED TIME LIMIT OF %g HOURS.\n", hours);
 
-     FFTW(export_wisdom_to_file)(output_file);
-     if (output_file != stdout)
-	  fclose(output_file);
+     if (binary) {
+	  if (!FFTW(export_wisdom_to_binary_filename)(output_fname)) {
+	       fprintf(stderr,
+		       "fftw-wisdom: error writing \"%s\"\n", output_fname);
+	       exit(EXIT_FAILURE);
+	  }
+     } else {
+	  FFTW(export_wisdom_to_file)(output_file);
+	  if (output_file != stdout)
+	       fclose(output_file);
+     }
      if (output_fname)
 	  bench_free(output_fname);
 